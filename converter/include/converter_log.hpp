@@ -0,0 +1,37 @@
+#pragma once
+
+#include <iostream>
+
+namespace rive_converter
+{
+
+// Stream the converter's progress messages go to on the calling thread.
+// Defaults to std::cout. Per thread, so batch workers can silence or
+// redirect their own conversion without touching the process-wide streams.
+inline std::ostream*& log_stream_slot()
+{
+    thread_local std::ostream* stream = &std::cout;
+    return stream;
+}
+
+inline std::ostream& log_stream() { return *log_stream_slot(); }
+
+// Points log_stream() at another stream for the lifetime of this object.
+class ScopedLogStream
+{
+public:
+    explicit ScopedLogStream(std::ostream& stream) :
+        m_previous(log_stream_slot())
+    {
+        log_stream_slot() = &stream;
+    }
+    ~ScopedLogStream() { log_stream_slot() = m_previous; }
+
+    ScopedLogStream(const ScopedLogStream&) = delete;
+    ScopedLogStream& operator=(const ScopedLogStream&) = delete;
+
+private:
+    std::ostream* m_previous;
+};
+
+} // namespace rive_converter
@@ -1,4 +1,5 @@
 #pragma once
+#include <deque>
 #include <vector>
 #include <unordered_map>
 #include <variant>
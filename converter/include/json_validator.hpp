@@ -48,13 +48,33 @@ public:
     void printResults(const ValidationResult& result, bool verbose = false);
     
 private:
-    // Helper: get required properties for a given typeKey
-    std::vector<std::string> getRequiredProperties(uint16_t typeKey);
-    
-    // Helper: DFS cycle detection
-    bool detectCycleFrom(uint32_t start, 
-                        const std::map<uint32_t, uint32_t>& childToParent,
-                        std::vector<uint32_t>& cycle);
+    // Objects indexed by their position in the objects array, with each
+    // object's parent resolved to an index once so the graph checks don't
+    // do any lookups by id.
+    struct ParentGraph
+    {
+        static constexpr int32_t noParent = -1;
+        static constexpr int32_t missingParent = -2;
+
+        // Each object's localId (0 when it has none).
+        std::vector<uint32_t> localIds;
+        // Index of each object's parent, noParent or missingParent.
+        std::vector<int32_t> parents;
+        // Whether the object is a node of the parent graph: it has a localId
+        // and is the last object using it (matching which one a lookup by
+        // id resolves to).
+        std::vector<bool> isNode;
+    };
+
+    static ParentGraph buildParentGraph(const nlohmann::json& objects);
+    static void reportMissingParents(const nlohmann::json& objects,
+                                     const ParentGraph& graph,
+                                     ValidationResult& result);
+    static void findCycle(const ParentGraph& graph, ValidationResult& result);
+
+    // Helper: required properties for a given typeKey, nullptr if none are
+    // tracked
+    static const std::vector<std::string>* getRequiredProperties(uint16_t typeKey);
 };
 
 } // namespace rive_converter
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "core_builder.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace rive_converter
+{
+
+struct OptimizeOptions
+{
+    // Drop KeyFrameDouble keyframes the neighbouring keyframes already
+    // reproduce within keyFrameTolerance (in property units).
+    bool reduceKeyFrames = true;
+    float keyFrameTolerance = 1e-4f;
+
+    // Point keyframes, transitions, layout styles and converters at a single
+    // copy of identical interpolators.
+    bool mergeInterpolators = true;
+
+    // Drop gradient stops that duplicate an earlier stop of the same
+    // gradient (same position and color).
+    bool dedupeGradientStops = true;
+
+    // Drop interpolators nothing references and keyed objects/properties
+    // left without keyframes.
+    bool dropUnreferenced = true;
+
+    // Round float properties to a multiple of quantizeStep (0 disables it).
+    // Floats are always written as 4 bytes, so this only shrinks files that
+    // are compressed for transport.
+    float quantizeStep = 0.0f;
+};
+
+struct OptimizePassReport
+{
+    std::string name;
+    size_t objectsBefore = 0;
+    size_t objectsAfter = 0;
+    // Estimated size of the object stream, see estimate_object_bytes.
+    size_t bytesBefore = 0;
+    size_t bytesAfter = 0;
+    // Number of objects the pass removed or rewrote in place.
+    size_t changed = 0;
+    // Largest error the pass introduced, in property units.
+    float maxError = 0.0f;
+};
+
+struct OptimizeReport
+{
+    std::vector<OptimizePassReport> passes;
+};
+
+// Estimated encoded size of the document's objects (type keys, ids and
+// properties). Excludes the header, which the passes don't affect.
+size_t estimate_object_bytes(const CoreDocument& document,
+                             const PropertyTypeMap& typeMap);
+
+// Runs the enabled passes over document in place, in the order they are
+// declared in OptimizeOptions.
+OptimizeReport optimize_core_document(CoreDocument& document,
+                                      const PropertyTypeMap& typeMap,
+                                      const OptimizeOptions& options);
+
+void print_optimize_report(const OptimizeReport& report);
+
+} // namespace rive_converter
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "rive/core/binary_stream.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+namespace rive_converter
+{
+
+// Receives serialized RIV bytes in file order. Returns false if the bytes
+// couldn't be stored. Sinks must not throw: they run from rive::BinaryWriter's
+// destructor, which flushes the stream.
+using RivSink = std::function<bool(const uint8_t* bytes, size_t length)>;
+
+// BinaryStream that collects writes in a fixed-size buffer and hands them to
+// a sink whenever it fills up, so serializing holds at most one buffer of
+// output in memory. Writes larger than the buffer (embedded assets) go to the
+// sink directly instead of being copied. Once the sink fails, later output
+// is dropped and failed() reports true.
+class RivStreamWriter : public rive::BinaryStream
+{
+public:
+    explicit RivStreamWriter(RivSink sink, size_t bufferSize = 64 * 1024);
+    ~RivStreamWriter();
+
+    void write(const uint8_t* bytes, size_t length) override;
+    // Passes everything buffered so far to the sink.
+    void flush() override;
+    // Drops buffered bytes that haven't reached the sink yet.
+    void clear() override;
+
+    // Bytes accepted so far, including those still buffered.
+    size_t bytesWritten() const { return m_bytesWritten; }
+    // True once the sink has rejected a write.
+    bool failed() const { return m_failed; }
+
+private:
+    RivSink m_sink;
+    std::vector<uint8_t> m_buffer;
+    size_t m_used = 0;
+    size_t m_bytesWritten = 0;
+    bool m_failed = false;
+};
+
+// Sink writing to an open file. Fails if fwrite comes up short.
+RivSink file_sink(FILE* file);
+
+// Sink appending to a vector.
+RivSink vector_sink(std::vector<uint8_t>& bytes);
+
+} // namespace rive_converter
@@ -4,6 +4,7 @@
 #include <cstdint>
 #include "json_loader.hpp"
 #include "core_builder.hpp"
+#include "rive/core/binary_stream.hpp"
 #include <nlohmann/json.hpp>
 
 namespace rive_converter
@@ -11,4 +12,12 @@ namespace rive_converter
 std::vector<uint8_t> serialize_minimal_riv(const Document& document);
 std::vector<uint8_t> serialize_core_document(const CoreDocument& document, PropertyTypeMap& typeMap);
 std::vector<uint8_t> serialize_exact_riv_json(const nlohmann::json& data);
+
+// Streaming variants of the above. The ToC and field bitmap are computed in a
+// pre-pass, then objects are encoded straight into stream (see
+// RivStreamWriter for writing to a file or callback in bounded memory).
+// stream is flushed before they return.
+void write_minimal_riv(const Document& document, rive::BinaryStream& stream);
+void write_core_document(const CoreDocument& document, PropertyTypeMap& typeMap, rive::BinaryStream& stream);
+void write_exact_riv_json(const nlohmann::json& data, rive::BinaryStream& stream);
 }
@@ -1,6 +1,8 @@
 #ifndef RIVE_CONVERTER_SERIALIZER_DIAGNOSTICS_HPP
 #define RIVE_CONVERTER_SERIALIZER_DIAGNOSTICS_HPP
 
+#include "converter_log.hpp"
+
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -54,12 +56,12 @@ public:
         info.expectedSize = expectedSize;
         m_Chunks.push_back(info);
         
-        std::cout << m_Indent << "📦 " << name << " @ offset " << offset;
+        log_stream() << m_Indent << "📦 " << name << " @ offset " << offset;
         if (expectedSize > 0)
         {
-            std::cout << " (expect ~" << expectedSize << " bytes)";
+            log_stream() << " (expect ~" << expectedSize << " bytes)";
         }
-        std::cout << std::endl;
+        log_stream() << std::endl;
         
         m_Indent += "  ";
     }
@@ -78,7 +80,7 @@ public:
             m_Chunks.back().endOffset = offset;
             size_t actualSize = offset - m_Chunks.back().startOffset;
             
-            std::cout << m_Indent << "✅ " << name << " complete: " << actualSize << " bytes";
+            log_stream() << m_Indent << "✅ " << name << " complete: " << actualSize << " bytes";
             
             if (m_Chunks.back().expectedSize > 0)
             {
@@ -86,18 +88,18 @@ public:
                 int diff = static_cast<int>(actualSize) - static_cast<int>(expected);
                 if (diff != 0)
                 {
-                    std::cout << " (diff: " << (diff > 0 ? "+" : "") << diff << ")";
+                    log_stream() << " (diff: " << (diff > 0 ? "+" : "") << diff << ")";
                 }
             }
             
-            std::cout << std::endl;
+            log_stream() << std::endl;
         }
     }
     
     void logOffset(const std::string& label, size_t offset)
     {
         if (!m_Enabled) return;
-        std::cout << m_Indent << "  📍 " << label << ": offset " << offset << std::endl;
+        log_stream() << m_Indent << "  📍 " << label << ": offset " << offset << std::endl;
     }
     
     void logAlignment(const std::string& what, size_t offset, size_t alignment)
@@ -107,12 +109,12 @@ public:
         size_t remainder = offset % alignment;
         if (remainder == 0)
         {
-            std::cout << m_Indent << "  ✓ " << what << " aligned to " << alignment 
+            log_stream() << m_Indent << "  ✓ " << what << " aligned to " << alignment 
                      << " bytes (offset " << offset << ")" << std::endl;
         }
         else
         {
-            std::cout << m_Indent << "  ⚠ " << what << " NOT aligned to " << alignment 
+            log_stream() << m_Indent << "  ⚠ " << what << " NOT aligned to " << alignment 
                      << " bytes (offset " << offset << ", remainder " << remainder << ")" << std::endl;
         }
     }
@@ -126,40 +128,40 @@ public:
     void logCount(const std::string& what, size_t count)
     {
         if (!m_Enabled) return;
-        std::cout << m_Indent << "  🔢 " << what << ": " << count << std::endl;
+        log_stream() << m_Indent << "  🔢 " << what << ": " << count << std::endl;
     }
     
     void logProperty(const std::string& name, uint16_t key, const std::string& type)
     {
         if (!m_Enabled) return;
-        std::cout << m_Indent << "    • " << name << " (key " << key << ", " << type << ")" << std::endl;
+        log_stream() << m_Indent << "    • " << name << " (key " << key << ", " << type << ")" << std::endl;
     }
     
     void warn(const std::string& message)
     {
         if (!m_Enabled) return;
-        std::cout << m_Indent << "  ⚠️  WARNING: " << message << std::endl;
+        log_stream() << m_Indent << "  ⚠️  WARNING: " << message << std::endl;
     }
     
     void error(const std::string& message)
     {
         if (!m_Enabled) return;
-        std::cout << m_Indent << "  ❌ ERROR: " << message << std::endl;
+        log_stream() << m_Indent << "  ❌ ERROR: " << message << std::endl;
     }
     
     void info(const std::string& message)
     {
         if (!m_Enabled) return;
-        std::cout << m_Indent << "  ℹ️  " << message << std::endl;
+        log_stream() << m_Indent << "  ℹ️  " << message << std::endl;
     }
     
     void printSummary()
     {
         if (!m_Enabled || m_Chunks.empty()) return;
         
-        std::cout << "\n" << "═══════════════════════════════════════════════════════════" << std::endl;
-        std::cout << "Serialization Summary" << std::endl;
-        std::cout << "═══════════════════════════════════════════════════════════" << std::endl;
+        log_stream() << "\n" << "═══════════════════════════════════════════════════════════" << std::endl;
+        log_stream() << "Serialization Summary" << std::endl;
+        log_stream() << "═══════════════════════════════════════════════════════════" << std::endl;
         
         size_t totalSize = m_Chunks.empty() ? 0 : m_Chunks.back().endOffset;
         
@@ -168,11 +170,11 @@ public:
             size_t size = chunk.endOffset - chunk.startOffset;
             float pct = (totalSize > 0) ? (static_cast<float>(size) / totalSize * 100.0f) : 0.0f;
             
-            std::cout << chunk.name << ": " << size << " bytes (" << pct << "%)" << std::endl;
+            log_stream() << chunk.name << ": " << size << " bytes (" << pct << "%)" << std::endl;
         }
         
-        std::cout << "\nTotal: " << totalSize << " bytes" << std::endl;
-        std::cout << "═══════════════════════════════════════════════════════════\n" << std::endl;
+        log_stream() << "\nTotal: " << totalSize << " bytes" << std::endl;
+        log_stream() << "═══════════════════════════════════════════════════════════\n" << std::endl;
     }
 };
 
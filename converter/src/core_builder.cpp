@@ -1,4 +1,5 @@
 #include "core_builder.hpp"
+#include "converter_log.hpp"
 #include "hierarchical_schema.hpp"
 #include "font_utils.hpp"
 #include <iostream>
@@ -158,7 +159,7 @@ static void build_hierarchical_shapes(CoreBuilder& builder,
                                       const std::vector<rive_hierarchical::HierarchicalShapeData>& shapes,
                                       uint32_t artboardId)
 {
-    std::cout << "Building " << shapes.size() << " hierarchical shapes..." << std::endl;
+    log_stream() << "Building " << shapes.size() << " hierarchical shapes..." << std::endl;
     
     for (const auto& shapeData : shapes)
     {
@@ -329,7 +330,7 @@ static void build_hierarchical_shapes(CoreBuilder& builder,
         }
     }
     
-    std::cout << "Built " << shapes.size() << " shapes successfully!" << std::endl;
+    log_stream() << "Built " << shapes.size() << " shapes successfully!" << std::endl;
 }
 
 CoreBuilder::CoreBuilder() = default;
@@ -852,7 +853,7 @@ CoreDocument build_core_document(const Document& document,
     // Build hierarchical shapes (EXACT COPY MODE!)
     if (artboardData.useHierarchical && !artboardData.hierarchicalShapes.empty())
     {
-        std::cout << "Using HIERARCHICAL builder for exact copy!" << std::endl;
+        log_stream() << "Using HIERARCHICAL builder for exact copy!" << std::endl;
         build_hierarchical_shapes(builder, artboardData.hierarchicalShapes, artboard.id);
     }
     // Build custom paths with vertices (LEGACY MODE)
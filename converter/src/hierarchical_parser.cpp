@@ -1,4 +1,5 @@
 #include "hierarchical_schema.hpp"
+#include "converter_log.hpp"
 #include "json_loader.hpp"
 #include <nlohmann/json.hpp>
 #include <algorithm>
@@ -275,27 +276,27 @@ ArtboardData parse_artboard(const nlohmann::json& artboardJson)
     // Parse hierarchical shapes
     if (artboardJson.contains("hierarchicalShapes") && artboardJson["hierarchicalShapes"].is_array())
     {
-        std::cout << "Parsing " << artboardJson["hierarchicalShapes"].size() << " hierarchical shapes..." << std::endl;
+        rive_converter::log_stream() << "Parsing " << artboardJson["hierarchicalShapes"].size() << " hierarchical shapes..." << std::endl;
         
         for (const auto& shapeJson : artboardJson["hierarchicalShapes"])
         {
             artboard.shapes.push_back(parse_hierarchical_shape(shapeJson));
         }
         
-        std::cout << "Parsed " << artboard.shapes.size() << " shapes" << std::endl;
+        rive_converter::log_stream() << "Parsed " << artboard.shapes.size() << " shapes" << std::endl;
     }
     
     // Parse texts
     if (artboardJson.contains("texts") && artboardJson["texts"].is_array())
     {
-        std::cout << "Parsing " << artboardJson["texts"].size() << " texts..." << std::endl;
+        rive_converter::log_stream() << "Parsing " << artboardJson["texts"].size() << " texts..." << std::endl;
         
         for (const auto& textJson : artboardJson["texts"])
         {
             artboard.texts.push_back(parse_text(textJson));
         }
         
-        std::cout << "Parsed " << artboard.texts.size() << " texts" << std::endl;
+        rive_converter::log_stream() << "Parsed " << artboard.texts.size() << " texts" << std::endl;
     }
     
     // Parse animations
@@ -324,7 +325,7 @@ DocumentData parse_hierarchical_json(const std::string& json_content)
     DocumentData doc;
     auto json = nlohmann::json::parse(json_content);
     
-    std::cout << "=== HIERARCHICAL PARSER ===" << std::endl;
+    rive_converter::log_stream() << "=== HIERARCHICAL PARSER ===" << std::endl;
     
     // Check for hierarchical format markers
     bool hasHierarchicalShapes = json.contains("hierarchicalShapes");
@@ -332,7 +333,7 @@ DocumentData parse_hierarchical_json(const std::string& json_content)
     
     if (hasHierarchicalShapes)
     {
-        std::cout << "Detected hierarchical format (single artboard)" << std::endl;
+        rive_converter::log_stream() << "Detected hierarchical format (single artboard)" << std::endl;
         
         // Single artboard with hierarchical shapes
         ArtboardData artboard;
@@ -343,14 +344,14 @@ DocumentData parse_hierarchical_json(const std::string& json_content)
         // Parse hierarchical shapes
         if (json["hierarchicalShapes"].is_array())
         {
-            std::cout << "Parsing " << json["hierarchicalShapes"].size() << " hierarchical shapes..." << std::endl;
+            rive_converter::log_stream() << "Parsing " << json["hierarchicalShapes"].size() << " hierarchical shapes..." << std::endl;
             
             for (const auto& shapeJson : json["hierarchicalShapes"])
             {
                 artboard.shapes.push_back(parse_hierarchical_shape(shapeJson));
             }
             
-            std::cout << "Parsed " << artboard.shapes.size() << " shapes" << std::endl;
+            rive_converter::log_stream() << "Parsed " << artboard.shapes.size() << " shapes" << std::endl;
         }
         
         // Parse animations
@@ -360,7 +361,7 @@ DocumentData parse_hierarchical_json(const std::string& json_content)
             {
                 artboard.animations.push_back(parse_animation(animJson));
             }
-            std::cout << "Parsed " << artboard.animations.size() << " animations" << std::endl;
+            rive_converter::log_stream() << "Parsed " << artboard.animations.size() << " animations" << std::endl;
         }
         
         // Parse state machines
@@ -370,7 +371,7 @@ DocumentData parse_hierarchical_json(const std::string& json_content)
             {
                 artboard.stateMachines.push_back(parse_state_machine(smJson));
             }
-            std::cout << "Parsed " << artboard.stateMachines.size() << " state machines" << std::endl;
+            rive_converter::log_stream() << "Parsed " << artboard.stateMachines.size() << " state machines" << std::endl;
         }
         
         // Parse bones
@@ -385,14 +386,14 @@ DocumentData parse_hierarchical_json(const std::string& json_content)
                 bone.length = boneJson.value("length", 0.0f);
                 artboard.bones.push_back(bone);
             }
-            std::cout << "Parsed " << artboard.bones.size() << " bones" << std::endl;
+            rive_converter::log_stream() << "Parsed " << artboard.bones.size() << " bones" << std::endl;
         }
         
         doc.artboards.push_back(artboard);
     }
     else if (hasArtboards)
     {
-        std::cout << "Detected hierarchical format (multiple artboards)" << std::endl;
+        rive_converter::log_stream() << "Detected hierarchical format (multiple artboards)" << std::endl;
         
         for (const auto& artboardJson : json["artboards"])
         {
@@ -401,14 +402,14 @@ DocumentData parse_hierarchical_json(const std::string& json_content)
     }
     else
     {
-        std::cout << "WARNING: No hierarchical format detected!" << std::endl;
+        rive_converter::log_stream() << "WARNING: No hierarchical format detected!" << std::endl;
     }
     
-    std::cout << "=== PARSE COMPLETE ===" << std::endl;
-    std::cout << "Artboards: " << doc.artboards.size() << std::endl;
+    rive_converter::log_stream() << "=== PARSE COMPLETE ===" << std::endl;
+    rive_converter::log_stream() << "Artboards: " << doc.artboards.size() << std::endl;
     if (!doc.artboards.empty())
     {
-        std::cout << "Shapes in first artboard: " << doc.artboards[0].shapes.size() << std::endl;
+        rive_converter::log_stream() << "Shapes in first artboard: " << doc.artboards[0].shapes.size() << std::endl;
     }
     
     return doc;
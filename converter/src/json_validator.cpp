@@ -1,32 +1,44 @@
 #include "json_validator.hpp"
 #include <iostream>
-#include <unordered_set>
 #include <unordered_map>
+#include <algorithm>
 
 namespace rive_converter
 {
 
+namespace
+{
+uint32_t localIdOf(const nlohmann::json& obj)
+{
+    auto it = obj.find("localId");
+    return it != obj.end() ? it->get<uint32_t>() : 0;
+}
+} // namespace
+
 ValidationResult JSONValidator::validate(const nlohmann::json& data)
 {
     ValidationResult result;
     
     // Check if artboards array exists
-    if (!data.contains("artboards") || !data["artboards"].is_array() || data["artboards"].empty()) {
+    auto artboards = data.find("artboards");
+    if (artboards == data.end() || !artboards->is_array() || artboards->empty()) {
         std::cerr << "❌ ERROR: No artboards array found" << std::endl;
         return result;
     }
     
-    auto& artboard = data["artboards"][0];
-    if (!artboard.contains("objects") || !artboard["objects"].is_array()) {
+    auto& artboard = (*artboards)[0];
+    auto objects = artboard.find("objects");
+    if (objects == artboard.end() || !objects->is_array()) {
         std::cerr << "❌ ERROR: No objects array in artboard" << std::endl;
         return result;
     }
     
-    result.totalObjects = artboard["objects"].size();
+    result.totalObjects = objects->size();
     
-    // Run all checks
-    checkParentReferences(data, result);
-    checkCycles(data, result);
+    // Run all checks, sharing one parent graph between the graph checks
+    ParentGraph graph = buildParentGraph(*objects);
+    reportMissingParents(*objects, graph, result);
+    findCycle(graph, result);
     checkRequiredProperties(data, result);
     
     result.validObjects = result.totalObjects - result.missingParents - result.missingRequiredProps.size();
@@ -34,93 +46,105 @@ ValidationResult JSONValidator::validate(const nlohmann::json& data)
     return result;
 }
 
-void JSONValidator::checkParentReferences(const nlohmann::json& data, ValidationResult& result)
+JSONValidator::ParentGraph JSONValidator::buildParentGraph(const nlohmann::json& objects)
 {
-    auto& objects = data["artboards"][0]["objects"];
+    ParentGraph graph;
+    size_t count = objects.size();
+    graph.localIds.assign(count, 0);
+    graph.parents.assign(count, ParentGraph::noParent);
+    graph.isNode.assign(count, false);
     
-    // Build set of all localIds
-    std::unordered_set<uint32_t> localIds;
-    for (auto& obj : objects) {
-        if (obj.contains("localId")) {
-            localIds.insert(obj["localId"].get<uint32_t>());
+    // Map each localId to the index of the last object using it
+    std::unordered_map<uint32_t, int32_t> indexOfId;
+    indexOfId.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        auto& obj = objects[i];
+        auto localId = obj.find("localId");
+        if (localId != obj.end()) {
+            indexOfId[localId->get<uint32_t>()] = static_cast<int32_t>(i);
         }
     }
     
-    // Check each parent reference
-    for (auto& obj : objects) {
-        if (obj.contains("parentId")) {
-            uint32_t parentId = obj["parentId"].get<uint32_t>();
-            if (localIds.find(parentId) == localIds.end()) {
-                result.missingParents++;
-                uint32_t childId = obj.contains("localId") ? obj["localId"].get<uint32_t>() : 0;
-                result.missingParentPairs.push_back({childId, parentId});
-            }
+    // Resolve every parent reference to an index once
+    for (size_t i = 0; i < count; i++) {
+        auto& obj = objects[i];
+        auto localId = obj.find("localId");
+        if (localId != obj.end()) {
+            graph.localIds[i] = localId->get<uint32_t>();
+            graph.isNode[i] = indexOfId[graph.localIds[i]] == static_cast<int32_t>(i);
         }
+        
+        auto parentId = obj.find("parentId");
+        if (parentId == obj.end()) continue;
+        
+        auto parent = indexOfId.find(parentId->get<uint32_t>());
+        graph.parents[i] = parent != indexOfId.end() ? parent->second : ParentGraph::missingParent;
     }
+    
+    return graph;
 }
 
-void JSONValidator::checkCycles(const nlohmann::json& data, ValidationResult& result)
+void JSONValidator::checkParentReferences(const nlohmann::json& data, ValidationResult& result)
 {
     auto& objects = data["artboards"][0]["objects"];
-    
-    // Build parent map
-    std::map<uint32_t, uint32_t> childToParent;
-    std::unordered_set<uint32_t> allNodes;
-    
-    for (auto& obj : objects) {
-        if (obj.contains("localId")) {
-            uint32_t localId = obj["localId"].get<uint32_t>();
-            allNodes.insert(localId);
-            
-            if (obj.contains("parentId")) {
-                uint32_t parentId = obj["parentId"].get<uint32_t>();
-                childToParent[localId] = parentId;
-            }
-        }
-    }
-    
-    // Check for cycles from each node
-    for (uint32_t node : allNodes) {
-        std::vector<uint32_t> cycle;
-        if (detectCycleFrom(node, childToParent, cycle)) {
-            result.hasCycles = true;
-            result.cycleNodes = cycle;
-            break; // Found one cycle, that's enough
-        }
+    reportMissingParents(objects, buildParentGraph(objects), result);
+}
+
+void JSONValidator::reportMissingParents(const nlohmann::json& objects,
+                                         const ParentGraph& graph,
+                                         ValidationResult& result)
+{
+    for (size_t i = 0; i < graph.parents.size(); i++) {
+        if (graph.parents[i] != ParentGraph::missingParent) continue;
+        
+        auto& obj = objects[i];
+        result.missingParents++;
+        result.missingParentPairs.push_back({graph.localIds[i], obj["parentId"].get<uint32_t>()});
     }
 }
 
-bool JSONValidator::detectCycleFrom(uint32_t start, 
-                                    const std::map<uint32_t, uint32_t>& childToParent,
-                                    std::vector<uint32_t>& cycle)
+void JSONValidator::checkCycles(const nlohmann::json& data, ValidationResult& result)
+{
+    findCycle(buildParentGraph(data["artboards"][0]["objects"]), result);
+}
+
+void JSONValidator::findCycle(const ParentGraph& graph, ValidationResult& result)
 {
-    std::unordered_set<uint32_t> visited;
-    std::vector<uint32_t> path;
-    uint32_t cur = start;
+    // Walk each chain of parents at most once: nodes on the current walk are
+    // marked onPath and every node we've finished with is marked done, so a
+    // walk reaching a done node can stop early and the whole check is linear
+    // in the number of objects.
+    enum class Mark : uint8_t { unvisited, onPath, done };
+    std::vector<Mark> marks(graph.parents.size(), Mark::unvisited);
+    std::vector<int32_t> path;
     
-    while (true) {
-        if (visited.count(cur)) {
-            // Cycle detected - extract cycle nodes
+    for (size_t start = 0; start < graph.parents.size(); start++) {
+        if (!graph.isNode[start] || marks[start] != Mark::unvisited) continue;
+        
+        path.clear();
+        int32_t cur = static_cast<int32_t>(start);
+        while (cur >= 0 && marks[cur] == Mark::unvisited) {
+            marks[cur] = Mark::onPath;
+            path.push_back(cur);
+            cur = graph.parents[cur];
+        }
+        
+        if (cur >= 0 && marks[cur] == Mark::onPath) {
+            // Cycle detected - report its nodes, closing with the first one
+            result.hasCycles = true;
             auto it = std::find(path.begin(), path.end(), cur);
-            if (it != path.end()) {
-                cycle.assign(it, path.end());
-                cycle.push_back(cur);
+            result.cycleNodes.clear();
+            for (; it != path.end(); ++it) {
+                result.cycleNodes.push_back(graph.localIds[*it]);
             }
-            return true;
+            result.cycleNodes.push_back(graph.localIds[cur]);
+            return; // Found one cycle, that's enough
         }
         
-        visited.insert(cur);
-        path.push_back(cur);
-        
-        auto parentIt = childToParent.find(cur);
-        if (parentIt == childToParent.end()) {
-            break; // No parent, end of chain
+        for (int32_t node : path) {
+            marks[node] = Mark::done;
         }
-        
-        cur = parentIt->second;
     }
-    
-    return false;
 }
 
 void JSONValidator::checkRequiredProperties(const nlohmann::json& data, ValidationResult& result)
@@ -128,50 +152,55 @@ void JSONValidator::checkRequiredProperties(const nlohmann::json& data, Validati
     auto& objects = data["artboards"][0]["objects"];
     
     for (auto& obj : objects) {
-        if (!obj.contains("typeKey")) continue;
+        auto typeKeyIt = obj.find("typeKey");
+        if (typeKeyIt == obj.end()) continue;
         
-        uint16_t typeKey = obj["typeKey"].get<uint16_t>();
+        uint16_t typeKey = typeKeyIt->get<uint16_t>();
         auto requiredProps = getRequiredProperties(typeKey);
         
-        if (requiredProps.empty()) continue; // No required properties for this type
+        if (requiredProps == nullptr) continue; // No required properties for this type
         
-        auto props = obj.value("properties", nlohmann::json::object());
-        bool hasMissing = false;
+        // Look the properties up in place rather than copying them
+        auto props = obj.find("properties");
+        bool hasMissing = props == obj.end() || !props->is_object();
         
-        for (auto& propName : requiredProps) {
-            if (!props.contains(propName)) {
-                hasMissing = true;
-                break;
-            }
+        for (size_t i = 0; !hasMissing && i < requiredProps->size(); i++) {
+            hasMissing = !props->contains((*requiredProps)[i]);
         }
         
         if (hasMissing) {
-            uint32_t localId = obj.contains("localId") ? obj["localId"].get<uint32_t>() : 0;
-            result.missingRequiredProps[typeKey].push_back(localId);
+            result.missingRequiredProps[typeKey].push_back(localIdOf(obj));
         }
     }
 }
 
-std::vector<std::string> JSONValidator::getRequiredProperties(uint16_t typeKey)
+const std::vector<std::string>* JSONValidator::getRequiredProperties(uint16_t typeKey)
 {
+    // Built once rather than for every object checked
+    static const std::vector<std::string> trimPath = {"start", "end", "offset", "modeValue"};
+    static const std::vector<std::string> feather = {"strength", "offsetX", "offsetY", "inner"};
+    static const std::vector<std::string> dash = {"length", "lengthIsPercentage"};
+    static const std::vector<std::string> dashPath = {"offset", "offsetIsPercentage"};
+    static const std::vector<std::string> gradientStop = {"colorValue", "position"};
+    
     switch (typeKey) {
         case 47: // TrimPath
-            return {"start", "end", "offset", "modeValue"};
+            return &trimPath;
         
         case 49: // Feather
-            return {"strength", "offsetX", "offsetY", "inner"};
+            return &feather;
         
         case 507: // Dash (DashBase::typeKey)
-            return {"length", "lengthIsPercentage"};
+            return &dash;
         
         case 506: // DashPath (DashPathBase::typeKey, NOT 46 which is CubicWeight)
-            return {"offset", "offsetIsPercentage"};
+            return &dashPath;
         
         case 19: // GradientStop
-            return {"colorValue", "position"};
+            return &gradientStop;
         
         default:
-            return {}; // No required properties or not tracked
+            return nullptr; // No required properties or not tracked
     }
 }
 
@@ -1,9 +1,26 @@
 #include "json_loader.hpp"
+#include "converter_log.hpp"
 #include "hierarchical_schema.hpp"
 #include "universal_builder.hpp"
+#include "optimizer.hpp"
+#include "riv_stream_writer.hpp"
 #include "serializer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
 #include <nlohmann/json.hpp>
 
 // Forward declaration
@@ -114,115 +131,440 @@ rive_converter::Document convert_hierarchical_to_document(const rive_hierarchica
     return doc;
 }
 
-int main(int argc, char** argv)
+struct ConvertOptions
+{
+    bool exact = false;
+    bool optimize = false;
+    rive_converter::OptimizeOptions optimizeOptions;
+};
+
+// Converts one JSON document to RIV bytes written to output. Throws on
+// malformed input.
+static void convert_json_to_riv(const std::string& jsonContent,
+                                const ConvertOptions& options,
+                                rive::BinaryStream& output)
 {
-    if (argc < 3)
+    // Detect JSON format
+    auto jsonParsed = nlohmann::json::parse(jsonContent);
+
+    bool isExactUniversal = jsonParsed.contains("__riv_exact__") &&
+                             jsonParsed["__riv_exact__"].is_boolean() &&
+                             jsonParsed["__riv_exact__"].get<bool>();
+
+    // Validate --exact flag usage
+    if (options.exact && !isExactUniversal)
     {
-        std::cerr << "Usage: rive_convert [--exact] <input.json> <output.riv>" << std::endl;
-        std::cerr << "Options:" << std::endl;
-        std::cerr << "  --exact    Enable exact round-trip mode (requires __riv_exact__ in JSON)" << std::endl;
-        return 1;
+        throw std::runtime_error("--exact flag requires JSON with __riv_exact__ = true");
     }
 
-    bool exactModeRequested = false;
-    int argOffset = 1;
-    
-    // Check for --exact flag
-    if (argc >= 4 && std::string(argv[1]) == "--exact")
+    // Warn if exact JSON used without --exact flag
+    if (isExactUniversal && !options.exact)
     {
-        exactModeRequested = true;
-        argOffset = 2;
+        std::cerr << "⚠️  Warning: Exact mode JSON detected. Consider using --exact flag for clarity." << std::endl;
     }
 
-    const std::string inputPath = argv[argOffset];
-    const std::string outputPath = argv[argOffset + 1];
+    // Check for universal format (objects array with typeKey)
+    bool isUniversal = isExactUniversal || (
+        jsonParsed.contains("artboards") &&
+        jsonParsed["artboards"].is_array() &&
+        !jsonParsed["artboards"].empty() &&
+        jsonParsed["artboards"][0].contains("objects") &&
+        jsonParsed["artboards"][0]["objects"].is_array() &&
+        !jsonParsed["artboards"][0]["objects"].empty() &&
+        jsonParsed["artboards"][0]["objects"][0].contains("typeKey"));
 
-    std::ifstream inputFile(inputPath);
+    // Check for hierarchical format
+    bool isHierarchical = jsonParsed.contains("hierarchicalShapes") ||
+                         (jsonParsed.contains("artboards") &&
+                          jsonParsed["artboards"].is_array() &&
+                          !jsonParsed["artboards"].empty() &&
+                          jsonParsed["artboards"][0].contains("hierarchicalShapes"));
+
+    if (isUniversal)
+    {
+        if (isExactUniversal)
+        {
+            rive_converter::log_stream() << "🌟 Detected UNIVERSAL exact stream - performing raw serialization" << std::endl;
+            rive_converter::write_exact_riv_json(jsonParsed, output);
+            return;
+        }
+        rive_converter::log_stream() << "🌟 Detected UNIVERSAL format - using universal builder!" << std::endl;
+        rive_converter::PropertyTypeMap typeMap;
+        auto coreDoc = rive_converter::build_from_universal_json(jsonParsed, typeMap);
+        if (options.optimize)
+        {
+            auto report = rive_converter::optimize_core_document(coreDoc, typeMap, options.optimizeOptions);
+            rive_converter::print_optimize_report(report);
+        }
+        rive_converter::write_core_document(coreDoc, typeMap, output);
+        return;
+    }
+    if (isHierarchical)
+    {
+        rive_converter::log_stream() << "🎯 Detected HIERARCHICAL format - using exact copy pipeline!" << std::endl;
+        auto hierarchicalDoc = rive_hierarchical::parse_hierarchical_json(jsonContent);
+        auto document = convert_hierarchical_to_document(hierarchicalDoc);
+        rive_converter::write_minimal_riv(document, output);
+        return;
+    }
+    rive_converter::log_stream() << "📝 Detected LEGACY format - using legacy pipeline" << std::endl;
+    auto document = rive_converter::parse_json(jsonContent);
+    rive_converter::write_minimal_riv(document, output);
+}
+
+static std::string read_file(const std::string& path)
+{
+    std::ifstream inputFile(path);
     if (!inputFile.is_open())
     {
-        std::cerr << "Failed to open input file: " << inputPath << std::endl;
-        return 1;
+        throw std::runtime_error("Failed to open input file: " + path);
     }
+    return std::string((std::istreambuf_iterator<char>(inputFile)),
+                       std::istreambuf_iterator<char>());
+}
 
-    std::string jsonContent((std::istreambuf_iterator<char>(inputFile)),
-                            std::istreambuf_iterator<char>());
+// Converts jsonContent straight into the file at outputPath, so the output
+// is never held in memory as a whole. Progress messages go to log. Returns
+// the number of bytes written. On failure the partial output file is
+// removed and the error rethrown.
+static size_t convert_json_to_file(const std::string& jsonContent,
+                                   const ConvertOptions& options,
+                                   const std::string& outputPath,
+                                   std::ostream& log)
+{
+    rive_converter::ScopedLogStream scopedLog(log);
+    FILE* file = std::fopen(outputPath.c_str(), "wb");
+    if (file == nullptr)
+    {
+        throw std::runtime_error("Failed to open output file: " + outputPath);
+    }
 
+    size_t bytes = 0;
     try
     {
-        rive_converter::Document document;
-        
-        // Detect JSON format
-        auto jsonParsed = nlohmann::json::parse(jsonContent);
+        rive_converter::RivStreamWriter stream(rive_converter::file_sink(file));
+        convert_json_to_riv(jsonContent, options, stream);
+        stream.flush();
+        if (stream.failed())
+        {
+            throw std::runtime_error("Failed to write output file: " + outputPath);
+        }
+        bytes = stream.bytesWritten();
+    }
+    catch (...)
+    {
+        std::fclose(file);
+        std::remove(outputPath.c_str());
+        throw;
+    }
+    if (std::fclose(file) != 0)
+    {
+        std::remove(outputPath.c_str());
+        throw std::runtime_error("Failed to write output file: " + outputPath);
+    }
+    return bytes;
+}
 
-        bool isExactUniversal = jsonParsed.contains("__riv_exact__") &&
-                                 jsonParsed["__riv_exact__"].is_boolean() &&
-                                 jsonParsed["__riv_exact__"].get<bool>();
-        
-        // Validate --exact flag usage
-        if (exactModeRequested && !isExactUniversal)
+struct BatchJob
+{
+    std::string inputPath;
+    std::string outputPath;
+};
+
+struct BatchResult
+{
+    bool ok = false;
+    size_t bytes = 0;
+    double seconds = 0.0;
+    std::string error;
+};
+
+// Collects jobs from either a directory (every *.json in it) or a manifest
+// with one "input.json [output.riv]" entry per line. Relative manifest paths
+// are relative to the manifest's directory. Outputs without an explicit path
+// go to outputDir with the input's stem. Throws if two jobs would write the
+// same output file.
+static std::vector<BatchJob> collect_batch_jobs(const std::string& source,
+                                                const std::string& outputDir)
+{
+    namespace fs = std::filesystem;
+    std::vector<BatchJob> jobs;
+    auto defaultOutput = [&](const fs::path& input) {
+        return (fs::path(outputDir) / input.stem()).string() + ".riv";
+    };
+
+    if (fs::is_directory(source))
+    {
+        for (const auto& entry : fs::directory_iterator(source))
         {
-            std::cerr << "❌ Error: --exact flag requires JSON with __riv_exact__ = true" << std::endl;
-            return 1;
+            if (entry.is_regular_file() && entry.path().extension() == ".json")
+            {
+                jobs.push_back({entry.path().string(), defaultOutput(entry.path())});
+            }
         }
-        
-        // Warn if exact JSON used without --exact flag
-        if (isExactUniversal && !exactModeRequested)
+        std::sort(jobs.begin(), jobs.end(), [](const BatchJob& a, const BatchJob& b) {
+            return a.inputPath < b.inputPath;
+        });
+    }
+    else
+    {
+        fs::path manifestDir = fs::path(source).parent_path();
+        std::istringstream manifest(read_file(source));
+        std::string line;
+        while (std::getline(manifest, line))
         {
-            std::cerr << "⚠️  Warning: Exact mode JSON detected. Consider using --exact flag for clarity." << std::endl;
+            std::istringstream fields(line);
+            std::string input, output;
+            if (!(fields >> input) || input[0] == '#')
+            {
+                continue;
+            }
+            fs::path inputPath = manifestDir / input;
+            jobs.push_back({inputPath.string(),
+                            (fields >> output) ? (manifestDir / output).string()
+                                               : defaultOutput(inputPath)});
         }
-        
-        // Check for universal format (objects array with typeKey)
-        bool isUniversal = isExactUniversal || (
-            jsonParsed.contains("artboards") && 
-            jsonParsed["artboards"].is_array() &&
-            !jsonParsed["artboards"].empty() &&
-            jsonParsed["artboards"][0].contains("objects") &&
-            jsonParsed["artboards"][0]["objects"].is_array() &&
-            !jsonParsed["artboards"][0]["objects"].empty() &&
-            jsonParsed["artboards"][0]["objects"][0].contains("typeKey"));
-        
-        // Check for hierarchical format
-        bool isHierarchical = jsonParsed.contains("hierarchicalShapes") || 
-                             (jsonParsed.contains("artboards") && 
-                              jsonParsed["artboards"].is_array() &&
-                              !jsonParsed["artboards"].empty() &&
-                              jsonParsed["artboards"][0].contains("hierarchicalShapes"));
-        
-        std::vector<uint8_t> bytes;
-        
-        if (isUniversal)
+    }
+
+    std::map<fs::path, const BatchJob*> outputs;
+    for (const auto& job : jobs)
+    {
+        auto key = fs::absolute(job.outputPath).lexically_normal();
+        auto [existing, inserted] = outputs.emplace(key, &job);
+        if (!inserted)
+        {
+            throw std::runtime_error("Duplicate output path " + job.outputPath + " for " +
+                                     existing->second->inputPath + " and " + job.inputPath);
+        }
+    }
+    return jobs;
+}
+
+// Converts every job on a pool of worker threads. Each file is converted
+// independently, so a failure only affects its own output. The builders'
+// progress logging is muted on the workers; each file reports a single line
+// instead.
+static int run_batch(const std::vector<BatchJob>& jobs,
+                     const ConvertOptions& options,
+                     unsigned int jobCount)
+{
+    using clock = std::chrono::steady_clock;
+
+    std::vector<BatchResult> results(jobs.size());
+    std::atomic<size_t> nextJob{0};
+    std::mutex logMutex;
+
+    auto worker = [&]() {
+        // A stream without a buffer discards everything written to it.
+        std::ostream quiet(nullptr);
+        for (size_t index = nextJob++; index < jobs.size(); index = nextJob++)
         {
-            if (isExactUniversal)
+            const auto& job = jobs[index];
+            auto& result = results[index];
+            auto start = clock::now();
+            try
+            {
+                result.bytes =
+                    convert_json_to_file(read_file(job.inputPath), options, job.outputPath, quiet);
+                result.ok = true;
+            }
+            catch (const std::exception& e)
+            {
+                result.error = e.what();
+            }
+            catch (...)
             {
-                std::cout << "🌟 Detected UNIVERSAL exact stream - performing raw serialization" << std::endl;
-                bytes = rive_converter::serialize_exact_riv_json(jsonParsed);
+                result.error = "unknown error";
+            }
+            result.seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+            std::lock_guard<std::mutex> lock(logMutex);
+            if (result.ok)
+            {
+                std::cout << "✅ " << job.inputPath << " -> " << job.outputPath << " ("
+                          << result.bytes << " bytes, " << result.seconds * 1e3 << " ms)" << std::endl;
             }
             else
             {
-                std::cout << "🌟 Detected UNIVERSAL format - using universal builder!" << std::endl;
-                rive_converter::PropertyTypeMap typeMap;
-                auto coreDoc = rive_converter::build_from_universal_json(jsonParsed, typeMap);
-                bytes = rive_converter::serialize_core_document(coreDoc, typeMap);
+                std::cout << "❌ " << job.inputPath << ": " << result.error << " ("
+                          << result.seconds * 1e3 << " ms)" << std::endl;
+            }
+        }
+    };
+
+    auto start = clock::now();
+    std::vector<std::thread> threads;
+    jobCount = std::max(1u, std::min<unsigned int>(jobCount, static_cast<unsigned int>(jobs.size())));
+    for (unsigned int i = 1; i < jobCount; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    double wallSeconds = std::chrono::duration<double>(clock::now() - start).count();
+
+    size_t failed = 0;
+    double convertSeconds = 0.0;
+    size_t slowest = 0;
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        failed += results[i].ok ? 0 : 1;
+        convertSeconds += results[i].seconds;
+        if (results[i].seconds > results[slowest].seconds)
+        {
+            slowest = i;
+        }
+    }
+    std::cout << "\n=== Batch summary ===" << std::endl;
+    std::cout << "  files:     " << jobs.size() << " (" << jobs.size() - failed << " ok, " << failed
+              << " failed)" << std::endl;
+    std::cout << "  jobs:      " << jobCount << std::endl;
+    std::cout << "  wall time: " << wallSeconds * 1e3 << " ms (" << convertSeconds * 1e3
+              << " ms of conversion)" << std::endl;
+    if (!jobs.empty())
+    {
+        std::cout << "  slowest:   " << jobs[slowest].inputPath << " (" << results[slowest].seconds * 1e3
+                  << " ms)" << std::endl;
+    }
+    if (failed != 0)
+    {
+        std::cout << "  failed:" << std::endl;
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            if (!results[i].ok)
+            {
+                std::cout << "    " << jobs[i].inputPath << ": " << results[i].error << std::endl;
+            }
+        }
+    }
+    return failed == 0 ? 0 : 1;
+}
+
+static void print_usage()
+{
+    std::cerr << "Usage: rive_convert [--exact] [--optimize] <input.json> <output.riv>" << std::endl;
+    std::cerr << "       rive_convert --batch <manifest|directory> [--jobs N] <output_dir>" << std::endl;
+    std::cerr << "Options:" << std::endl;
+    std::cerr << "  --exact             Enable exact round-trip mode (requires __riv_exact__ in JSON)" << std::endl;
+    std::cerr << "  --optimize          Run the optimizer passes on universal JSON input" << std::endl;
+    std::cerr << "  --tolerance <v>     Keyframe reduction tolerance (default 1e-4)" << std::endl;
+    std::cerr << "  --quantize <step>   Round float properties to multiples of step" << std::endl;
+    std::cerr << "  --batch <source>    Convert every *.json in a directory, or each" << std::endl;
+    std::cerr << "                      \"input.json [output.riv]\" line of a manifest" << std::endl;
+    std::cerr << "  --jobs, -j <N>      Files converted concurrently in batch mode" << std::endl;
+    std::cerr << "                      (default: hardware threads)" << std::endl;
+}
+
+// Parses a whole command line value, rejecting trailing garbage so that
+// "--jobs 4x" is reported rather than silently read as 4. Floats must be
+// finite and positive; allowZero also accepts 0, for options where 0 turns
+// the feature off.
+static bool parse_float_arg(const char* text, float& value, bool allowZero = false)
+{
+    char* end = nullptr;
+    errno = 0;
+    float parsed = std::strtof(text, &end);
+    if (end == text || *end != '\0' || errno == ERANGE || !std::isfinite(parsed) ||
+        parsed < 0.0f || (parsed == 0.0f && !allowZero))
+    {
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+static bool parse_count_arg(const char* text, unsigned int& value)
+{
+    char* end = nullptr;
+    errno = 0;
+    unsigned long parsed = std::strtoul(text, &end, 10);
+    if (end == text || *end != '\0' || errno == ERANGE || text[0] == '-' || parsed == 0 ||
+        parsed > std::numeric_limits<unsigned int>::max())
+    {
+        return false;
+    }
+    value = static_cast<unsigned int>(parsed);
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    ConvertOptions options;
+    std::string batchSource;
+    unsigned int jobCount = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::string> positional;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--exact")
+        {
+            options.exact = true;
+        }
+        else if (arg == "--optimize")
+        {
+            options.optimize = true;
+        }
+        else if (arg == "--tolerance" && i + 1 < argc)
+        {
+            if (!parse_float_arg(argv[++i], options.optimizeOptions.keyFrameTolerance))
+            {
+                std::cerr << "Invalid value for " << arg << ": " << argv[i] << std::endl;
+                print_usage();
+                return 1;
             }
         }
-        else if (isHierarchical)
+        else if (arg == "--quantize" && i + 1 < argc)
         {
-            std::cout << "🎯 Detected HIERARCHICAL format - using exact copy pipeline!" << std::endl;
-            auto hierarchicalDoc = rive_hierarchical::parse_hierarchical_json(jsonContent);
-            document = convert_hierarchical_to_document(hierarchicalDoc);
-            bytes = rive_converter::serialize_minimal_riv(document);
+            if (!parse_float_arg(argv[++i], options.optimizeOptions.quantizeStep,
+                                 /*allowZero=*/true))
+            {
+                std::cerr << "Invalid value for " << arg << ": " << argv[i] << std::endl;
+                print_usage();
+                return 1;
+            }
+        }
+        else if (arg == "--batch" && i + 1 < argc)
+        {
+            batchSource = argv[++i];
+        }
+        else if ((arg == "--jobs" || arg == "-j") && i + 1 < argc)
+        {
+            if (!parse_count_arg(argv[++i], jobCount))
+            {
+                std::cerr << "Invalid value for " << arg << ": " << argv[i] << std::endl;
+                print_usage();
+                return 1;
+            }
         }
         else
         {
-            std::cout << "📝 Detected LEGACY format - using legacy pipeline" << std::endl;
-            document = rive_converter::parse_json(jsonContent);
-            bytes = rive_converter::serialize_minimal_riv(document);
+            positional.push_back(arg);
+        }
+    }
+
+    bool batch = !batchSource.empty();
+    if (batch ? positional.size() != 1 : positional.size() != 2)
+    {
+        print_usage();
+        return 1;
+    }
+
+    try
+    {
+        if (batch)
+        {
+            std::filesystem::create_directories(positional[0]);
+            auto jobs = collect_batch_jobs(batchSource, positional[0]);
+            return run_batch(jobs, options, jobCount);
         }
 
-        std::ofstream outputFile(outputPath, std::ios::binary);
-        outputFile.write(reinterpret_cast<const char*>(bytes.data()),
-                         bytes.size());
-        std::cout << "✅ Wrote RIV file: " << outputPath << " (" << bytes.size()
+        const std::string& inputPath = positional[0];
+        const std::string& outputPath = positional[1];
+        size_t bytes = convert_json_to_file(read_file(inputPath), options, outputPath, std::cout);
+        std::cout << "✅ Wrote RIV file: " << outputPath << " (" << bytes
                   << " bytes)" << std::endl;
     }
     catch (const std::exception& e)
@@ -0,0 +1,756 @@
+#include "optimizer.hpp"
+#include "converter_log.hpp"
+
+#include "rive/core/field_types/core_color_type.hpp"
+#include "rive/core/field_types/core_double_type.hpp"
+#include "rive/generated/animation/cubic_ease_interpolator_base.hpp"
+#include "rive/generated/animation/cubic_value_interpolator_base.hpp"
+#include "rive/generated/animation/elastic_interpolator_base.hpp"
+#include "rive/generated/animation/interpolating_keyframe_base.hpp"
+#include "rive/generated/animation/keyed_object_base.hpp"
+#include "rive/generated/animation/keyed_property_base.hpp"
+#include "rive/generated/animation/keyframe_base.hpp"
+#include "rive/generated/animation/keyframe_bool_base.hpp"
+#include "rive/generated/animation/keyframe_callback_base.hpp"
+#include "rive/generated/animation/keyframe_color_base.hpp"
+#include "rive/generated/animation/keyframe_double_base.hpp"
+#include "rive/generated/animation/keyframe_id_base.hpp"
+#include "rive/generated/animation/keyframe_string_base.hpp"
+#include "rive/generated/animation/keyframe_uint_base.hpp"
+#include "rive/generated/animation/listener_align_target_base.hpp"
+#include "rive/generated/animation/state_machine_listener_base.hpp"
+#include "rive/generated/animation/state_transition_base.hpp"
+#include "rive/generated/bones/tendon_base.hpp"
+#include "rive/generated/constraints/scrolling/scroll_bar_constraint_base.hpp"
+#include "rive/generated/constraints/scrolling/scroll_constraint_base.hpp"
+#include "rive/generated/constraints/targeted_constraint_base.hpp"
+#include "rive/generated/data_bind/converters/data_converter_interpolator_base.hpp"
+#include "rive/generated/data_bind/converters/data_converter_range_mapper_base.hpp"
+#include "rive/generated/draw_rules_base.hpp"
+#include "rive/generated/draw_target_base.hpp"
+#include "rive/generated/joystick_base.hpp"
+#include "rive/generated/layout/layout_component_style_base.hpp"
+#include "rive/generated/layout_component_base.hpp"
+#include "rive/generated/shapes/clipping_shape_base.hpp"
+#include "rive/generated/shapes/paint/gradient_stop_base.hpp"
+#include "rive/generated/solo_base.hpp"
+#include "rive/generated/text/text_modifier_range_base.hpp"
+#include "rive/generated/text/text_style_base.hpp"
+#include "rive/generated/text/text_target_modifier_base.hpp"
+#include "rive/generated/text/text_value_run_base.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace rive;
+
+namespace rive_converter
+{
+namespace
+{
+// Properties that hold the id of an interpolator. Like the other reference
+// properties they hold builder ids until serialization.
+const uint16_t kInterpolatorReferenceKeys[] = {
+    InterpolatingKeyFrameBase::interpolatorIdPropertyKey,
+    StateTransitionBase::interpolatorIdPropertyKey,
+    LayoutComponentStyleBase::interpolatorIdPropertyKey,
+    DataConverterRangeMapperBase::interpolatorIdPropertyKey,
+    DataConverterInterpolatorBase::interpolatorIdPropertyKey,
+};
+
+// Properties that hold the id of another object in the document.
+const uint16_t kReferenceKeys[] = {
+    KeyedObjectBase::objectIdPropertyKey,
+    ClippingShapeBase::sourceIdPropertyKey,
+    TendonBase::boneIdPropertyKey,
+    DrawTargetBase::drawableIdPropertyKey,
+    DrawRulesBase::drawTargetIdPropertyKey,
+    TargetedConstraintBase::targetIdPropertyKey,
+    StateMachineListenerBase::targetIdPropertyKey,
+    ListenerAlignTargetBase::targetIdPropertyKey,
+    TextValueRunBase::styleIdPropertyKey,
+    TextStyleBase::fontAssetIdPropertyKey,
+    SoloBase::activeComponentIdPropertyKey,
+    JoystickBase::handleSourceIdPropertyKey,
+    TextModifierRangeBase::runIdPropertyKey,
+    LayoutComponentBase::styleIdPropertyKey,
+    ScrollBarConstraintBase::scrollConstraintIdPropertyKey,
+    ScrollConstraintBase::physicsIdPropertyKey,
+    TextTargetModifierBase::targetIdPropertyKey,
+};
+const uint16_t kComponentIdKey = 3;
+const uint16_t kParentIdKey = ComponentBase::parentIdPropertyKey;
+
+bool isInterpolatorReferenceKey(uint16_t key)
+{
+    return std::find(std::begin(kInterpolatorReferenceKeys),
+                     std::end(kInterpolatorReferenceKeys),
+                     key) != std::end(kInterpolatorReferenceKeys);
+}
+
+bool isReferenceKey(uint16_t key)
+{
+    return isInterpolatorReferenceKey(key) ||
+           std::find(std::begin(kReferenceKeys), std::end(kReferenceKeys), key) !=
+               std::end(kReferenceKeys);
+}
+
+bool isKeyFrame(uint16_t typeKey)
+{
+    switch (typeKey)
+    {
+        case KeyFrameDoubleBase::typeKey:
+        case KeyFrameColorBase::typeKey:
+        case KeyFrameIdBase::typeKey:
+        case KeyFrameBoolBase::typeKey:
+        case KeyFrameStringBase::typeKey:
+        case KeyFrameUintBase::typeKey:
+        case KeyFrameCallbackBase::typeKey:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool isInterpolator(const CoreObject& object)
+{
+    if (object.isComponent)
+    {
+        return false;
+    }
+    switch (object.typeKey)
+    {
+        case CubicEaseInterpolatorBase::typeKey:
+        case CubicValueInterpolatorBase::typeKey:
+        case ElasticInterpolatorBase::typeKey:
+            return true;
+        default:
+            return false;
+    }
+}
+
+const Property* findProperty(const CoreObject& object, uint16_t key)
+{
+    for (const auto& property : object.properties)
+    {
+        if (property.key == key)
+        {
+            return &property;
+        }
+    }
+    return nullptr;
+}
+
+float floatProperty(const CoreObject& object, uint16_t key, float fallback)
+{
+    auto property = findProperty(object, key);
+    if (property == nullptr)
+    {
+        return fallback;
+    }
+    if (auto p = std::get_if<float>(&property->value))
+    {
+        return *p;
+    }
+    if (auto p = std::get_if<uint32_t>(&property->value))
+    {
+        return static_cast<float>(*p);
+    }
+    return fallback;
+}
+
+uint32_t uintProperty(const CoreObject& object, uint16_t key, uint32_t fallback)
+{
+    auto property = findProperty(object, key);
+    if (property == nullptr)
+    {
+        return fallback;
+    }
+    if (auto p = std::get_if<uint32_t>(&property->value))
+    {
+        return *p;
+    }
+    if (auto p = std::get_if<bool>(&property->value))
+    {
+        return *p ? 1u : 0u;
+    }
+    return fallback;
+}
+
+size_t varUintSize(uint64_t value)
+{
+    size_t size = 1;
+    while (value >= 0x80)
+    {
+        value >>= 7;
+        size++;
+    }
+    return size;
+}
+
+size_t propertyBytes(const Property& property, const PropertyTypeMap& typeMap)
+{
+    size_t size = varUintSize(property.key);
+    if (std::holds_alternative<float>(property.value))
+    {
+        return size + 4;
+    }
+    if (auto p = std::get_if<uint32_t>(&property.value))
+    {
+        auto itr = typeMap.find(property.key);
+        if (itr != typeMap.end() && (itr->second == CoreColorType::id ||
+                                     itr->second == CoreDoubleType::id))
+        {
+            return size + 4;
+        }
+        return size + varUintSize(*p);
+    }
+    if (auto p = std::get_if<std::string>(&property.value))
+    {
+        return size + varUintSize(p->size()) + p->size();
+    }
+    if (auto p = std::get_if<std::vector<uint8_t>>(&property.value))
+    {
+        return size + varUintSize(p->size()) + p->size();
+    }
+    return size + 1;
+}
+
+bool sameProperties(const CoreObject& a, const CoreObject& b)
+{
+    if (a.typeKey != b.typeKey || a.properties.size() != b.properties.size())
+    {
+        return false;
+    }
+    auto sorted = [](const CoreObject& object) {
+        std::vector<const Property*> properties;
+        for (const auto& property : object.properties)
+        {
+            properties.push_back(&property);
+        }
+        std::stable_sort(properties.begin(),
+                         properties.end(),
+                         [](const Property* l, const Property* r) {
+                             return l->key < r->key;
+                         });
+        return properties;
+    };
+    auto left = sorted(a);
+    auto right = sorted(b);
+    for (size_t i = 0; i < left.size(); i++)
+    {
+        if (left[i]->key != right[i]->key || left[i]->value != right[i]->value)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Ids referenced by other objects, either as a parent or through one of the
+// reference properties.
+std::unordered_set<uint32_t> referencedIds(const CoreDocument& document)
+{
+    std::unordered_set<uint32_t> ids;
+    for (const auto& object : document.objects)
+    {
+        if (object.parentId != 0)
+        {
+            ids.insert(object.parentId);
+        }
+        for (const auto& property : object.properties)
+        {
+            if (!isReferenceKey(property.key))
+            {
+                continue;
+            }
+            if (auto p = std::get_if<uint32_t>(&property.value))
+            {
+                ids.insert(*p);
+            }
+        }
+    }
+    return ids;
+}
+
+void eraseRemoved(CoreDocument& document, const std::vector<bool>& removed)
+{
+    size_t write = 0;
+    for (size_t read = 0; read < document.objects.size(); read++)
+    {
+        if (removed[read])
+        {
+            continue;
+        }
+        if (write != read)
+        {
+            document.objects[write] = std::move(document.objects[read]);
+        }
+        write++;
+    }
+    document.objects.resize(write);
+}
+
+struct KeyFrameSample
+{
+    size_t index;
+    float frame;
+    float value;
+    uint32_t interpolationType;
+    // Type key of the interpolator, 0 if there is none.
+    uint16_t interpolator;
+};
+
+// Whether the segment starting at this keyframe interpolates linearly.
+bool isLinear(const KeyFrameSample& sample)
+{
+    return sample.interpolationType != 0 && sample.interpolator == 0;
+}
+
+// Whether the segment starting at this keyframe stays constant when both of
+// its ends have the same value. Hold, linear and easing interpolators (which
+// only remap time) do; CubicValueInterpolator has its own control values.
+bool isConstantPreserving(const KeyFrameSample& sample)
+{
+    return sample.interpolationType == 0 || sample.interpolator == 0 ||
+           sample.interpolator == CubicEaseInterpolatorBase::typeKey ||
+           sample.interpolator == ElasticInterpolatorBase::typeKey;
+}
+
+// Whether dropping the keyframes strictly between from and to keeps the
+// animation within tolerance, accumulating the error into maxError.
+bool canBridge(const std::vector<KeyFrameSample>& samples,
+               size_t from,
+               size_t to,
+               float tolerance,
+               float* maxError)
+{
+    const auto& start = samples[from];
+    const auto& end = samples[to];
+
+    // Hold stretch: the start value is held until end regardless of what
+    // end does.
+    bool held = true;
+    for (size_t i = from; i < to && held; i++)
+    {
+        held = samples[i].interpolationType == 0 &&
+               std::abs(samples[i].value - start.value) <= tolerance;
+    }
+
+    // Constant stretch: every segment interpolates between equal values.
+    bool constant = !held;
+    for (size_t i = from; i <= to && constant; i++)
+    {
+        constant = std::abs(samples[i].value - start.value) <= tolerance &&
+                   (i == to || isConstantPreserving(samples[i]));
+    }
+    if (held || constant)
+    {
+        float error = 0.0f;
+        for (size_t i = from + 1; i < to; i++)
+        {
+            error = std::max(error, std::abs(samples[i].value - start.value));
+        }
+        *maxError = std::max(*maxError, error);
+        return true;
+    }
+
+    // Linear stretch: piecewise linear segments that a single line from
+    // start to end reproduces. The difference between two piecewise linear
+    // curves peaks at a vertex, so checking the dropped keyframes suffices.
+    float span = end.frame - start.frame;
+    if (span <= 0.0f)
+    {
+        return false;
+    }
+    float error = 0.0f;
+    for (size_t i = from; i < to; i++)
+    {
+        if (!isLinear(samples[i]))
+        {
+            return false;
+        }
+        if (i == from)
+        {
+            continue;
+        }
+        float t = (samples[i].frame - start.frame) / span;
+        float expected = start.value + (end.value - start.value) * t;
+        error = std::max(error, std::abs(samples[i].value - expected));
+        if (error > tolerance)
+        {
+            return false;
+        }
+    }
+    *maxError = std::max(*maxError, error);
+    return true;
+}
+
+void reduceKeyFrames(CoreDocument& document,
+                     float tolerance,
+                     OptimizePassReport& report)
+{
+    std::unordered_map<uint32_t, uint16_t> interpolatorTypes;
+    for (const auto& object : document.objects)
+    {
+        if (isInterpolator(object))
+        {
+            interpolatorTypes[object.id] = object.typeKey;
+        }
+    }
+
+    std::vector<bool> removed(document.objects.size(), false);
+    std::vector<KeyFrameSample> samples;
+    size_t i = 0;
+    while (i < document.objects.size())
+    {
+        if (document.objects[i].typeKey != KeyedPropertyBase::typeKey)
+        {
+            i++;
+            continue;
+        }
+        // Keyframes follow their KeyedProperty in the stream.
+        size_t first = ++i;
+        bool allDouble = true;
+        while (i < document.objects.size() &&
+               isKeyFrame(document.objects[i].typeKey))
+        {
+            allDouble = allDouble && document.objects[i].typeKey ==
+                                         KeyFrameDoubleBase::typeKey;
+            i++;
+        }
+        if (!allDouble || i - first < 3)
+        {
+            continue;
+        }
+
+        samples.clear();
+        for (size_t k = first; k < i; k++)
+        {
+            const auto& object = document.objects[k];
+            KeyFrameSample sample;
+            sample.index = k;
+            sample.frame = static_cast<float>(
+                uintProperty(object, KeyFrameBase::framePropertyKey, 0));
+            sample.value = floatProperty(object,
+                                         KeyFrameDoubleBase::valuePropertyKey,
+                                         0.0f);
+            sample.interpolationType = uintProperty(
+                object,
+                InterpolatingKeyFrameBase::interpolationTypePropertyKey,
+                0);
+            sample.interpolator = 0;
+            auto interpolatorId = findProperty(
+                object,
+                InterpolatingKeyFrameBase::interpolatorIdPropertyKey);
+            if (interpolatorId != nullptr)
+            {
+                auto id = std::get_if<uint32_t>(&interpolatorId->value);
+                auto itr = id == nullptr ? interpolatorTypes.end()
+                                         : interpolatorTypes.find(*id);
+                // Unknown interpolators are treated as value interpolators
+                // so they are never bridged.
+                sample.interpolator = itr == interpolatorTypes.end()
+                                          ? CubicValueInterpolatorBase::typeKey
+                                          : itr->second;
+            }
+            samples.push_back(sample);
+        }
+
+        // Greedily extend each kept keyframe as far as the tolerance allows.
+        size_t anchor = 0;
+        while (anchor + 1 < samples.size())
+        {
+            size_t next = anchor + 1;
+            while (next + 1 < samples.size() &&
+                   canBridge(samples, anchor, next + 1, tolerance, &report.maxError))
+            {
+                next++;
+            }
+            for (size_t k = anchor + 1; k < next; k++)
+            {
+                removed[samples[k].index] = true;
+                report.changed++;
+            }
+            anchor = next;
+        }
+    }
+    eraseRemoved(document, removed);
+}
+
+void mergeInterpolators(CoreDocument& document, OptimizePassReport& report)
+{
+    // Keyframes resolve interpolators against their artboard, so only merge
+    // within one.
+    std::unordered_map<uint32_t, uint32_t> replacements;
+    std::vector<const CoreObject*> unique;
+    for (const auto& object : document.objects)
+    {
+        if (object.isArtboard)
+        {
+            unique.clear();
+        }
+        if (!isInterpolator(object))
+        {
+            continue;
+        }
+        auto itr = std::find_if(unique.begin(),
+                                unique.end(),
+                                [&](const CoreObject* other) {
+                                    return sameProperties(*other, object);
+                                });
+        if (itr == unique.end())
+        {
+            unique.push_back(&object);
+        }
+        else
+        {
+            replacements[object.id] = (*itr)->id;
+        }
+    }
+    if (replacements.empty())
+    {
+        return;
+    }
+
+    std::vector<bool> removed(document.objects.size(), false);
+    for (size_t i = 0; i < document.objects.size(); i++)
+    {
+        auto& object = document.objects[i];
+        if (replacements.count(object.id) != 0 && isInterpolator(object))
+        {
+            removed[i] = true;
+            report.changed++;
+            continue;
+        }
+        for (auto& property : object.properties)
+        {
+            if (!isInterpolatorReferenceKey(property.key))
+            {
+                continue;
+            }
+            auto id = std::get_if<uint32_t>(&property.value);
+            if (id == nullptr)
+            {
+                continue;
+            }
+            auto itr = replacements.find(*id);
+            if (itr != replacements.end())
+            {
+                property.value = itr->second;
+                report.changed++;
+            }
+        }
+    }
+    eraseRemoved(document, removed);
+}
+
+void dedupeGradientStops(CoreDocument& document, OptimizePassReport& report)
+{
+    auto referenced = referencedIds(document);
+    std::map<std::pair<uint32_t, std::pair<uint32_t, float>>, uint32_t> seen;
+    std::vector<bool> removed(document.objects.size(), false);
+    for (size_t i = 0; i < document.objects.size(); i++)
+    {
+        const auto& object = document.objects[i];
+        if (object.typeKey != GradientStopBase::typeKey || object.parentId == 0)
+        {
+            continue;
+        }
+        auto key = std::make_pair(
+            object.parentId,
+            std::make_pair(
+                uintProperty(object, GradientStopBase::colorValuePropertyKey, 0xFFFFFFFF),
+                floatProperty(object, GradientStopBase::positionPropertyKey, 0.0f)));
+        // A stop that is animated (or otherwise referenced) has to stay.
+        if (!seen.emplace(key, object.id).second &&
+            referenced.count(object.id) == 0)
+        {
+            removed[i] = true;
+            report.changed++;
+        }
+    }
+    eraseRemoved(document, removed);
+}
+
+void dropUnreferenced(CoreDocument& document, OptimizePassReport& report)
+{
+    auto referenced = referencedIds(document);
+    std::vector<bool> removed(document.objects.size(), false);
+    for (size_t i = 0; i < document.objects.size(); i++)
+    {
+        if (isInterpolator(document.objects[i]) &&
+            referenced.count(document.objects[i].id) == 0)
+        {
+            removed[i] = true;
+        }
+    }
+
+    // Keyed properties without keyframes, then keyed objects without keyed
+    // properties. Both rely on children following their parent in the
+    // stream.
+    auto nextKept = [&](size_t i) {
+        for (i = i + 1; i < document.objects.size(); i++)
+        {
+            if (!removed[i])
+            {
+                return i;
+            }
+        }
+        return i;
+    };
+    for (size_t i = 0; i < document.objects.size(); i++)
+    {
+        if (removed[i] || document.objects[i].typeKey != KeyedPropertyBase::typeKey)
+        {
+            continue;
+        }
+        size_t next = nextKept(i);
+        if (next == document.objects.size() ||
+            !isKeyFrame(document.objects[next].typeKey))
+        {
+            removed[i] = true;
+        }
+    }
+    for (size_t i = 0; i < document.objects.size(); i++)
+    {
+        if (removed[i] || document.objects[i].typeKey != KeyedObjectBase::typeKey)
+        {
+            continue;
+        }
+        size_t next = nextKept(i);
+        if (next == document.objects.size() ||
+            document.objects[next].typeKey != KeyedPropertyBase::typeKey)
+        {
+            removed[i] = true;
+        }
+    }
+    report.changed += std::count(removed.begin(), removed.end(), true);
+    eraseRemoved(document, removed);
+}
+
+void quantize(CoreDocument& document,
+              const PropertyTypeMap& typeMap,
+              float step,
+              OptimizePassReport& report)
+{
+    for (auto& object : document.objects)
+    {
+        bool changed = false;
+        for (auto& property : object.properties)
+        {
+            auto value = std::get_if<float>(&property.value);
+            auto itr = typeMap.find(property.key);
+            if (value == nullptr || itr == typeMap.end() ||
+                itr->second != CoreDoubleType::id)
+            {
+                continue;
+            }
+            float quantized = std::round(*value / step) * step;
+            if (quantized != *value)
+            {
+                report.maxError =
+                    std::max(report.maxError, std::abs(quantized - *value));
+                *value = quantized;
+                changed = true;
+            }
+        }
+        if (changed)
+        {
+            report.changed++;
+        }
+    }
+}
+} // namespace
+
+size_t estimate_object_bytes(const CoreDocument& document,
+                             const PropertyTypeMap& typeMap)
+{
+    size_t size = 0;
+    for (const auto& object : document.objects)
+    {
+        size += varUintSize(object.typeKey);
+        if (object.isComponent)
+        {
+            // Local ids are assigned at serialization time; assume they fit
+            // in two bytes.
+            size += varUintSize(kComponentIdKey) + 2;
+            if (object.parentId != 0)
+            {
+                size += varUintSize(kParentIdKey) + 2;
+            }
+        }
+        for (const auto& property : object.properties)
+        {
+            size += propertyBytes(property, typeMap);
+        }
+        size += 1; // Property terminator
+    }
+    return size;
+}
+
+OptimizeReport optimize_core_document(CoreDocument& document,
+                                      const PropertyTypeMap& typeMap,
+                                      const OptimizeOptions& options)
+{
+    OptimizeReport report;
+    auto run = [&](const char* name, bool enabled, const std::function<void(OptimizePassReport&)>& pass) {
+        if (!enabled)
+        {
+            return;
+        }
+        OptimizePassReport passReport;
+        passReport.name = name;
+        passReport.objectsBefore = document.objects.size();
+        passReport.bytesBefore = estimate_object_bytes(document, typeMap);
+        pass(passReport);
+        passReport.objectsAfter = document.objects.size();
+        passReport.bytesAfter = estimate_object_bytes(document, typeMap);
+        report.passes.push_back(passReport);
+    };
+
+    run("reduceKeyFrames", options.reduceKeyFrames, [&](OptimizePassReport& r) {
+        reduceKeyFrames(document, options.keyFrameTolerance, r);
+    });
+    run("mergeInterpolators", options.mergeInterpolators, [&](OptimizePassReport& r) {
+        mergeInterpolators(document, r);
+    });
+    run("dedupeGradientStops", options.dedupeGradientStops, [&](OptimizePassReport& r) {
+        dedupeGradientStops(document, r);
+    });
+    run("dropUnreferenced", options.dropUnreferenced, [&](OptimizePassReport& r) {
+        dropUnreferenced(document, r);
+    });
+    run("quantize", options.quantizeStep > 0.0f, [&](OptimizePassReport& r) {
+        quantize(document, typeMap, options.quantizeStep, r);
+    });
+    return report;
+}
+
+void print_optimize_report(const OptimizeReport& report)
+{
+    log_stream() << "  === Optimizer ===" << std::endl;
+    for (const auto& pass : report.passes)
+    {
+        log_stream() << "  " << pass.name << ": objects " << pass.objectsBefore
+                  << " -> " << pass.objectsAfter << ", bytes ~"
+                  << pass.bytesBefore << " -> ~" << pass.bytesAfter;
+        if (pass.changed != 0)
+        {
+            log_stream() << ", changed " << pass.changed;
+        }
+        if (pass.maxError != 0.0f)
+        {
+            log_stream() << ", max error " << pass.maxError;
+        }
+        log_stream() << std::endl;
+    }
+    log_stream() << "  =================\n" << std::endl;
+}
+
+} // namespace rive_converter
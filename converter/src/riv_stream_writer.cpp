@@ -0,0 +1,67 @@
+#include "riv_stream_writer.hpp"
+
+#include <cstring>
+#include <utility>
+
+namespace rive_converter
+{
+
+RivStreamWriter::RivStreamWriter(RivSink sink, size_t bufferSize) :
+    m_sink(std::move(sink)), m_buffer(bufferSize == 0 ? 1 : bufferSize)
+{}
+
+RivStreamWriter::~RivStreamWriter() { flush(); }
+
+void RivStreamWriter::write(const uint8_t* bytes, size_t length)
+{
+    m_bytesWritten += length;
+    if (m_used + length <= m_buffer.size())
+    {
+        std::memcpy(m_buffer.data() + m_used, bytes, length);
+        m_used += length;
+        return;
+    }
+
+    flush();
+    if (length >= m_buffer.size())
+    {
+        m_failed = m_failed || !m_sink(bytes, length);
+        return;
+    }
+    std::memcpy(m_buffer.data(), bytes, length);
+    m_used = length;
+}
+
+void RivStreamWriter::flush()
+{
+    if (m_used == 0)
+    {
+        return;
+    }
+    size_t used = m_used;
+    m_used = 0;
+    m_failed = m_failed || !m_sink(m_buffer.data(), used);
+}
+
+void RivStreamWriter::clear()
+{
+    m_bytesWritten -= m_used;
+    m_used = 0;
+}
+
+RivSink file_sink(FILE* file)
+{
+    return [file](const uint8_t* bytes, size_t length) {
+        return std::fwrite(bytes, 1, length, file) == length;
+    };
+}
+
+RivSink vector_sink(std::vector<uint8_t>& bytes)
+{
+    return [&bytes](const uint8_t* data, size_t length) {
+        bytes.insert(bytes.end(), data, data + length);
+        return true;
+    };
+}
+
+} // namespace rive_converter
@@ -1,6 +1,7 @@
 #include "serializer.hpp"
 #include "core_builder.hpp"
 #include "serializer_diagnostics.hpp"
+#include "converter_log.hpp"
 #include <iostream>
 #include <cctype>
 #include <cstring>
@@ -23,8 +24,7 @@
 
 #include <algorithm>
 #include <cstdint>
-#include <unordered_map>
-#include <unordered_set>
+#include <map>
 #include <variant>
 #include <vector>
 
@@ -108,7 +108,7 @@ uint8_t headerTypeCodeFor(int fieldId)
     }
 }
 
-void writeProperty(VectorBinaryWriter& writer,
+void writeProperty(BinaryWriter& writer,
                    uint16_t key,
                    const Property& property,
                    int fieldId)
@@ -207,29 +207,79 @@ void writeProperty(VectorBinaryWriter& writer,
         }
     }
 }
-} // namespace
-
-std::vector<uint8_t> serialize_minimal_riv(const Document& doc)
+// Counts the bytes passed through to the destination stream so the
+// diagnostics can report chunk offsets without buffering the output.
+class CountingStream : public BinaryStream
 {
-    PropertyTypeMap typeMap;
-    auto document = build_core_document(doc, typeMap);
+public:
+    explicit CountingStream(BinaryStream& target) : m_target(target) {}
 
-    std::unordered_set<uint16_t> headerSet;
-    for (const auto& object : document.objects)
+    void write(const uint8_t* bytes, std::size_t length) override
     {
-        for (const auto& property : object.properties)
-        {
-            headerSet.insert(property.key);
-        }
+        m_target.write(bytes, length);
+        m_size += length;
+    }
+    void flush() override { m_target.flush(); }
+    void clear() override
+    {
+        m_target.clear();
+        m_size = 0;
     }
-    
-    // Key 212 (FileAssetContents::bytes) is now added as normal object property,
-    // so it will be in headerSet automatically
 
+    size_t size() const { return m_size; }
+
+private:
+    BinaryStream& m_target;
+    size_t m_size = 0;
+};
+
+// Everything the header needs, gathered in a pre-pass so objects can be
+// written out as soon as they're encoded.
+struct RivLayout
+{
+    // Property keys declared in the ToC, indexed by key.
+    std::vector<bool> inHeader = std::vector<bool>(size_t{1} << 16, false);
+    std::vector<uint16_t> headerKeys; // Ascending
+    // One past the largest component or parent id, sizes LocalIndexMap.
+    uint32_t idCount = 0;
+    // Rough size of the encoded file, used to presize output buffers.
+    size_t estimatedSize = 0;
+};
+
+size_t estimatedPropertySize(const Property& property)
+{
+    if (auto p = std::get_if<std::string>(&property.value))
+    {
+        return 8 + p->size();
+    }
+    if (auto p = std::get_if<std::vector<uint8_t>>(&property.value))
+    {
+        return 8 + p->size();
+    }
+    return 8;
+}
+
+void declareHeaderKey(RivLayout& layout, PropertyTypeMap& typeMap, uint16_t key, uint8_t fieldId)
+{
+    layout.inHeader[key] = true;
+    typeMap[key] = fieldId;
+}
+
+RivLayout planLayout(const CoreDocument& document, PropertyTypeMap& typeMap)
+{
+    RivLayout layout;
     bool needsParentKey = false;
     bool needsIdKey = false;
+    // Header, placeholder asset objects and terminators
+    layout.estimatedSize = 64 + document.fontData.size();
     for (const auto& object : document.objects)
     {
+        layout.estimatedSize += 16;
+        for (const auto& property : object.properties)
+        {
+            layout.inHeader[property.key] = true;
+            layout.estimatedSize += estimatedPropertySize(property);
+        }
         if (object.isComponent)
         {
             needsIdKey = true;
@@ -238,64 +288,67 @@ std::vector<uint8_t> serialize_minimal_riv(const Document& doc)
                 needsParentKey = true;
             }
         }
+        layout.idCount = std::max({layout.idCount, object.id + 1, object.parentId + 1});
     }
     if (needsIdKey)
     {
-        headerSet.insert(kComponentIdKey);
-        typeMap[kComponentIdKey] = rive::CoreUintType::id;
+        declareHeaderKey(layout, typeMap, kComponentIdKey, rive::CoreUintType::id);
     }
     if (needsParentKey)
     {
-        headerSet.insert(kParentIdKey);
-        typeMap[kParentIdKey] = rive::CoreUintType::id;
+        declareHeaderKey(layout, typeMap, kParentIdKey, rive::CoreUintType::id);
     }
-    
-    // PR1 Extended: Add bytes key (212) and assetId key (204) for asset placeholder/font
-    // Since we write these in the serializer (not builder), must add to header manually
-    headerSet.insert(kFileAssetBytesKey); // 212
-    typeMap[kFileAssetBytesKey] = rive::CoreStringType::id; // bytes type (same as string)
-    headerSet.insert(kFileAssetIdKey);   // 204
-    typeMap[kFileAssetIdKey] = rive::CoreUintType::id;
-
-    std::vector<uint16_t> headerKeys(headerSet.begin(), headerSet.end());
-    std::sort(headerKeys.begin(), headerKeys.end());
 
-    std::vector<uint8_t> buffer;
-    buffer.reserve(16384); // Reserve 16KB for large files
-    VectorBinaryWriter writer(&buffer);
+    // The serializer writes the asset bytes (212) and assetId (204) keys
+    // itself (placeholder/font objects), so they must be declared here too.
+    // Bytes share their field id with strings.
+    declareHeaderKey(layout, typeMap, kFileAssetBytesKey, rive::CoreStringType::id);
+    declareHeaderKey(layout, typeMap, kFileAssetIdKey, rive::CoreUintType::id);
 
-    SerializerDiagnostics diag;
-    if (diag.isEnabled())
+    for (size_t key = 0; key < layout.inHeader.size(); ++key)
     {
-        diag.info("Starting RIV serialization (serialize_minimal_riv)");
-        diag.logCount("Objects", document.objects.size());
-        diag.logCount("Header keys", headerKeys.size());
+        if (layout.inHeader[key])
+        {
+            layout.headerKeys.push_back(static_cast<uint16_t>(key));
+        }
     }
+    layout.estimatedSize += layout.headerKeys.size() * 3;
+    return layout;
+}
+
+// Writes the file header, ToC and field bitmap.
+void writeHeader(BinaryWriter& writer,
+                 const CountingStream& stream,
+                 const RivLayout& layout,
+                 const PropertyTypeMap& typeMap,
+                 SerializerDiagnostics& diag)
+{
+    const auto& headerKeys = layout.headerKeys;
 
     // File header
-    diag.beginChunk("HEADER", buffer.size());
+    diag.beginChunk("HEADER", stream.size());
     writer.write(reinterpret_cast<const uint8_t*>("RIVE"), 4);
-    writer.writeVarUint(static_cast<uint32_t>(File::majorVersion));
-    writer.writeVarUint(static_cast<uint32_t>(File::minorVersion));
-    writer.writeVarUint(uint32_t{0}); // file id placeholder
-    diag.endChunk("HEADER", buffer.size());
+    writer.writeVarUint(static_cast<uint32_t>(rive::File::majorVersion));
+    writer.writeVarUint(static_cast<uint32_t>(rive::File::minorVersion));
+    writer.writeVarUint(uint32_t{0}); // file id
+    diag.endChunk("HEADER", stream.size());
 
     // Table of Contents
-    diag.beginChunk("TOC", buffer.size(), headerKeys.size() * 2);  // ~2 bytes per key
+    diag.beginChunk("TOC", stream.size(), headerKeys.size() * 2); // ~2 bytes per key
     for (auto key : headerKeys)
     {
         writer.writeVarUint(static_cast<uint32_t>(key));
     }
     writer.writeVarUint(uint32_t{0});
-    diag.endChunk("TOC", buffer.size());
+    diag.endChunk("TOC", stream.size());
 
     // NOTE: No padding between ToC and bitmap
     // RuntimeHeader::read() expects bitmap to start immediately after 0 terminator
     // See include/rive/runtime_header.hpp:87-93 - readUint32() is called right after ToC loop
 
     // Bitmap
-    diag.beginChunk("BITMAP", buffer.size());
-    diag.checkAlignment("Bitmap", buffer.size(), 4);
+    diag.beginChunk("BITMAP", stream.size());
+    diag.checkAlignment("Bitmap", stream.size(), 4);
     const size_t bitmapCount = (headerKeys.size() + 3) / 4;
     std::vector<uint32_t> bitmap(bitmapCount, 0u);
     for (size_t index = 0; index < headerKeys.size(); ++index)
@@ -310,76 +363,176 @@ std::vector<uint8_t> serialize_minimal_riv(const Document& doc)
     {
         writer.write(value);
     }
-    diag.endChunk("BITMAP", buffer.size());
+    diag.endChunk("BITMAP", stream.size());
+}
+
+// Maps builder ids to artboard-local component indices. Builder ids are
+// dense, so this is a flat array; entries are stamped with the artboard they
+// belong to, which makes starting a new artboard O(1) instead of a clear.
+class LocalIndexMap
+{
+public:
+    explicit LocalIndexMap(uint32_t idCount) : m_index(idCount), m_artboard(idCount, 0) {}
+
+    // Forgets every mapping; the next new id gets index 0.
+    void beginArtboard()
+    {
+        m_currentArtboard++;
+        m_nextIndex = 0;
+    }
+
+    bool find(uint32_t id, uint32_t& index) const
+    {
+        if (id >= m_index.size() || m_artboard[id] != m_currentArtboard)
+        {
+            return false;
+        }
+        index = m_index[id];
+        return true;
+    }
+
+    // id must be less than the idCount the map was created with.
+    uint32_t findOrAdd(uint32_t id)
+    {
+        if (m_artboard[id] != m_currentArtboard)
+        {
+            m_artboard[id] = m_currentArtboard;
+            m_index[id] = m_nextIndex++;
+        }
+        return m_index[id];
+    }
+
+private:
+    std::vector<uint32_t> m_index;
+    std::vector<uint32_t> m_artboard;
+    // Starts past the stamp of never-mapped entries so components before the
+    // first artboard are still indexed.
+    uint32_t m_currentArtboard = 1;
+    uint32_t m_nextIndex = 0;
+};
+
+// Writes the component id/parent id of object, assigning local indices to
+// both on first use.
+void writeComponentIds(BinaryWriter& writer, const CoreObject& object, LocalIndexMap& localIndices)
+{
+    if (object.isArtboard)
+    {
+        localIndices.beginArtboard();
+        localIndices.findOrAdd(object.id);
+    }
+    if (!object.isComponent)
+    {
+        return;
+    }
+
+    writer.writeVarUint(static_cast<uint32_t>(kComponentIdKey));
+    writer.writeVarUint(localIndices.findOrAdd(object.id));
+
+    if (object.parentId != 0)
+    {
+        writer.writeVarUint(static_cast<uint32_t>(kParentIdKey));
+        writer.writeVarUint(localIndices.findOrAdd(object.parentId));
+    }
+}
+
+// Properties of object in ascending key order, without copying them.
+void sortedProperties(const CoreObject& object, std::vector<const Property*>& sorted)
+{
+    sorted.clear();
+    for (const auto& property : object.properties)
+    {
+        sorted.push_back(&property);
+    }
+    std::stable_sort(sorted.begin(), sorted.end(), [](const Property* a, const Property* b) {
+        return a->key < b->key;
+    });
+}
+
+// Component reference properties hold builder ids that must be remapped to
+// artboard-local indices.
+bool isComponentReference(uint16_t key)
+{
+    return key == 51 ||  // KeyedObject::objectId (animation references)
+           key == 92 ||  // ClippingShape::sourceId (clipping references)
+           key == 272;   // TextValueRun::styleId (text style references)
+}
+
+// Writes the placeholder image asset emitted after the Backboard when no
+// font is embedded.
+void writeAssetPlaceholder(BinaryWriter& writer)
+{
+    // Write ImageAsset (105) placeholder object
+    writer.writeVarUint(static_cast<uint32_t>(rive::ImageAssetBase::typeKey)); // 105
+    writer.writeVarUint(static_cast<uint32_t>(kFileAssetIdKey)); // 204
+    writer.writeVarUint(static_cast<uint32_t>(0));   // assetId = 0
+    writer.writeVarUint(static_cast<uint32_t>(0));   // property terminator
+
+    // Write FileAssetContents (106) with empty bytes (212) as independent object
+    writer.writeVarUint(static_cast<uint32_t>(rive::FileAssetContentsBase::typeKey)); // 106
+    writer.writeVarUint(static_cast<uint32_t>(kFileAssetBytesKey)); // 212
+    writer.writeVarUint(static_cast<uint32_t>(0));   // length = 0 (empty)
+    writer.writeVarUint(static_cast<uint32_t>(0));   // property terminator
+}
+
+// Writes the embedded font as a FileAssetContents (106) object.
+void writeFontContents(BinaryWriter& writer, const std::vector<uint8_t>& fontData)
+{
+    writer.writeVarUint(static_cast<uint32_t>(rive::FileAssetContentsBase::typeKey)); // 106
+    writer.writeVarUint(static_cast<uint32_t>(kFileAssetBytesKey)); // 212
+    writer.writeVarUint(static_cast<uint32_t>(fontData.size()));
+    writer.write(fontData.data(), fontData.size());
+    writer.writeVarUint(uint32_t{0}); // property terminator
+}
+} // namespace
+
+namespace
+{
+void writeMinimalObjects(const CoreDocument& document,
+                         const PropertyTypeMap& typeMap,
+                         const RivLayout& layout,
+                         BinaryStream& output)
+{
+    CountingStream stream(output);
+    BinaryWriter writer(&stream);
+    const auto& headerKeys = layout.headerKeys;
+
+    SerializerDiagnostics diag;
+    if (diag.isEnabled())
+    {
+        diag.info("Starting RIV serialization (serialize_minimal_riv)");
+        diag.logCount("Objects", document.objects.size());
+        diag.logCount("Header keys", headerKeys.size());
+    }
+
+    writeHeader(writer, stream, layout, typeMap, diag);
 
     // Objects
-    diag.beginChunk("OBJECTS", buffer.size());
+    diag.beginChunk("OBJECTS", stream.size());
     diag.logCount("Object count", document.objects.size());
 
     bool placeholderEmitted = false;  // PR1: Separate flags
     bool fontBytesEmitted = false;
-    std::unordered_map<uint32_t, uint32_t> localComponentIndex;
-    uint32_t nextLocalIndex = 0;
+    LocalIndexMap localComponentIndex(layout.idCount);
     // PR2c: track all property keys written to the stream
-    std::unordered_set<uint16_t> streamPropKeys;
+    std::vector<bool> streamPropKeys(layout.inHeader.size(), false);
+    std::vector<const Property*> properties;
     
     size_t objIndex = 0;
     for (const auto& object : document.objects)
     {
         writer.writeVarUint(static_cast<uint32_t>(object.typeKey));
-
-        if (object.isArtboard)
-        {
-            localComponentIndex.clear();
-            localComponentIndex.emplace(object.id, 0);
-            nextLocalIndex = 1;
-        }
-
-        if (object.isComponent)
-        {
-            uint32_t localId = 0;
-            auto selfIt = localComponentIndex.find(object.id);
-            if (selfIt == localComponentIndex.end())
-            {
-                localId = nextLocalIndex++;
-                localComponentIndex.emplace(object.id, localId);
-            }
-            else
-            {
-                localId = selfIt->second;
-            }
-
-            writer.writeVarUint(static_cast<uint32_t>(kComponentIdKey));
-            writer.writeVarUint(localId);
-
-            if (object.parentId != 0)
-            {
-                auto parentIt = localComponentIndex.find(object.parentId);
-                if (parentIt == localComponentIndex.end())
-                {
-                    parentIt = localComponentIndex
-                                   .emplace(object.parentId, nextLocalIndex++)
-                                   .first;
-                }
-                writer.writeVarUint(static_cast<uint32_t>(kParentIdKey));
-                writer.writeVarUint(parentIt->second);
-            }
-        }
-
-        std::vector<Property> properties = object.properties;
-        std::sort(properties.begin(), properties.end(),
-                  [](const Property& a, const Property& b) {
-                      return a.key < b.key;
-                  });
+        writeComponentIds(writer, object, localComponentIndex);
+        sortedProperties(object, properties);
 
         // PR2b: Track remap misses for diagnostic
-        static std::map<uint16_t, int> remapMissCount;
-        static bool firstRun = true;
+        static thread_local std::map<uint16_t, int> remapMissCount;
+        static thread_local bool firstRun = true;
         
-        for (const auto& property : properties)
+        for (const Property* propertyPtr : properties)
         {
+            const auto& property = *propertyPtr;
             // PR2c: HEADER_MISS check
-            if (headerSet.find(property.key) == headerSet.end())
+            if (!layout.inHeader[property.key])
             {
                 std::cerr << "HEADER_MISS key=" << property.key
                           << " typeKey=" << object.typeKey << std::endl;
@@ -388,18 +541,16 @@ std::vector<uint8_t> serialize_minimal_riv(const Document& doc)
             }
 
             // Special handling for component reference properties - remap to artboard-local indices
-            if (property.key == 51 ||   // KeyedObject::objectId (animation references)
-                property.key == 92 ||   // ClippingShape::sourceId (clipping references)
-                property.key == 272)    // TextValueRun::styleId (text style references)
+            if (isComponentReference(property.key))
             {
                 if (auto p = std::get_if<uint32_t>(&property.value))
                 {
                     uint32_t globalId = *p;
-                    auto localIt = localComponentIndex.find(globalId);
-                    if (localIt != localComponentIndex.end())
+                    uint32_t localIndex = 0;
+                    if (localComponentIndex.find(globalId, localIndex))
                     {
                         writer.writeVarUint(static_cast<uint32_t>(property.key)); // key
-                        writer.writeVarUint(localIt->second); // artboard-local index
+                        writer.writeVarUint(localIndex); // artboard-local index
                         continue; // Skip normal writeProperty
                     }
                     else
@@ -435,7 +586,7 @@ std::vector<uint8_t> serialize_minimal_riv(const Document& doc)
             }
 
             writeProperty(writer, property.key, property, fieldId);
-            streamPropKeys.insert(property.key);
+            streamPropKeys[property.key] = true;
         }
         
         // PR2b: Print summary at end of first artboard
@@ -456,19 +607,8 @@ std::vector<uint8_t> serialize_minimal_riv(const Document& doc)
         if (objIndex == 0 && !fontBytesEmitted && !placeholderEmitted && document.fontData.empty())
         {
             placeholderEmitted = true;
-            // Write ImageAsset (105) placeholder object
-            writer.writeVarUint(static_cast<uint32_t>(rive::ImageAssetBase::typeKey)); // 105
-            writer.writeVarUint(static_cast<uint32_t>(kFileAssetIdKey)); // 204
-            writer.writeVarUint(static_cast<uint32_t>(0));   // assetId = 0
-            writer.writeVarUint(static_cast<uint32_t>(0));   // property terminator
-
-            // Write FileAssetContents (106) with empty bytes (212) as independent object
-            writer.writeVarUint(static_cast<uint32_t>(rive::FileAssetContentsBase::typeKey)); // 106
-            writer.writeVarUint(static_cast<uint32_t>(kFileAssetBytesKey)); // 212
-            writer.writeVarUint(static_cast<uint32_t>(0));   // length = 0 (empty)
-            writer.writeVarUint(static_cast<uint32_t>(0));   // property terminator
-            
-            std::cout << "  ℹ️  Asset placeholder after Backboard (no font embedded)" << std::endl;
+            writeAssetPlaceholder(writer);
+            log_stream() << "  ℹ️  Asset placeholder after Backboard (no font embedded)" << std::endl;
         }
         
         // PR1: Real font bytes AFTER FontAsset (141) properties complete
@@ -477,15 +617,8 @@ std::vector<uint8_t> serialize_minimal_riv(const Document& doc)
             if (!document.fontData.empty())
             {
                 fontBytesEmitted = true;
-                
-                // Write FileAssetContents (106) as independent object
-                writer.writeVarUint(static_cast<uint32_t>(rive::FileAssetContentsBase::typeKey)); // 106
-                writer.writeVarUint(static_cast<uint32_t>(kFileAssetBytesKey)); // 212
-                writer.writeVarUint(static_cast<uint32_t>(document.fontData.size()));
-                writer.write(document.fontData.data(), document.fontData.size());
-                writer.writeVarUint(uint32_t{0}); // property terminator
-                
-                std::cout << "  ℹ️  Font bytes written after FontAsset (" << document.fontData.size() << " bytes)" << std::endl;
+                writeFontContents(writer, document.fontData);
+                log_stream() << "  ℹ️  Font bytes written after FontAsset (" << document.fontData.size() << " bytes)" << std::endl;
             }
         }
         
@@ -494,10 +627,12 @@ std::vector<uint8_t> serialize_minimal_riv(const Document& doc)
 
     // PR2c: Print header/stream diff
     if (true) {
-        std::unordered_set<uint16_t> missingInHeader;
-        for (auto k : streamPropKeys) if (headerSet.find(k) == headerSet.end()) missingInHeader.insert(k);
-        std::unordered_set<uint16_t> extraInHeader;
-        for (auto k : headerSet) if (streamPropKeys.find(k) == streamPropKeys.end()) extraInHeader.insert(k);
+        std::vector<uint16_t> missingInHeader;
+        std::vector<uint16_t> extraInHeader;
+        for (size_t k = 0; k < streamPropKeys.size(); ++k) {
+            if (streamPropKeys[k] && !layout.inHeader[k]) missingInHeader.push_back(static_cast<uint16_t>(k));
+            if (layout.inHeader[k] && !streamPropKeys[k]) extraInHeader.push_back(static_cast<uint16_t>(k));
+        }
         if (!missingInHeader.empty() || !extraInHeader.empty()) {
             std::cerr << "\n=== PR2c HEADER/STREAM DIFF (minimal) ===" << std::endl;
             if (!missingInHeader.empty()) {
@@ -516,13 +651,12 @@ std::vector<uint8_t> serialize_minimal_riv(const Document& doc)
 
     // End object stream with terminator
     writer.writeVarUint(static_cast<uint32_t>(0)); // Object stream terminator
-    diag.endChunk("OBJECTS", buffer.size());
-    
+    diag.endChunk("OBJECTS", stream.size());
     diag.printSummary();
     
     // PR-RivePlay-Catalog: Write Artboard Catalog chunk for proper artboard selection
     // This must come AFTER object stream terminator, as a separate chunk
-    std::cout << "\n  ℹ️  Writing Artboard Catalog chunk (minimal serializer)..." << std::endl;
+    log_stream() << "\n  ℹ️  Writing Artboard Catalog chunk (minimal serializer)..." << std::endl;
     
     // Collect artboard IDs from document
     // Note: 0x0 artboards are already filtered by universal_builder, so all artboards here are valid
@@ -530,7 +664,7 @@ std::vector<uint8_t> serialize_minimal_riv(const Document& doc)
     for (const auto& object : document.objects) {
         if (object.isArtboard) {
             artboardIds.push_back(object.id);
-            std::cout << "    - Artboard id: " << object.id << std::endl;
+            log_stream() << "    - Artboard id: " << object.id << std::endl;
         }
     }
     
@@ -554,59 +688,21 @@ std::vector<uint8_t> serialize_minimal_riv(const Document& doc)
     }
     */
     
-    std::cout << "  ✅ Artboard Catalog written (" << artboardIds.size() << " artboards)" << std::endl;
-    
-    return buffer;
+    log_stream() << "  ✅ Artboard Catalog written (" << artboardIds.size() << " artboards)" << std::endl;
+
+    // Flush here rather than leaving it to ~BinaryWriter, so the last
+    // buffered bytes reach the sink before the caller checks for errors.
+    stream.flush();
 }
 
-// Serialize CoreDocument directly (for universal builder)
-std::vector<uint8_t> serialize_core_document(const CoreDocument& document, PropertyTypeMap& typeMap)
+void writeCoreObjects(const CoreDocument& document,
+                      const PropertyTypeMap& typeMap,
+                      const RivLayout& layout,
+                      BinaryStream& output)
 {
-    std::unordered_set<uint16_t> headerSet;
-    for (const auto& object : document.objects)
-    {
-        for (const auto& property : object.properties)
-        {
-            headerSet.insert(property.key);
-        }
-    }
-
-    bool needsParentKey = false;
-    bool needsIdKey = false;
-    for (const auto& object : document.objects)
-    {
-        if (object.isComponent)
-        {
-            needsIdKey = true;
-            if (object.parentId != 0)
-            {
-                needsParentKey = true;
-            }
-        }
-    }
-    if (needsIdKey)
-    {
-        headerSet.insert(kComponentIdKey);
-        typeMap[kComponentIdKey] = rive::CoreUintType::id;
-    }
-    if (needsParentKey)
-    {
-        headerSet.insert(kParentIdKey);
-        typeMap[kParentIdKey] = rive::CoreUintType::id;
-    }
-
-    // Ensure bytes (212) and assetId (204) keys declared for serializer-emitted chunks
-    headerSet.insert(kFileAssetBytesKey);
-    typeMap[kFileAssetBytesKey] = rive::CoreStringType::id; // bytes/share id with string
-    headerSet.insert(kFileAssetIdKey);
-    typeMap[kFileAssetIdKey] = rive::CoreUintType::id;
-
-    std::vector<uint16_t> headerKeys(headerSet.begin(), headerSet.end());
-    std::sort(headerKeys.begin(), headerKeys.end());
-
-    std::vector<uint8_t> buffer;
-    buffer.reserve(16384); // Reserve 16KB for large files
-    VectorBinaryWriter writer(&buffer);
+    CountingStream stream(output);
+    BinaryWriter writer(&stream);
+    const auto& headerKeys = layout.headerKeys;
 
     SerializerDiagnostics diag;
     if (diag.isEnabled())
@@ -616,130 +712,48 @@ std::vector<uint8_t> serialize_core_document(const CoreDocument& document, Prope
         diag.logCount("Header keys", headerKeys.size());
     }
 
-    // File header
-    diag.beginChunk("HEADER", buffer.size());
-    writer.write(reinterpret_cast<const uint8_t*>("RIVE"), 4);
-    writer.writeVarUint(static_cast<uint32_t>(rive::File::majorVersion));
-    writer.writeVarUint(static_cast<uint32_t>(rive::File::minorVersion));
-    writer.writeVarUint(uint32_t{0}); // file id
-    diag.endChunk("HEADER", buffer.size());
-
-    // Table of Contents
-    diag.beginChunk("TOC", buffer.size(), headerKeys.size() * 2);
-    for (auto key : headerKeys)
-    {
-        writer.writeVarUint(static_cast<uint32_t>(key));
-    }
-    writer.writeVarUint(uint32_t{0});
-    diag.endChunk("TOC", buffer.size());
-
-    // NOTE: No padding between ToC and bitmap
-    // RuntimeHeader::read() expects bitmap to start immediately after 0 terminator
-    // See include/rive/runtime_header.hpp:87-93 - readUint32() is called right after ToC loop
-
-    // Bitmap
-    diag.beginChunk("BITMAP", buffer.size());
-    diag.checkAlignment("Bitmap", buffer.size(), 4);
-    const size_t bitmapCount = (headerKeys.size() + 3) / 4;
-    std::vector<uint32_t> bitmap(bitmapCount, 0u);
-    for (size_t index = 0; index < headerKeys.size(); ++index)
-    {
-        int fieldId = fieldIdForKey(headerKeys[index], typeMap);
-        uint8_t code = static_cast<uint8_t>(headerTypeCodeFor(fieldId) & 0x3);
-        size_t bucket = index / 4;
-        size_t shift = (index % 4) * 2;
-        bitmap[bucket] |= static_cast<uint32_t>(code) << shift;
-    }
-    for (auto value : bitmap)
-    {
-        writer.write(value);
-    }
-    diag.endChunk("BITMAP", buffer.size());
+    writeHeader(writer, stream, layout, typeMap, diag);
 
     // Objects
-    diag.beginChunk("OBJECTS", buffer.size());
+    diag.beginChunk("OBJECTS", stream.size());
     diag.logCount("Object count", document.objects.size());
 
     bool placeholderEmitted = false;  // PR1: Separate flags
     bool fontBytesEmitted = false;
-    std::unordered_map<uint32_t, uint32_t> localComponentIndex;
-    uint32_t nextLocalIndex = 0;
-
-    // PR2c: Collect stream property keys and enable diagnostics
-    std::unordered_set<uint16_t> streamPropKeys;
+    LocalIndexMap localComponentIndex(layout.idCount);
+    std::vector<const Property*> properties;
 
     for (size_t objIndex = 0; objIndex < document.objects.size(); ++objIndex)
     {
         const auto& object = document.objects[objIndex];
         writer.writeVarUint(static_cast<uint32_t>(object.typeKey));
-
-        if (object.isArtboard)
-        {
-            localComponentIndex.clear();
-            localComponentIndex.emplace(object.id, 0);
-            nextLocalIndex = 1;
-        }
-
-        if (object.isComponent)
-        {
-            uint32_t localId = 0;
-            auto selfIt = localComponentIndex.find(object.id);
-            if (selfIt == localComponentIndex.end())
-            {
-                localId = nextLocalIndex++;
-                localComponentIndex.emplace(object.id, localId);
-            }
-            else
-            {
-                localId = selfIt->second;
-            }
-
-            writer.writeVarUint(static_cast<uint32_t>(kComponentIdKey));
-            writer.writeVarUint(localId);
-
-            if (object.parentId != 0)
-            {
-                auto parentIt = localComponentIndex.find(object.parentId);
-                if (parentIt == localComponentIndex.end())
-                {
-                    parentIt = localComponentIndex
-                                   .emplace(object.parentId, nextLocalIndex++)
-                                   .first;
-                }
-                writer.writeVarUint(static_cast<uint32_t>(kParentIdKey));
-                writer.writeVarUint(parentIt->second);
-            }
-        }
-
-        std::vector<Property> properties = object.properties;
-        std::sort(properties.begin(), properties.end(),
-                  [](const Property& a, const Property& b) {
-                      return a.key < b.key;
-                  });
+        writeComponentIds(writer, object, localComponentIndex);
+        sortedProperties(object, properties);
 
         // PR2b: Track remap misses for diagnostic (core_document path)
-        static std::map<uint16_t, int> remapMissCountCore;
-        static bool firstRunCore = true;
+        static thread_local std::map<uint16_t, int> remapMissCountCore;
+        static thread_local bool firstRunCore = true;
         
-        for (const auto& property : properties)
+        for (const Property* propertyPtr : properties)
         {
+            const auto& property = *propertyPtr;
             // PR2c: HEADER_MISS check
-            if (headerSet.find(property.key) == headerSet.end())
+            if (!layout.inHeader[property.key])
             {
                 std::cerr << "HEADER_MISS key=" << property.key
                           << " typeKey=" << object.typeKey << std::endl;
                 continue;
             }
-            if (property.key == 51 || property.key == 92 || property.key == 272)
+            if (isComponentReference(property.key))
             {
                 if (auto p = std::get_if<uint32_t>(&property.value))
                 {
                     uint32_t globalId = *p;
-                    auto localIt = localComponentIndex.find(globalId);
-                    if (localIt != localComponentIndex.end())
+                    uint32_t localIndex = 0;
+                    if (localComponentIndex.find(globalId, localIndex))
                     {
                         writer.writeVarUint(static_cast<uint32_t>(property.key));
-                        writer.writeVarUint(localIt->second);
+                        writer.writeVarUint(localIndex);
                         continue;
                     }
                     else
@@ -777,19 +791,8 @@ std::vector<uint8_t> serialize_core_document(const CoreDocument& document, Prope
         if (objIndex == 0 && !fontBytesEmitted && !placeholderEmitted && document.fontData.empty())
         {
             placeholderEmitted = true;
-            // Write ImageAsset (105) placeholder
-            writer.writeVarUint(static_cast<uint32_t>(rive::ImageAssetBase::typeKey)); // 105
-            writer.writeVarUint(static_cast<uint32_t>(kFileAssetIdKey)); // 204
-            writer.writeVarUint(static_cast<uint32_t>(0));   // assetId = 0
-            writer.writeVarUint(static_cast<uint32_t>(0));   // property terminator
-
-            // Write FileAssetContents (106) with empty bytes (212) as independent object
-            writer.writeVarUint(static_cast<uint32_t>(rive::FileAssetContentsBase::typeKey)); // 106
-            writer.writeVarUint(static_cast<uint32_t>(kFileAssetBytesKey)); // 212
-            writer.writeVarUint(static_cast<uint32_t>(0));   // length = 0 (empty)
-            writer.writeVarUint(static_cast<uint32_t>(0));   // Property terminator
-            
-            std::cout << "  ℹ️  Asset placeholder after Backboard (no font embedded)" << std::endl;
+            writeAssetPlaceholder(writer);
+            log_stream() << "  ℹ️  Asset placeholder after Backboard (no font embedded)" << std::endl;
         }
         
         // PR1: Real font bytes AFTER FontAsset (141) properties complete
@@ -798,28 +801,21 @@ std::vector<uint8_t> serialize_core_document(const CoreDocument& document, Prope
             if (!document.fontData.empty())
             {
                 fontBytesEmitted = true;
-                
-                // Write FileAssetContents (106) as independent object
-                writer.writeVarUint(static_cast<uint32_t>(rive::FileAssetContentsBase::typeKey));
-                writer.writeVarUint(static_cast<uint32_t>(kFileAssetBytesKey)); // 212
-                writer.writeVarUint(static_cast<uint32_t>(document.fontData.size()));
-                writer.write(document.fontData.data(), document.fontData.size());
-                writer.writeVarUint(uint32_t{0}); // Property terminator
-                
-                std::cout << "  ℹ️  Font bytes written after FontAsset (" << document.fontData.size() << " bytes)" << std::endl;
+                writeFontContents(writer, document.fontData);
+                log_stream() << "  ℹ️  Font bytes written after FontAsset (" << document.fontData.size() << " bytes)" << std::endl;
             }
         }
     }
     
     // End object stream with terminator
     writer.writeVarUint(static_cast<uint32_t>(0)); // Object stream terminator
-    diag.endChunk("OBJECTS", buffer.size());
+    diag.endChunk("OBJECTS", stream.size());
     
     diag.printSummary();
 
     // PR-RivePlay-Catalog: Write Artboard Catalog chunk for proper artboard selection
     // This must come AFTER object stream terminator, as a separate chunk
-    std::cout << "\n  ℹ️  Writing Artboard Catalog chunk..." << std::endl;
+    log_stream() << "\n  ℹ️  Writing Artboard Catalog chunk..." << std::endl;
     
     // Collect artboard IDs from document
     // Note: 0x0 artboards are already filtered by universal_builder, so all artboards here are valid
@@ -827,7 +823,7 @@ std::vector<uint8_t> serialize_core_document(const CoreDocument& document, Prope
     for (const auto& object : document.objects) {
         if (object.isArtboard) {
             artboardIds.push_back(object.id);
-            std::cout << "    - Artboard id: " << object.id << std::endl;
+            log_stream() << "    - Artboard id: " << object.id << std::endl;
         }
     }
     
@@ -854,15 +850,64 @@ std::vector<uint8_t> serialize_core_document(const CoreDocument& document, Prope
     // Final chunk terminator
     writer.writeVarUint(static_cast<uint32_t>(0));
     
-    std::cout << "  ✅ Artboard Catalog written (" << artboardIds.size() << " artboards)" << std::endl;
-    
+    log_stream() << "  ✅ Artboard Catalog written (" << artboardIds.size() << " artboards)" << std::endl;
+
+    // Before ~BinaryWriter; see writeMinimalObjects.
+    stream.flush();
+}
+} // namespace
+
+std::vector<uint8_t> serialize_minimal_riv(const Document& doc)
+{
+    PropertyTypeMap typeMap;
+    auto document = build_core_document(doc, typeMap);
+    auto layout = planLayout(document, typeMap);
+
+    std::vector<uint8_t> buffer;
+    buffer.reserve(layout.estimatedSize);
+    VectorBinaryWriter stream(&buffer);
+    writeMinimalObjects(document, typeMap, layout, stream);
+    return buffer;
+}
+
+void write_minimal_riv(const Document& doc, BinaryStream& stream)
+{
+    PropertyTypeMap typeMap;
+    auto document = build_core_document(doc, typeMap);
+    auto layout = planLayout(document, typeMap);
+    writeMinimalObjects(document, typeMap, layout, stream);
+}
+
+// Serialize CoreDocument directly (for universal builder)
+std::vector<uint8_t> serialize_core_document(const CoreDocument& document, PropertyTypeMap& typeMap)
+{
+    auto layout = planLayout(document, typeMap);
+
+    std::vector<uint8_t> buffer;
+    buffer.reserve(layout.estimatedSize);
+    VectorBinaryWriter stream(&buffer);
+    writeCoreObjects(document, typeMap, layout, stream);
     return buffer;
 }
+
+void write_core_document(const CoreDocument& document, PropertyTypeMap& typeMap, BinaryStream& stream)
+{
+    auto layout = planLayout(document, typeMap);
+    writeCoreObjects(document, typeMap, layout, stream);
+}
+
 std::vector<uint8_t> serialize_exact_riv_json(const nlohmann::json& data)
 {
     std::vector<uint8_t> buffer;
     buffer.reserve(4096);
-    rive::VectorBinaryWriter writer(&buffer);
+    rive::VectorBinaryWriter stream(&buffer);
+    write_exact_riv_json(data, stream);
+    return buffer;
+}
+
+void write_exact_riv_json(const nlohmann::json& data, BinaryStream& stream)
+{
+    rive::BinaryWriter writer(&stream);
 
     writer.write(reinterpret_cast<const uint8_t*>("RIVE"), 4);
 
@@ -1008,7 +1053,8 @@ std::vector<uint8_t> serialize_exact_riv_json(const nlohmann::json& data)
         }
     }
 
-    return buffer;
+    // Before ~BinaryWriter; see writeMinimalObjects.
+    stream.flush();
 }
 
 } // namespace rive_converter
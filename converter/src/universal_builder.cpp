@@ -1,5 +1,6 @@
 #include "core_builder.hpp"
 #include "json_loader.hpp"
+#include "converter_log.hpp"
 #include <nlohmann/json.hpp>
 #include <algorithm>
 #include <cmath>
@@ -797,6 +798,19 @@ static void setProperty(CoreBuilder& builder, CoreObject& obj, const std::string
 }
 
 // Initialize PropertyTypeMap for universal builder
+static void initUniversalTypeMap(PropertyTypeMap& typeMap);
+
+// The universal type map never changes, so it is built once and copied into
+// each document (safe to call from concurrent conversions).
+static const PropertyTypeMap& universalTypeMap() {
+    static const PropertyTypeMap typeMap = [] {
+        PropertyTypeMap map;
+        initUniversalTypeMap(map);
+        return map;
+    }();
+    return typeMap;
+}
+
 static void initUniversalTypeMap(PropertyTypeMap& typeMap) {
     // Transform properties
     typeMap[13] = rive::CoreDoubleType::id; // x
@@ -1043,15 +1057,14 @@ static void initUniversalTypeMap(PropertyTypeMap& typeMap) {
 }
 
 CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeMap& outTypeMap) {
-    std::cout << "=== UNIVERSAL JSON TO RIV BUILDER ===" << std::endl;
+    log_stream() << "=== UNIVERSAL JSON TO RIV BUILDER ===" << std::endl;
     
     // PR3: Re-enable keyed data with safe emission (animation-block grouping)
     constexpr bool OMIT_KEYED = false; // PR3: Keyed data re-enabled
     constexpr bool OMIT_STATE_MACHINE = false; // PR-SM: StateMachine re-enabled
     
     CoreBuilder builder;
-    PropertyTypeMap typeMap;
-    initUniversalTypeMap(typeMap);
+    PropertyTypeMap typeMap = universalTypeMap();
     std::vector<uint8_t> embeddedFontData;
     
     // Add Backboard
@@ -1066,12 +1079,12 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
         float abWidth = abJson.value("width", 0.0f);
         float abHeight = abJson.value("height", 0.0f);
         if ((abWidth == 0.0f && abHeight == 0.0f) || abJson["objects"].empty()) {
-            std::cout << "Skipping zero-sized/empty artboard " << abIdx << ": " << abJson["name"] << std::endl;
+            log_stream() << "Skipping zero-sized/empty artboard " << abIdx << ": " << abJson["name"] << std::endl;
             continue;
         }
 
-        std::cout << "Building artboard " << abIdx << ": " << abJson["name"] << std::endl;
-        std::cout << "  Objects: " << abJson["objects"].size() << std::endl;
+        log_stream() << "Building artboard " << abIdx << ": " << abJson["name"] << std::endl;
+        log_stream() << "  Objects: " << abJson["objects"].size() << std::endl;
         
         struct PendingObject
         {
@@ -1165,7 +1178,7 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
 
         // PASS 0: Pre-scan all objects to build complete localId → typeKey mapping
         // This prevents false synthetic Shape injection when parent appears later in JSON
-        std::cout << "  PASS 0: Building complete type mapping..." << std::endl;
+        log_stream() << "  PASS 0: Building complete type mapping..." << std::endl;
         for (const auto& objJson : abJson["objects"]) {
             if (objJson.contains("localId")) {
                 uint32_t localId = objJson["localId"].get<uint32_t>();
@@ -1180,7 +1193,7 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
                 localIdToType[localId] = typeKey;
             }
         }
-        std::cout << "  Type mapping: " << localIdToType.size() << " objects (max localId: " << maxLocalId << ")" << std::endl;
+        log_stream() << "  Type mapping: " << localIdToType.size() << " objects (max localId: " << maxLocalId << ")" << std::endl;
         
         // PR2: Enhanced Pass-0 - also build parent map for dependency analysis
         std::unordered_map<uint32_t, uint32_t> localIdToParent;
@@ -1193,7 +1206,7 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
                 }
             }
         }
-        std::cout << "  Parent map: " << localIdToParent.size() << " parent relationships" << std::endl;
+        log_stream() << "  Parent map: " << localIdToParent.size() << " parent relationships" << std::endl;
 
         auto parentTypeFor = [&](uint32_t parentLocalId) -> uint16_t {
             if (parentLocalId == invalidParent)
@@ -1209,7 +1222,7 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
         };
 
         // PASS 1: Create objects with parent-first topological ordering
-        std::cout << "  PASS 1: Sorting objects for parent-first emission..." << std::endl;
+        log_stream() << "  PASS 1: Sorting objects for parent-first emission..." << std::endl;
         
         // PR-KEYED-ORDER: Topological sort by parentId to ensure parents are created before children
         std::vector<nlohmann::json> sortedObjects;
@@ -1268,8 +1281,8 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
             }
         }
         
-        std::cout << "  Topologically sorted " << orderedObjects.size() << " objects in " << pass << " passes" << std::endl;
-        std::cout << "  PASS 1B: Creating objects in parent-first order..." << std::endl;
+        log_stream() << "  Topologically sorted " << orderedObjects.size() << " objects in " << pass << " passes" << std::endl;
+        log_stream() << "  PASS 1B: Creating objects in parent-first order..." << std::endl;
         
         // PR2: Diagnostic counters for keyed data
         std::map<uint16_t, int> keyedInJson;
@@ -1300,7 +1313,7 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
             const auto& animationsJson = abJson["animations"];
             if (!animationsJson.empty())
             {
-                std::cout << "  PASS 1B: Integrating " << animationsJson.size()
+                log_stream() << "  PASS 1B: Integrating " << animationsJson.size()
                           << " hierarchical animation definitions" << std::endl;
             }
 
@@ -1486,9 +1499,17 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
                             auto& keyframeObj = builder.addCore(keyframeCore);
                             pendingObjects.push_back({&keyframeObj, keyframeTypeKey, std::nullopt, invalidParent});
 
-                            builder.set(keyframeObj, rive::KeyFrameBase::framePropertyKey, keyframeData.frame);
-                            builder.set(keyframeObj, rive::InterpolatingKeyFrameBase::interpolationTypePropertyKey,
-                                        keyframeData.interpolationType);
+                            // Leave properties at the runtime's initial value unset so
+                            // they aren't serialized.
+                            if (keyframeData.frame != 0)
+                            {
+                                builder.set(keyframeObj, rive::KeyFrameBase::framePropertyKey, keyframeData.frame);
+                            }
+                            if (keyframeData.interpolationType != 0)
+                            {
+                                builder.set(keyframeObj, rive::InterpolatingKeyFrameBase::interpolationTypePropertyKey,
+                                            keyframeData.interpolationType);
+                            }
 
                             if (keyframeData.interpolatorId.has_value())
                             {
@@ -1713,7 +1734,7 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
                 // Parent can be: Artboard (1), Node (2), or unknown types
                 if (pType != 3) {
                     needsShapeContainer = true;
-                    std::cout << "  [auto] Paint typeKey=" << typeKey 
+                    log_stream() << "  [auto] Paint typeKey=" << typeKey 
                               << " localId=" << (localId.has_value() ? *localId : 0)
                               << " parent=" << parentLocalId 
                               << " (type=" << pType << ") → inject Shape" << std::endl;
@@ -1765,7 +1786,7 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
                     }
                 }
 
-                std::cout << "  [auto] Inserted Shape container (localId " << shapeLocalId
+                log_stream() << "  [auto] Inserted Shape container (localId " << shapeLocalId
                           << ") for parametric path localId "
                           << (localId.has_value() ? *localId : 0u) << std::endl;
 
@@ -1939,7 +1960,7 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
                                          rive::TrimPathMode::sequential));
                     }
                     
-                    std::cout << "  ℹ️  TrimPath localId=" << (localId.has_value() ? *localId : 0)
+                    log_stream() << "  ℹ️  TrimPath localId=" << (localId.has_value() ? *localId : 0)
                               << " → defaults injected (114,115,116,117)" << std::endl;
                 }
             }
@@ -1991,7 +2012,7 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
 
                 if (!hasDistance || !hasOrient || !hasOffset || 
                     !hasTargetId || !hasSourceSpace || !hasDestSpace) {
-                    std::cout << "  ℹ️  FollowPathConstraint localId="
+                    log_stream() << "  ℹ️  FollowPathConstraint localId="
                               << (localId.has_value() ? *localId : 0)
                               << " → defaults injected (173,179,180,363,364,365)" << std::endl;
                 }
@@ -2158,7 +2179,7 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
 
         if (hierarchicalAnimationsCreated > 0)
         {
-            std::cout << "  → Added " << hierarchicalAnimationsCreated << " animations"
+            log_stream() << "  → Added " << hierarchicalAnimationsCreated << " animations"
                       << " (keyedObjects=" << hierarchicalKeyedObjectsCreated
                       << ", keyedProperties=" << hierarchicalKeyedPropertiesCreated
                       << ", interpolators=" << hierarchicalInterpolatorsCreated
@@ -2593,31 +2614,31 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
         }
 
         // PR2: Print diagnostic summary for keyed data
-        std::cout << "\n  === PR2 KEYED DATA DIAGNOSTICS ===" << std::endl;
-        std::cout << "  OMIT_KEYED flag: " << (OMIT_KEYED ? "ENABLED (keyed data skipped)" : "DISABLED (keyed data included)") << std::endl;
-        std::cout << "  LinearAnimation count: " << linearAnimCount << std::endl;
-        std::cout << "  StateMachine count: " << stateMachineCount << std::endl;
+        log_stream() << "\n  === PR2 KEYED DATA DIAGNOSTICS ===" << std::endl;
+        log_stream() << "  OMIT_KEYED flag: " << (OMIT_KEYED ? "ENABLED (keyed data skipped)" : "DISABLED (keyed data included)") << std::endl;
+        log_stream() << "  LinearAnimation count: " << linearAnimCount << std::endl;
+        log_stream() << "  StateMachine count: " << stateMachineCount << std::endl;
         
         if (!keyedInJson.empty()) {
-            std::cout << "\n  Keyed types in JSON:" << std::endl;
+            log_stream() << "\n  Keyed types in JSON:" << std::endl;
             int totalKeyedInJson = 0;
             for (const auto& [tk, count] : keyedInJson) {
-                std::cout << "    typeKey " << tk << ": " << count << std::endl;
+                log_stream() << "    typeKey " << tk << ": " << count << std::endl;
                 totalKeyedInJson += count;
             }
-            std::cout << "  Total keyed in JSON: " << totalKeyedInJson << std::endl;
+            log_stream() << "  Total keyed in JSON: " << totalKeyedInJson << std::endl;
         }
         
         if (!keyedCreated.empty()) {
-            std::cout << "\n  Keyed types created:" << std::endl;
+            log_stream() << "\n  Keyed types created:" << std::endl;
             int totalKeyedCreated = 0;
             for (const auto& [tk, count] : keyedCreated) {
-                std::cout << "    typeKey " << tk << ": " << count << std::endl;
+                log_stream() << "    typeKey " << tk << ": " << count << std::endl;
                 totalKeyedCreated += count;
             }
-            std::cout << "  Total keyed created: " << totalKeyedCreated << std::endl;
+            log_stream() << "  Total keyed created: " << totalKeyedCreated << std::endl;
         } else if (OMIT_KEYED && !keyedInJson.empty()) {
-            std::cout << "  Keyed types created: 0 (all skipped by OMIT_KEYED)" << std::endl;
+            log_stream() << "  Keyed types created: 0 (all skipped by OMIT_KEYED)" << std::endl;
         }
         
         if (linearAnimCount > 0 && !keyedInJson.empty()) {
@@ -2626,12 +2647,12 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
                 totalKeyed += count;
             }
             double avgPerAnim = static_cast<double>(totalKeyed) / linearAnimCount;
-            std::cout << "  Avg keyed objects per animation: " << avgPerAnim << std::endl;
+            log_stream() << "  Avg keyed objects per animation: " << avgPerAnim << std::endl;
         }
-        std::cout << "  =================================\n" << std::endl;
+        log_stream() << "  =================================\n" << std::endl;
         
         // PASS 1.5: Auto-fix orphan Fill/Stroke (PR-ORPHAN-FIX)
-        std::cout << "  PASS 1.5: Fixing orphan paints..." << std::endl;
+        log_stream() << "  PASS 1.5: Fixing orphan paints..." << std::endl;
         
         int orphanFixed = 0;
         std::vector<PendingObject> newShapes;
@@ -2697,10 +2718,10 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
             pendingObjects.push_back(newShape);
         }
         
-        std::cout << "  ✅ Fixed " << orphanFixed << " orphan paints" << std::endl;
+        log_stream() << "  ✅ Fixed " << orphanFixed << " orphan paints" << std::endl;
         
         // PASS 2: Set all parent relationships (now with complete type mapping and synthetic shapes)
-        std::cout << "  PASS 2: Setting parent relationships for " << pendingObjects.size() << " objects..." << std::endl;
+        log_stream() << "  PASS 2: Setting parent relationships for " << pendingObjects.size() << " objects..." << std::endl;
         int successCount = 0;
         int missingParentCount = 0;
         
@@ -2731,32 +2752,32 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
                 missingParentCount++;
             }
         }
-        std::cout << "  ✅ Set " << successCount << " parent relationships" << std::endl;
+        log_stream() << "  ✅ Set " << successCount << " parent relationships" << std::endl;
         if (missingParentCount > 0) {
             std::cerr << "  ⚠️  " << missingParentCount << " objects have missing parents (check cascade skip logic)" << std::endl;
         }
         
         // PR2/PR3: Debug summary
-        std::cout << "\n  === PR2 Hierarchy Debug Summary ===" << std::endl;
-        std::cout << "  Shapes inserted:         " << shapeInserted << std::endl;
-        std::cout << "  Paints moved:            " << paintsMoved << std::endl;
-        std::cout << "  Vertices kept:           " << verticesKept << std::endl;
-        std::cout << "  Vertex remap attempted:  " << vertexRemapAttempted << " (should be 0)" << std::endl;
-        std::cout << "  AnimNode remap attempted: " << animNodeRemapAttempted << " (should be 0)" << std::endl;
+        log_stream() << "\n  === PR2 Hierarchy Debug Summary ===" << std::endl;
+        log_stream() << "  Shapes inserted:         " << shapeInserted << std::endl;
+        log_stream() << "  Paints moved:            " << paintsMoved << std::endl;
+        log_stream() << "  Vertices kept:           " << verticesKept << std::endl;
+        log_stream() << "  Vertex remap attempted:  " << vertexRemapAttempted << " (should be 0)" << std::endl;
+        log_stream() << "  AnimNode remap attempted: " << animNodeRemapAttempted << " (should be 0)" << std::endl;
         if (vertexRemapAttempted > 0 || animNodeRemapAttempted > 0) {
             std::cerr << "  ⚠️  WARNING: Blacklist violation detected!" << std::endl;
         }
-        std::cout << "  ===================================\n" << std::endl;
+        log_stream() << "  ===================================\n" << std::endl;
         
         // PR3: Animation graph summary
-        std::cout << "  === PR3 Animation Graph Summary ===" << std::endl;
-        std::cout << "  KeyedObjects:            " << keyedObjectCount << std::endl;
-        std::cout << "  KeyedProperties:         " << keyedPropertyCount << std::endl;
-        std::cout << "  KeyFrames:               " << keyFrameCount << std::endl;
-        std::cout << "  Interpolators:           " << interpolatorCount << std::endl;
-        std::cout << "  objectId remap success:  " << objectIdRemapSuccess << std::endl;
-        std::cout << "  objectId remap fail:     " << objectIdRemapFail << " (should be 0)" << std::endl;
-        std::cout << "  ===================================\n" << std::endl;
+        log_stream() << "  === PR3 Animation Graph Summary ===" << std::endl;
+        log_stream() << "  KeyedObjects:            " << keyedObjectCount << std::endl;
+        log_stream() << "  KeyedProperties:         " << keyedPropertyCount << std::endl;
+        log_stream() << "  KeyFrames:               " << keyFrameCount << std::endl;
+        log_stream() << "  Interpolators:           " << interpolatorCount << std::endl;
+        log_stream() << "  objectId remap success:  " << objectIdRemapSuccess << std::endl;
+        log_stream() << "  objectId remap fail:     " << objectIdRemapFail << " (should be 0)" << std::endl;
+        log_stream() << "  ===================================\n" << std::endl;
         
         // PASS 3: Remap deferred targetId references (after all objects created)
         int targetIdRemapSuccess = 0;
@@ -2773,10 +2794,10 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
             }
         }
         if (!deferredTargetIds.empty()) {
-            std::cout << "  === Constraint targetId Remapping ===" << std::endl;
-            std::cout << "  targetId remap success:  " << targetIdRemapSuccess << std::endl;
-            std::cout << "  targetId remap fail:     " << targetIdRemapFail << " (should be 0)" << std::endl;
-            std::cout << "  ===================================\n" << std::endl;
+            log_stream() << "  === Constraint targetId Remapping ===" << std::endl;
+            log_stream() << "  targetId remap success:  " << targetIdRemapSuccess << std::endl;
+            log_stream() << "  targetId remap fail:     " << targetIdRemapFail << " (should be 0)" << std::endl;
+            log_stream() << "  ===================================\n" << std::endl;
         }
         
         // PR-DRAWTARGET: PASS 3 - Remap DrawTarget/DrawRules component references
@@ -2826,19 +2847,19 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
         
         if (drawTargetRemapSuccess > 0 || drawTargetRemapFail > 0 || 
             drawRulesRemapSuccess > 0 || drawRulesRemapFail > 0) {
-            std::cout << "  === DrawTarget/DrawRules Remapping ===" << std::endl;
-            std::cout << "  DrawTarget.drawableId success: " << drawTargetRemapSuccess << std::endl;
-            std::cout << "  DrawTarget.drawableId fail:    " << drawTargetRemapFail << " (should be 0)" << std::endl;
-            std::cout << "  DrawRules.drawTargetId success: " << drawRulesRemapSuccess << std::endl;
-            std::cout << "  DrawRules.drawTargetId fail:    " << drawRulesRemapFail << " (should be 0)" << std::endl;
-            std::cout << "  ======================================\n" << std::endl;
+            log_stream() << "  === DrawTarget/DrawRules Remapping ===" << std::endl;
+            log_stream() << "  DrawTarget.drawableId success: " << drawTargetRemapSuccess << std::endl;
+            log_stream() << "  DrawTarget.drawableId fail:    " << drawTargetRemapFail << " (should be 0)" << std::endl;
+            log_stream() << "  DrawRules.drawTargetId success: " << drawRulesRemapSuccess << std::endl;
+            log_stream() << "  DrawRules.drawTargetId fail:    " << drawRulesRemapFail << " (should be 0)" << std::endl;
+            log_stream() << "  ======================================\n" << std::endl;
         }
         
         if (interpolatorIdRemapSuccess > 0 || interpolatorIdRemapFail > 0) {
-            std::cout << "  === KeyFrame interpolatorId Remapping ===" << std::endl;
-            std::cout << "  interpolatorId remap success: " << interpolatorIdRemapSuccess << std::endl;
-            std::cout << "  interpolatorId remap fail:    " << interpolatorIdRemapFail << " (should be 0)" << std::endl;
-            std::cout << "  =========================================\n" << std::endl;
+            log_stream() << "  === KeyFrame interpolatorId Remapping ===" << std::endl;
+            log_stream() << "  interpolatorId remap success: " << interpolatorIdRemapSuccess << std::endl;
+            log_stream() << "  interpolatorId remap fail:    " << interpolatorIdRemapFail << " (should be 0)" << std::endl;
+            log_stream() << "  =========================================\n" << std::endl;
         }
         
         // PR2c: Cycle detection on component parent graph
@@ -2888,7 +2909,7 @@ CoreDocument build_from_universal_json(const nlohmann::json& data, PropertyTypeM
         }
         if (!anyCycle)
         {
-            std::cout << "  🧭 No cycles detected in component graph" << std::endl;
+            log_stream() << "  🧭 No cycles detected in component graph" << std::endl;
         }
         
         // Animation and StateMachine building moved inline after Artboard creation (see above)
@@ -27,12 +27,23 @@ public:
 private:
     uint32_t m_Width;
     uint32_t m_Height;
+    uint32_t m_SourceWidth;
+    uint32_t m_SourceHeight;
     PixelFormat m_PixelFormat;
     std::unique_ptr<const uint8_t[]> m_Bytes;
 
 public:
     uint32_t width() const { return m_Width; }
     uint32_t height() const { return m_Height; }
+    // Size of the encoded image, which is larger than width() and height()
+    // when it was decoded or downsampled to a smaller target size.
+    uint32_t sourceWidth() const { return m_SourceWidth; }
+    uint32_t sourceHeight() const { return m_SourceHeight; }
+    void sourceSize(uint32_t width, uint32_t height)
+    {
+        m_SourceWidth = width;
+        m_SourceHeight = height;
+    }
     PixelFormat pixelFormat() const { return m_PixelFormat; }
     const uint8_t* bytes() const { return m_Bytes.get(); }
     std::unique_ptr<const uint8_t[]> detachBytes()
@@ -47,8 +58,13 @@ public:
         webp,
     };
 
+    // Decoders may return a bitmap smaller than the encoded image, but never
+    // smaller than targetWidth x targetHeight. A target of 0 x 0 decodes at
+    // full size.
     using BitmapDecoder = std::unique_ptr<Bitmap> (*)(const uint8_t bytes[],
-                                                      size_t byteCount);
+                                                      size_t byteCount,
+                                                      uint32_t targetWidth,
+                                                      uint32_t targetHeight);
 
     struct ImageFormat
     {
@@ -64,8 +80,28 @@ public:
     static std::unique_ptr<Bitmap> decode(const uint8_t bytes[],
                                           size_t byteCount);
 
+    // Decodes at the smallest size the format supports cheaply that still
+    // covers targetWidth x targetHeight, keeping the aspect ratio. JPEGs use
+    // DCT scaling, WebPs scaled decoding and everything else is decoded at
+    // full size and then downsampled. Images are never upscaled.
+    static std::unique_ptr<Bitmap> decode(const uint8_t bytes[],
+                                          size_t byteCount,
+                                          uint32_t targetWidth,
+                                          uint32_t targetHeight);
+
     // Change the pixel format (note this will resize bytes).
     void pixelFormat(PixelFormat format);
+
+    // Halves the bitmap with a 2x2 box filter for as long as it stays at least
+    // targetWidth x targetHeight. RGBA bitmaps are premultiplied first.
+    void downsample(uint32_t targetWidth, uint32_t targetHeight);
+
+    // How many times width x height can be halved while staying at least
+    // targetWidth x targetHeight. A target of 0 x 0 never halves.
+    static uint32_t DownsampleCount(uint32_t width,
+                                    uint32_t height,
+                                    uint32_t targetWidth,
+                                    uint32_t targetHeight);
 };
 
 #endif
@@ -5,6 +5,7 @@
 #include "rive/decoders/bitmap_decoder.hpp"
 #include "rive/rive_types.hpp"
 #include "rive/math/simd.hpp"
+#include <algorithm>
 #include <stdio.h>
 #include <string.h>
 
@@ -14,6 +15,8 @@ Bitmap::Bitmap(uint32_t width,
                std::unique_ptr<const uint8_t[]> bytes) :
     m_Width(width),
     m_Height(height),
+    m_SourceWidth(width),
+    m_SourceHeight(height),
     m_PixelFormat(pixelFormat),
     m_Bytes(std::move(bytes))
 {}
@@ -95,3 +98,101 @@ void Bitmap::pixelFormat(PixelFormat format)
     m_Bytes = std::move(toBytes);
     m_PixelFormat = format;
 }
+
+uint32_t Bitmap::DownsampleCount(uint32_t width,
+                                 uint32_t height,
+                                 uint32_t targetWidth,
+                                 uint32_t targetHeight)
+{
+    if (targetWidth == 0 && targetHeight == 0)
+    {
+        return 0;
+    }
+    uint32_t count = 0;
+    while (width > 1 && height > 1 && width / 2 >= targetWidth &&
+           height / 2 >= targetHeight)
+    {
+        width /= 2;
+        height /= 2;
+        count++;
+    }
+    return count;
+}
+
+// Averages each 2x2 block of pixels. An odd trailing row or column is
+// dropped, except when the size is 1, where it's averaged with itself.
+static std::unique_ptr<Bitmap> half_size(const Bitmap& bitmap)
+{
+    uint32_t width = bitmap.width();
+    uint32_t height = bitmap.height();
+    uint32_t halfWidth = std::max(width / 2, 1u);
+    uint32_t halfHeight = std::max(height / 2, 1u);
+    size_t bytesPerPixel = bytes_per_pixel(bitmap.pixelFormat());
+    size_t rowBytes = width * bytesPerPixel;
+    auto halfBytes = std::unique_ptr<uint8_t[]>(
+        new uint8_t[(size_t)halfWidth * halfHeight * bytesPerPixel]);
+
+    const uint8_t* src = bitmap.bytes();
+    uint8_t* dst = halfBytes.get();
+    for (uint32_t y = 0; y < halfHeight; y++)
+    {
+        const uint8_t* row0 = src + std::min(y * 2, height - 1) * rowBytes;
+        const uint8_t* row1 = src + std::min(y * 2 + 1, height - 1) * rowBytes;
+        for (uint32_t x = 0; x < halfWidth; x++)
+        {
+            size_t x0 = std::min(x * 2, width - 1) * bytesPerPixel;
+            size_t x1 = std::min(x * 2 + 1, width - 1) * bytesPerPixel;
+            if (bytesPerPixel == 4)
+            {
+                rive::uint16x4 sum =
+                    rive::simd::cast<uint16_t>(
+                        rive::simd::load<uint8_t, 4>(row0 + x0)) +
+                    rive::simd::cast<uint16_t>(
+                        rive::simd::load<uint8_t, 4>(row0 + x1)) +
+                    rive::simd::cast<uint16_t>(
+                        rive::simd::load<uint8_t, 4>(row1 + x0)) +
+                    rive::simd::cast<uint16_t>(
+                        rive::simd::load<uint8_t, 4>(row1 + x1));
+                rive::simd::store(dst,
+                                  rive::simd::cast<uint8_t>((sum + 2) >> 2));
+            }
+            else
+            {
+                for (size_t c = 0; c < bytesPerPixel; c++)
+                {
+                    dst[c] = (uint8_t)((row0[x0 + c] + row0[x1 + c] +
+                                        row1[x0 + c] + row1[x1 + c] + 2) >>
+                                       2);
+                }
+            }
+            dst += bytesPerPixel;
+        }
+    }
+
+    auto half = std::make_unique<Bitmap>(halfWidth,
+                                         halfHeight,
+                                         bitmap.pixelFormat(),
+                                         std::move(halfBytes));
+    half->sourceSize(bitmap.sourceWidth(), bitmap.sourceHeight());
+    return half;
+}
+
+void Bitmap::downsample(uint32_t targetWidth, uint32_t targetHeight)
+{
+    uint32_t count =
+        DownsampleCount(m_Width, m_Height, targetWidth, targetHeight);
+    if (count > 0 && m_PixelFormat == PixelFormat::RGBA)
+    {
+        // Averaging straight alpha lets the color of transparent pixels bleed
+        // into their neighbors, e.g. a white fringe around an opaque shape on
+        // a transparent white background.
+        pixelFormat(PixelFormat::RGBAPremul);
+    }
+    for (uint32_t i = 0; i < count; i++)
+    {
+        auto half = half_size(*this);
+        m_Width = half->width();
+        m_Height = half->height();
+        m_Bytes = half->detachBytes();
+    }
+}
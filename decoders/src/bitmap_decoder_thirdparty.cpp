@@ -25,13 +25,22 @@
 #include <vector>
 
 #ifdef RIVE_PNG
-std::unique_ptr<Bitmap> DecodePng(const uint8_t bytes[], size_t byteCount);
+std::unique_ptr<Bitmap> DecodePng(const uint8_t bytes[],
+                                 size_t byteCount,
+                                 uint32_t targetWidth,
+                                 uint32_t targetHeight);
 #endif
 #ifdef RIVE_JPEG
-std::unique_ptr<Bitmap> DecodeJpeg(const uint8_t bytes[], size_t byteCount);
+std::unique_ptr<Bitmap> DecodeJpeg(const uint8_t bytes[],
+                                 size_t byteCount,
+                                 uint32_t targetWidth,
+                                 uint32_t targetHeight);
 #endif
 #ifdef RIVE_WEBP
-std::unique_ptr<Bitmap> DecodeWebP(const uint8_t bytes[], size_t byteCount);
+std::unique_ptr<Bitmap> DecodeWebP(const uint8_t bytes[],
+                                 size_t byteCount,
+                                 uint32_t targetWidth,
+                                 uint32_t targetHeight);
 #endif
 
 static Bitmap::ImageFormat _formats[] = {
@@ -181,7 +190,10 @@ bool cg_image_decode(const uint8_t* encodedBytes,
     return true;
 }
 
-std::unique_ptr<Bitmap> Bitmap::decode(const uint8_t bytes[], size_t byteCount)
+std::unique_ptr<Bitmap> Bitmap::decode(const uint8_t bytes[],
+                                       size_t byteCount,
+                                       uint32_t targetWidth,
+                                       uint32_t targetHeight)
 {
     PlatformCGImage image;
     if (!cg_image_decode(bytes, byteCount, &image))
@@ -192,7 +204,10 @@ std::unique_ptr<Bitmap> Bitmap::decode(const uint8_t bytes[], size_t byteCount)
         if (format != nullptr)
         {
             auto bitmap = format->decodeImage != nullptr
-                              ? format->decodeImage(bytes, byteCount)
+                              ? format->decodeImage(bytes,
+                                                    byteCount,
+                                                    targetWidth,
+                                                    targetHeight)
                               : nullptr;
             return bitmap;
         }
@@ -200,20 +215,28 @@ std::unique_ptr<Bitmap> Bitmap::decode(const uint8_t bytes[], size_t byteCount)
         return nullptr;
     }
 
-    return std::make_unique<Bitmap>(image.width,
-                                    image.height,
-                                    // CG always premultiplies alpha.
-                                    PixelFormat::RGBAPremul,
-                                    std::move(image.pixels));
+    auto bitmap = std::make_unique<Bitmap>(image.width,
+                                           image.height,
+                                           // CG always premultiplies alpha.
+                                           PixelFormat::RGBAPremul,
+                                           std::move(image.pixels));
+    bitmap->downsample(targetWidth, targetHeight);
+    return bitmap;
 }
 #else
-std::unique_ptr<Bitmap> Bitmap::decode(const uint8_t bytes[], size_t byteCount)
+std::unique_ptr<Bitmap> Bitmap::decode(const uint8_t bytes[],
+                                       size_t byteCount,
+                                       uint32_t targetWidth,
+                                       uint32_t targetHeight)
 {
     const ImageFormat* format = RecognizeImageFormat(bytes, byteCount);
     if (format != nullptr)
     {
         auto bitmap = format->decodeImage != nullptr
-                          ? format->decodeImage(bytes, byteCount)
+                          ? format->decodeImage(bytes,
+                                                byteCount,
+                                                targetWidth,
+                                                targetHeight)
                           : nullptr;
         if (!bitmap)
         {
@@ -226,3 +249,8 @@ std::unique_ptr<Bitmap> Bitmap::decode(const uint8_t bytes[], size_t byteCount)
     return nullptr;
 }
 #endif
+
+std::unique_ptr<Bitmap> Bitmap::decode(const uint8_t bytes[], size_t byteCount)
+{
+    return decode(bytes, byteCount, 0, 0);
+}
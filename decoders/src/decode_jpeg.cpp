@@ -31,7 +31,10 @@ void my_error_exit(j_common_ptr cinfo)
     longjmp(myerr->setjmp_buffer, 1);
 }
 
-std::unique_ptr<Bitmap> DecodeJpeg(const uint8_t bytes[], size_t byteCount)
+std::unique_ptr<Bitmap> DecodeJpeg(const uint8_t bytes[],
+                                   size_t byteCount,
+                                   uint32_t targetWidth,
+                                   uint32_t targetHeight)
 {
     struct jpeg_decompress_struct cinfo;
     struct my_error_mgr jerr;
@@ -71,6 +74,16 @@ std::unique_ptr<Bitmap> DecodeJpeg(const uint8_t bytes[], size_t byteCount)
     cinfo.data_precision = 8;
     cinfo.out_color_space = JCS_RGB;
 
+    // Let the IDCT produce a 1/2, 1/4 or 1/8 scale image directly instead of
+    // decoding every pixel of a large photo that's drawn small.
+    uint32_t halvings = std::min(Bitmap::DownsampleCount(cinfo.image_width,
+                                                         cinfo.image_height,
+                                                         targetWidth,
+                                                         targetHeight),
+                                 3u);
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = 1u << halvings;
+
     // Step 5: Start decompressor
     jpeg_start_decompress(&cinfo);
 
@@ -124,8 +137,12 @@ std::unique_ptr<Bitmap> DecodeJpeg(const uint8_t bytes[], size_t byteCount)
     // Step 8: Release JPEG decompression object
     jpeg_destroy_decompress(&cinfo);
 
-    return std::make_unique<Bitmap>(cinfo.output_width,
-                                    cinfo.output_height,
-                                    Bitmap::PixelFormat::RGB,
-                                    std::move(pixelBuffer));
+    auto bitmap = std::make_unique<Bitmap>(cinfo.output_width,
+                                           cinfo.output_height,
+                                           Bitmap::PixelFormat::RGB,
+                                           std::move(pixelBuffer));
+    bitmap->sourceSize(cinfo.image_width, cinfo.image_height);
+    // DCT scaling stops at 1/8, box filter any further.
+    bitmap->downsample(targetWidth, targetHeight);
+    return bitmap;
 }
\ No newline at end of file
@@ -38,7 +38,10 @@ static void ReadDataFromMemory(png_structp png_ptr,
     }
 }
 
-std::unique_ptr<Bitmap> DecodePng(const uint8_t bytes[], size_t byteCount)
+std::unique_ptr<Bitmap> DecodePng(const uint8_t bytes[],
+                                  size_t byteCount,
+                                  uint32_t targetWidth,
+                                  uint32_t targetHeight)
 {
     png_structp png_ptr;
     png_infop info_ptr;
@@ -153,8 +156,11 @@ std::unique_ptr<Bitmap> DecodePng(const uint8_t bytes[], size_t byteCount)
             pixelFormat = Bitmap::PixelFormat::RGB;
             break;
     }
-    return std::make_unique<Bitmap>(width,
-                                    height,
-                                    pixelFormat,
-                                    std::move(pixelBuffer));
+    auto bitmap = std::make_unique<Bitmap>(width,
+                                           height,
+                                           pixelFormat,
+                                           std::move(pixelBuffer));
+    // libpng can't decode at a reduced size, so box filter the full image.
+    bitmap->downsample(targetWidth, targetHeight);
+    return bitmap;
 }
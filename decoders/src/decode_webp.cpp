@@ -1,11 +1,16 @@
 #include "rive/decoders/bitmap_decoder.hpp"
 #include "webp/decode.h"
 #include "webp/demux.h"
+#include <algorithm>
+#include <cmath>
 #include <stdio.h>
 #include <vector>
 #include <memory>
 
-std::unique_ptr<Bitmap> DecodeWebP(const uint8_t bytes[], size_t byteCount)
+std::unique_ptr<Bitmap> DecodeWebP(const uint8_t bytes[],
+                                   size_t byteCount,
+                                   uint32_t targetWidth,
+                                   uint32_t targetHeight)
 {
     WebPDecoderConfig config;
     if (!WebPInitDecoderConfig(&config))
@@ -38,8 +43,23 @@ std::unique_ptr<Bitmap> DecodeWebP(const uint8_t bytes[], size_t byteCount)
     }
     config.output.colorspace = MODE_RGBA;
 
-    uint32_t width = WebPDemuxGetI(demuxer, WEBP_FF_CANVAS_WIDTH);
-    uint32_t height = WebPDemuxGetI(demuxer, WEBP_FF_CANVAS_HEIGHT);
+    uint32_t sourceWidth = WebPDemuxGetI(demuxer, WEBP_FF_CANVAS_WIDTH);
+    uint32_t sourceHeight = WebPDemuxGetI(demuxer, WEBP_FF_CANVAS_HEIGHT);
+    uint32_t width = sourceWidth;
+    uint32_t height = sourceHeight;
+
+    // The WebP decoder resamples while decoding, so we can ask for exactly
+    // the smallest size that covers the target.
+    float scale = std::max((float)targetWidth / (float)sourceWidth,
+                           (float)targetHeight / (float)sourceHeight);
+    if (scale > 0.0f && scale < 1.0f)
+    {
+        width = std::max((uint32_t)std::ceil(sourceWidth * scale), 1u);
+        height = std::max((uint32_t)std::ceil(sourceHeight * scale), 1u);
+        config.options.use_scaling = 1;
+        config.options.scaled_width = (int)width;
+        config.options.scaled_height = (int)height;
+    }
 
     size_t pixelBufferSize = static_cast<size_t>(width) *
                              static_cast<size_t>(height) *
@@ -65,8 +85,10 @@ std::unique_ptr<Bitmap> DecodeWebP(const uint8_t bytes[], size_t byteCount)
     WebPDemuxReleaseIterator(&currentFrame);
     WebPDemuxDelete(demuxer);
 
-    return std::make_unique<Bitmap>(width,
-                                    height,
-                                    Bitmap::PixelFormat::RGBA,
-                                    std::move(pixelBuffer));
+    auto bitmap = std::make_unique<Bitmap>(width,
+                                           height,
+                                           Bitmap::PixelFormat::RGBA,
+                                           std::move(pixelBuffer));
+    bitmap->sourceSize(sourceWidth, sourceHeight);
+    return bitmap;
 }
\ No newline at end of file
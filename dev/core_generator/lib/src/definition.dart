@@ -490,6 +490,17 @@ class Definition {
     }
     ctxCode.writeln('} return nullptr; }');
 
+    ctxCode.writeln('static size_t objectSize(int typeKey) {'
+        'switch(typeKey) {');
+    for (final definition in runtimeDefinitions) {
+      if (definition._isAbstract) {
+        continue;
+      }
+      ctxCode.writeln('case ${definition.name}Base::typeKey:');
+      ctxCode.writeln('return sizeof(${definition.name});');
+    }
+    ctxCode.writeln('} return 0; }');
+
     var usedFieldTypes = <FieldType, List<Property>>{};
     var getSetFieldTypes = <FieldType, List<Property>>{};
     for (final definition in runtimeDefinitions) {
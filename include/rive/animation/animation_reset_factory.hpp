@@ -10,6 +10,28 @@
 
 namespace rive
 {
+class KeyedObject;
+class KeyedObjectData;
+
+/// The keyed properties touched by a set of animations. It only depends on
+/// the animations, not on the artboard's current values, so it can be kept
+/// and used to build resets for the same animations repeatedly.
+class AnimationsData
+{
+public:
+    AnimationsData(std::vector<const LinearAnimation*>& animations,
+                   bool useFirstAsBaseline);
+    ~AnimationsData();
+    void writeObjects(AnimationReset* animationReset,
+                      ArtboardInstance* artboard);
+
+private:
+    KeyedObjectData* getKeyedObjectData(const KeyedObject* keyedObject);
+    void findKeyedObjects(const LinearAnimation* animation,
+                          bool isFirstAnimation);
+
+    std::vector<std::unique_ptr<KeyedObjectData>> keyedObjectsData;
+};
 
 class AnimationResetFactory
 {
@@ -26,6 +48,12 @@ public:
         StateInstance* stateFrom,
         StateInstance* currentState,
         ArtboardInstance* artboard);
+    static std::unique_ptr<AnimationsData> dataFromStates(
+        StateInstance* stateFrom,
+        StateInstance* currentState);
+    static std::unique_ptr<AnimationReset> fromData(
+        AnimationsData* animationsData,
+        ArtboardInstance* artboard);
     static std::unique_ptr<AnimationReset> fromAnimations(
         std::vector<const LinearAnimation*>& animations,
         ArtboardInstance* artboard,
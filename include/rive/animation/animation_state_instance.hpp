@@ -26,6 +26,7 @@ public:
 
     bool keepGoing() const override;
     void clearSpilledTime() override;
+    void reset() override;
 
     const LinearAnimationInstance* animationInstance() const
     {
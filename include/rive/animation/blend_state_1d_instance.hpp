@@ -16,6 +16,8 @@ private:
     BlendStateAnimationInstance<BlendAnimation1D>* m_From = nullptr;
     BlendStateAnimationInstance<BlendAnimation1D>* m_To = nullptr;
     std::unique_ptr<AnimationReset> m_AnimationReset;
+    std::unique_ptr<AnimationsData> m_AnimationsData;
+    ArtboardInstance* m_ArtboardInstance;
     int animationIndex(float value);
 
 public:
@@ -25,6 +27,8 @@ public:
     void advance(float seconds,
                  StateMachineInstance* stateMachineInstance) override;
     void apply(ArtboardInstance* instance, float mix) override;
+    void recycle() override;
+    void reset() override;
 };
 } // namespace rive
 #endif
\ No newline at end of file
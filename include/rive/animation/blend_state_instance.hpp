@@ -72,6 +72,16 @@ public:
 
     bool keepGoing() const override { return m_KeepGoing; }
 
+    void reset() override
+    {
+        for (auto& animation : m_AnimationInstances)
+        {
+            animation.m_AnimationInstance.restart(1.0f);
+            animation.m_Mix = 0.0f;
+        }
+        m_KeepGoing = true;
+    }
+
     void advance(float seconds,
                  StateMachineInstance* stateMachineInstance) override
     {
@@ -19,7 +19,11 @@ class LayerState : public LayerStateBase
 
 private:
     std::vector<StateTransition*> m_Transitions;
+    std::vector<uint32_t> m_transitionInputIds;
+    bool m_transitionsReadViewModel = false;
+    bool m_transitionsDependOnValues = false;
     void addTransition(StateTransition* transition);
+    void buildTransitionDependencies();
 
 public:
     ~LayerState() override;
@@ -38,6 +42,22 @@ public:
         return nullptr;
     }
 
+    /// True when whether any outgoing transition is allowed only depends on
+    /// the inputs in transitionInputIds() and, if transitionsReadViewModel(),
+    /// on the state machine's bound view model values. False when a
+    /// transition uses exit time, random weights or reads anything else
+    /// (like artboard properties), in which case the transitions must be
+    /// evaluated every advance.
+    bool transitionsDependOnValues() const
+    {
+        return m_transitionsDependOnValues;
+    }
+    const std::vector<uint32_t>& transitionInputIds() const
+    {
+        return m_transitionInputIds;
+    }
+    bool transitionsReadViewModel() const { return m_transitionsReadViewModel; }
+
     /// Make an instance of this state that can be advanced and applied by
     /// the state machine when it is active or being transitioned from.
     virtual std::unique_ptr<StateInstance> makeInstance(
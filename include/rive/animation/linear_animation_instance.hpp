@@ -106,6 +106,9 @@ public:
     bool advanceAndApply(float seconds) override;
     std::string name() const override;
     void reset(float speedMultiplier);
+    // Returns the instance to the state it was constructed in, so it can be
+    // reused instead of allocating a new one.
+    void restart(float speedMultiplier);
     void reportEvent(Event* event, float secondsDelay = 0.0f) override;
 
 private:
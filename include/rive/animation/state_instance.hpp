@@ -30,6 +30,14 @@ public:
     virtual bool keepGoing() const = 0;
     virtual void clearSpilledTime() {}
 
+    /// Called when the layer stops using this instance but keeps it to reuse
+    /// for a later transition into the same state. Gives back anything
+    /// borrowed from shared pools.
+    virtual void recycle() {}
+
+    /// Returns a recycled instance to the state it was created in.
+    virtual void reset() {}
+
     const LayerState* state() const;
 };
 } // namespace rive
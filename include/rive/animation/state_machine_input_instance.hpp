@@ -40,6 +40,9 @@ public:
 private:
     StateMachineInstance* m_machineInstance;
     const StateMachineInput* m_input;
+    // Machine change stamp of the last time the value changed, used to skip
+    // re-evaluating transitions that only read unchanged inputs.
+    uint64_t m_changeStamp = 0;
 #ifdef WITH_RIVE_TOOLS
     uint64_t m_index = 0;
 #endif
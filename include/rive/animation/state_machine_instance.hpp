@@ -11,6 +11,7 @@
 #include "rive/core/field_types/core_callback_type.hpp"
 #include "rive/hit_result.hpp"
 #include "rive/listener_type.hpp"
+#include "rive/memory_usage.hpp"
 #include "rive/nested_animation.hpp"
 #include "rive/scene.hpp"
 
@@ -97,6 +98,22 @@ public:
     // Returns true when the StateMachineInstance has more data to process.
     bool needsAdvance() const;
 
+    // When enabled, an advanceAndApply that finds nothing left to animate
+    // puts the instance to sleep. Further advanceAndApply calls return false
+    // immediately until something wakes it: an input change, a pointer
+    // event, a reported event, a dirty data bind or component (in this
+    // artboard or a nested one), or an explicit wake(). Off by default.
+    void sleepWhenSettled(bool value);
+    bool sleepWhenSettled() const { return m_sleepWhenSettled; }
+    bool isSleeping() const { return m_sleeping && !shouldWake(); }
+    void wake() { m_sleeping = false; }
+
+    // Seconds until the instance needs advanceAndApply again: 0 while
+    // awake, infinity while asleep. Nothing time based can run while
+    // settled so hosts can skip advancing (and redrawing) the instance until
+    // they change it.
+    float secondsUntilWake() const;
+
     void resetState();
 
     // Returns a pointer to the instance's stateMachine
@@ -179,6 +196,10 @@ public:
 
     /// Gets a reported event at an index < reportedEventCount().
     const EventReport reportedEventAt(std::size_t index) const;
+
+    /// Estimates the memory held by this instance's layers, inputs, listeners
+    /// and data binds. The StateMachine definition is owned by the File.
+    MemoryUsage memoryUsage() const;
     bool playsAudio() override { return true; }
     BindableProperty* bindablePropertyInstance(
         BindableProperty* bindableProperty) const;
@@ -200,6 +221,8 @@ public:
         return nullptr;
     }
     const LayerState* layerState(size_t index);
+    // Times a state's transitions were searched for one that's allowed.
+    int transitionEvaluationCount = 0;
 #endif
     void updateDataBinds();
     void enablePointerEvents();
@@ -210,6 +233,15 @@ private:
     std::vector<EventReport> m_reportingEvents;
     const StateMachine* m_machine;
     bool m_needsAdvance = false;
+    bool m_sleepWhenSettled = false;
+    bool m_sleeping = false;
+    bool shouldWake() const;
+    // Incremented whenever an input or a data bound value the transitions
+    // may read changes, see StateMachineLayerInstance::tryChangeState.
+    uint64_t m_changeStamp = 1;
+    uint64_t m_dataBindChangeStamp = 0;
+    uint64_t nextChangeStamp() { return ++m_changeStamp; }
+    void dataBindsChanged() { m_dataBindChangeStamp = nextChangeStamp(); }
     std::vector<SMIInput*> m_inputInstances; // we own each pointer
     size_t m_layerCount;
     StateMachineLayerInstance* m_layers;
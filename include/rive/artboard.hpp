@@ -19,6 +19,7 @@
 #include "rive/event.hpp"
 #include "rive/audio/audio_engine.hpp"
 #include "rive/math/raw_path.hpp"
+#include "rive/memory_usage.hpp"
 #include "rive/typed_children.hpp"
 #include "rive/virtualizing_component.hpp"
 
@@ -88,6 +89,8 @@ private:
     Drawable* m_FirstDrawable = nullptr;
     bool m_IsInstance = false;
     bool m_FrameOrigin = true;
+    AABB m_worldCullRect;
+    bool m_hasCullRect = false;
     std::unordered_set<LayoutComponent*> m_dirtyLayout;
     bool m_isCleaningDirtyLayouts = false;
     float m_originalWidth = 0;
@@ -223,6 +226,18 @@ public:
     };
     void draw(Renderer* renderer, DrawOption option);
     void draw(Renderer* renderer) override;
+    /// Draws the artboard, skipping shapes that lie outside cullRect (given
+    /// in the same space as bounds()). Until the next draw, shapes outside it
+    /// also stop composing their paths (see Shape::canDeferPathUpdate).
+    void draw(Renderer* renderer,
+              const AABB& cullRect,
+              DrawOption option = DrawOption::kNormal);
+    /// The cull rect of the last draw in world space (the space of the
+    /// drawables' world bounds), or nullptr if it wasn't culled.
+    const AABB* worldCullRect() const
+    {
+        return m_hasCullRect ? &m_worldCullRect : nullptr;
+    }
     void addToRenderPath(RenderPath* path, const Mat2D& transform);
 
 #ifdef TESTING
@@ -237,7 +252,7 @@ public:
             Span<Core*>(m_Objects.data(), m_Objects.size()));
     }
 
-    const std::vector<NestedArtboard*> nestedArtboards() const
+    const std::vector<NestedArtboard*>& nestedArtboards() const
     {
         return m_NestedArtboards;
     }
@@ -279,6 +294,11 @@ public:
 
     bool hasAudio() const;
 
+    /// Estimates the memory held by this artboard's objects, paths, text and
+    /// nested artboards. Animations and state machines are only counted for
+    /// source artboards, instances share them with their source.
+    MemoryUsage memoryUsage() const;
+
     template <typename T = Component> T* find(const std::string& name)
     {
         for (auto object : m_Objects)
@@ -471,6 +491,7 @@ public:
 #endif
 private:
     float m_volume = 1.0f;
+    void drawInternal(Renderer* renderer, DrawOption option);
 #ifdef WITH_RIVE_TOOLS
     ArtboardCallback m_layoutChangedCallback = nullptr;
     ArtboardCallback m_layoutDirtyCallback = nullptr;
@@ -117,6 +117,8 @@ public:
 
 private:
     void updateArtboardsWorldTransform();
+    void drawArtboard(Renderer* renderer, ArtboardInstance* artboard);
+    void shareRenderPaths(ArtboardInstance* artboard, ArtboardInstance* source);
     void disposeListItem(const rcp<ViewModelInstanceListItem>& listItem);
     std::unique_ptr<ArtboardInstance> createArtboard(
         Component* target,
@@ -149,6 +151,10 @@ private:
     std::unordered_map<Artboard*, std::unique_ptr<PropertyRecorder>>
         m_propertyRecordersMap;
     std::unordered_map<ArtboardInstance*, Mat2D> m_artboardTransforms;
+    // The first row drawn for each source artboard in the current draw, rows
+    // drawn after it share its RenderPaths where their geometry matches.
+    std::unordered_map<const Artboard*, ArtboardInstance*> m_drawnSources;
+    std::vector<ShapePaintPath*> m_sharedRenderPaths;
     Vec2D artboardPosition(ArtboardInstance* artboard);
 
     File* m_file = nullptr;
@@ -2,8 +2,10 @@
 #define _RIVE_IMAGE_ASSET_HPP_
 
 #include "rive/generated/assets/image_asset_base.hpp"
+#include "rive/image_cache.hpp"
 #include "rive/renderer.hpp"
 #include "rive/simple_array.hpp"
+#include <algorithm>
 #include <functional>
 #include <string>
 
@@ -16,7 +18,14 @@ class ImageAsset : public ImageAssetBase
 #endif
 {
 private:
+    void releaseCachedImage();
+
     rcp<RenderImage> m_RenderImage;
+    // Cache m_RenderImage was decoded through, which holds a use of it until
+    // the image is replaced or this asset goes away.
+    rcp<ImageCache> m_imageCache;
+    float m_maxDrawScale = 0.0f;
+    float m_decodeScale = 1.0f;
 
 public:
     ImageAsset() {}
@@ -29,6 +38,20 @@ public:
     std::string fileExtension() const override;
     RenderImage* renderImage() const { return m_RenderImage.get(); }
     void renderImage(rcp<RenderImage> renderImage);
+
+    /// Largest device scale any Image has drawn this asset at so far.
+    float maxDrawScale() const { return m_maxDrawScale; }
+    void observeDrawScale(float scale)
+    {
+        m_maxDrawScale = std::max(m_maxDrawScale, scale);
+    }
+
+    /// Scale of the asset's width and height to decode at, below 1 lets the
+    /// factory decode a smaller image for assets that are only drawn small,
+    /// e.g. maxDrawScale() when reloading an out of band asset. Only applies
+    /// to the next decode.
+    float decodeScale() const { return m_decodeScale; }
+    void decodeScale(float scale) { m_decodeScale = scale; }
 #if defined(__EMSCRIPTEN__)
     void decodedAsync() override;
 #endif
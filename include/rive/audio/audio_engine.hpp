@@ -7,6 +7,7 @@
 #include <vector>
 #include <stdio.h>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 
 typedef struct ma_engine ma_engine;
@@ -21,6 +22,7 @@ class AudioSound;
 class AudioSource;
 class LevelsNode;
 class Artboard;
+class OfflineMixer;
 class AudioEngine : public RefCnt<AudioEngine>
 {
     friend class AudioSound;
@@ -33,6 +35,15 @@ public:
 
     static rcp<AudioEngine> Make(uint32_t numChannels, uint32_t sampleRate);
 
+    // Makes an engine without a device, e.g. to render videos on a headless
+    // server. Time only advances when renderFrames is called, and sounds
+    // start on the exact frame they're played at. Sounds are mixed by a pool
+    // of maxVoices voices allocated up front.
+    static rcp<AudioEngine> MakeOffline(uint32_t numChannels,
+                                        uint32_t sampleRate,
+                                        uint32_t maxVoices = 64);
+    bool isOffline() const { return m_offlineMixer != nullptr; }
+
     ma_device* device() { return m_device; }
     ma_engine* engine() { return m_engine; }
 
@@ -41,12 +52,27 @@ public:
     uint64_t timeInFrames();
 
     ~AudioEngine();
+    // Offline engines play through their mixer, honoring endTime and
+    // soundStartTime, and return null.
     rcp<AudioSound> play(rcp<AudioSource> source,
                          uint64_t startTime,
                          uint64_t endTime,
                          uint64_t soundStartTime,
                          Artboard* artboard = nullptr);
 
+    // Plays source from startTime on an offline engine. Doesn't lock, and
+    // only allocates the first time a source is played, when it's decoded.
+    // Returns false when every voice is busy. Call it from one thread at a
+    // time, which may differ from the one calling renderFrames.
+    bool playOffline(rcp<AudioSource> source,
+                     uint64_t startTime,
+                     float volume = 1.0f,
+                     Artboard* artboard = nullptr);
+
+    // Overwrites frames with the next numFrames interleaved frames of an
+    // offline engine and advances timeInFrames past them.
+    void renderFrames(float* frames, uint64_t numFrames);
+
     static rcp<AudioEngine> RuntimeEngine(bool makeWhenNecessary = true);
 
 #ifdef EXTERNAL_RIVE_AUDIO_ENGINE
@@ -71,6 +97,7 @@ public:
 #endif
 private:
     AudioEngine(ma_engine* engine, ma_context* context);
+    explicit AudioEngine(OfflineMixer* offlineMixer);
     ma_device* m_device;
     ma_engine* m_engine;
     ma_context* m_context;
@@ -81,6 +108,7 @@ private:
 
     std::vector<rcp<AudioSound>> m_completedSounds;
     rcp<AudioSound> m_playingSoundsHead;
+    std::unique_ptr<OfflineMixer> m_offlineMixer;
     static void SoundCompleted(void* pUserData, ma_sound* pSound);
 
 #ifdef WITH_RIVE_AUDIO_TOOLS
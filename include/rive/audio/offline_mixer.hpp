@@ -0,0 +1,145 @@
+#ifdef WITH_RIVE_AUDIO
+#ifndef _RIVE_OFFLINE_MIXER_HPP_
+#define _RIVE_OFFLINE_MIXER_HPP_
+
+#include "rive/refcnt.hpp"
+#include "rive/audio/audio_source.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace rive
+{
+class Artboard;
+
+// Mixes the sounds of an offline AudioEngine. One thread plays and stops
+// sounds while another renders them. Voices are allocated up front and
+// handed between the two through single producer, single consumer queues,
+// so neither thread ever waits on the other. Stops are flags on the voices
+// themselves, so no number of stops can overflow a queue.
+class OfflineMixer
+{
+public:
+    OfflineMixer(uint32_t channels, uint32_t sampleRate, uint32_t maxVoices);
+    ~OfflineMixer();
+
+    uint32_t channels() const { return m_channels; }
+    uint32_t sampleRate() const { return m_sampleRate; }
+    uint64_t timeInFrames() const
+    {
+        return m_frame.load(std::memory_order_acquire);
+    }
+
+    // Playing thread. Plays source from soundStartTime frames in, until
+    // endTime if it isn't 0, the same as AudioEngine::play. Returns false
+    // when every voice is busy, the source can't be decoded or there's
+    // nothing left to play.
+    bool play(rcp<AudioSource> source,
+              uint64_t startTime,
+              float volume,
+              const Artboard* artboard,
+              uint64_t soundStartTime = 0,
+              uint64_t endTime = 0);
+    // Stops every sound played for artboard so far.
+    void stop(const Artboard* artboard);
+
+    // Rendering thread.
+    void render(float* frames, uint64_t numFrames);
+
+#ifdef TESTING
+    size_t clipCount() const { return m_clips.size(); }
+#endif
+
+private:
+    // A source decoded to the mixer's channels and sample rate the first
+    // time it's played. Holding the source keeps its address, which keys
+    // m_clips, from being reused while the clip is cached.
+    struct Clip
+    {
+        rcp<AudioSource> source;
+        std::vector<float> samples;
+        uint64_t frameCount;
+        // Voices playing the clip. Raised by the playing thread and lowered
+        // by the rendering thread, the clip can be evicted at zero.
+        std::atomic<uint32_t> voiceCount{0};
+        // When play last asked for the clip, to evict the oldest first.
+        uint64_t lastPlayed = 0;
+    };
+
+    struct Voice
+    {
+        Clip* clip;
+        uint64_t startTime;
+        uint64_t cursor;
+        // The clip frame the voice stops at.
+        uint64_t endFrame;
+        float volume;
+        // Set by the playing thread to stop the voice on the next render.
+        std::atomic<bool> stopped{false};
+    };
+
+    template <typename T> class Queue
+    {
+    public:
+        explicit Queue(uint32_t capacity) : m_items(capacity + 1) {}
+
+        bool push(const T& item)
+        {
+            uint32_t tail = m_tail.load(std::memory_order_relaxed);
+            uint32_t next = (tail + 1) % m_items.size();
+            if (next == m_head.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            m_items[tail] = item;
+            m_tail.store(next, std::memory_order_release);
+            return true;
+        }
+
+        bool pop(T& item)
+        {
+            uint32_t head = m_head.load(std::memory_order_relaxed);
+            if (head == m_tail.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            item = m_items[head];
+            m_head.store((head + 1) % m_items.size(),
+                         std::memory_order_release);
+            return true;
+        }
+
+    private:
+        std::vector<T> m_items;
+        std::atomic<uint32_t> m_head{0};
+        std::atomic<uint32_t> m_tail{0};
+    };
+
+    Clip* clip(const rcp<AudioSource>& source);
+    void evictClips();
+    void receivePlays();
+    void release(size_t activeIndex);
+
+    const uint32_t m_channels;
+    const uint32_t m_sampleRate;
+    std::vector<Voice> m_voices;
+    std::atomic<uint64_t> m_frame{0};
+
+    // Owned by the playing thread. m_voiceArtboards holds the artboard each
+    // voice was last played for.
+    std::unordered_map<const AudioSource*, std::unique_ptr<Clip>> m_clips;
+    std::vector<const Artboard*> m_voiceArtboards;
+    uint64_t m_playCount = 0;
+
+    // Owned by the rendering thread.
+    std::vector<uint32_t> m_active;
+
+    Queue<uint32_t> m_freeVoices;
+    Queue<uint32_t> m_plays;
+};
+} // namespace rive
+
+#endif
+#endif
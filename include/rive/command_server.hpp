@@ -6,9 +6,11 @@
 
 #include "rive/command_queue.hpp"
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <type_traits>
 
 namespace rive
@@ -18,7 +20,15 @@ namespace rive
 class CommandServer
 {
 public:
-    CommandServer(rcp<CommandQueue>, Factory*);
+    // With importThreadCount > 0, loadFile imports files on that many
+    // background threads instead of the server thread, so a burst of loads
+    // doesn't hold up other handles' commands and draws. Commands that use a
+    // file still see it exactly as if it had been imported inline: they wait
+    // for its import to finish first, as does runOnce. The factory is still
+    // only used on the server thread.
+    CommandServer(rcp<CommandQueue>,
+                  Factory*,
+                  uint32_t importThreadCount = 0);
     virtual ~CommandServer();
 
     Factory* factory() const { return m_factory; }
@@ -124,6 +134,15 @@ private:
 
     void checkPropertySubscriptions();
 
+    // Takes ownership of an imported file and reports the result of its
+    // loadFile command.
+    void installFile(FileHandle, uint64_t requestId, rcp<File>);
+    // Installs every import that has finished on the import threads.
+    void installFinishedImports();
+    // Waits for the file's import if it's still running, then returns it.
+    File* waitForFile(FileHandle);
+    void waitForAllFiles();
+
     Vec2D cursorPosForPointerEvent(StateMachineInstance*,
                                    const CommandQueue::PointerEvent&);
 
@@ -186,6 +205,9 @@ private:
     std::unordered_map<FileHandle, rcp<File>> m_files;
     std::unordered_map<FontHandle, rcp<Font>> m_fonts;
     std::unordered_map<RenderImageHandle, rcp<RenderImage>> m_images;
+    // Images decoded through the factory's image cache, each holds a use of
+    // its cache entry until it's deleted.
+    std::unordered_set<RenderImageHandle> m_cachedImages;
     std::unordered_map<AudioSourceHandle, rcp<AudioSource>> m_audioSources;
     std::unordered_map<ArtboardHandle, std::unique_ptr<ArtboardInstance>>
         m_artboards;
@@ -199,5 +221,9 @@ private:
 
     class CommandFileAssetLoader;
     rcp<CommandFileAssetLoader> m_fileAssetLoader;
+
+    // Null when files are imported on the server thread.
+    class FileImporter;
+    std::unique_ptr<FileImporter> m_fileImporter;
 };
 }; // namespace rive
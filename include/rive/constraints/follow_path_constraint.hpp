@@ -20,10 +20,16 @@ protected:
     TransformComponents constrainHelper(const Mat2D& componentTransform,
                                         Mat2D& transformB,
                                         const Mat2D& componentParentWorld);
+    // Whether targetTransform follows m_pathMeasure.
+    bool followsPath() const;
+    // Target transform for a point already measured on m_pathMeasure.
+    const Mat2D targetTransform(
+        const ContourMeasure::PosTanDistance& result) const;
+
+    PathMeasure m_pathMeasure;
 
 private:
     RawPath m_rawPath;
-    PathMeasure m_pathMeasure;
 };
 } // namespace rive
 
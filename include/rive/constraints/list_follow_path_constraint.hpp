@@ -21,6 +21,8 @@ private:
     TransformComponents constrainAtOffset(const Mat2D& componentTransform,
                                           const Mat2D& parentTransform,
                                           float componentOffset);
+    std::vector<float> m_itemOffsets;
+    std::vector<ContourMeasure::PosTanDistance> m_itemResults;
 };
 } // namespace rive
 
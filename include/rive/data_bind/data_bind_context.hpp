@@ -13,7 +13,18 @@ class DataBindContext : public DataBindContextBase
 protected:
     std::vector<uint32_t> m_SourcePathIdsBuffer;
 
+private:
+    // The source last resolved from m_SourcePathIdsBuffer, valid while the
+    // context and its version stay the same.
+    DataContext* m_resolvedContext = nullptr;
+    uint32_t m_resolvedVersion = 0;
+    ViewModelInstanceValue* m_resolvedSource = nullptr;
+
 public:
+#ifdef TESTING
+    // Times the source path was walked instead of reusing the last source.
+    int sourcePathResolutions = 0;
+#endif
     void decodeSourcePathIds(Span<const uint8_t> value) override;
     void copySourcePathIds(const DataBindContextBase& object) override;
     void bindFromContext(DataContext* dataContext);
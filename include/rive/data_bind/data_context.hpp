@@ -3,6 +3,7 @@
 #include "rive/viewmodel/viewmodel_instance_value.hpp"
 #include "rive/viewmodel/viewmodel_instance.hpp"
 #include "rive/refcnt.hpp"
+#include <atomic>
 
 namespace rive
 {
@@ -11,16 +12,41 @@ class DataContext
 private:
     DataContext* m_Parent = nullptr;
     rcp<ViewModelInstance> m_ViewModelInstance;
+    // Stamped from sm_nextStamp when the context is created and whenever its
+    // parent or instance changes. Stamps are never reused, so a context
+    // allocated where a deleted one lived still gets a stamp of its own.
+    uint32_t m_stamp;
+    static std::atomic<uint32_t> sm_nextStamp;
+    static std::atomic<uint32_t> sm_referencesStamp;
+    static uint32_t nextStamp() { return ++sm_nextStamp; }
 
 public:
     DataContext(rcp<ViewModelInstance> viewModelInstance);
 
+    // Changes whenever this context, one of its ancestors, or a nested view
+    // model reference changes, so anything resolved by walking a path from
+    // this context is only valid while it stays the same. Other contexts
+    // being created or changed leave it alone.
+    uint32_t version() const;
+
+    // Called when a view model instance re-points one of its nested view
+    // models. Instances don't know which graphs they are part of, so this
+    // changes the version of every context.
+    static void referencesChanged() { sm_referencesStamp = nextStamp(); }
+
     DataContext* parent() { return m_Parent; }
-    void parent(DataContext* value) { m_Parent = value; }
+    void parent(DataContext* value)
+    {
+        if (m_Parent != value)
+        {
+            m_Parent = value;
+            m_stamp = nextStamp();
+        }
+    }
     ViewModelInstanceValue* getViewModelProperty(
-        const std::vector<uint32_t> path) const;
+        const std::vector<uint32_t>& path) const;
     rcp<ViewModelInstance> getViewModelInstance(
-        const std::vector<uint32_t> path) const;
+        const std::vector<uint32_t>& path) const;
     void viewModelInstance(rcp<ViewModelInstance> value);
     void advanced();
     rcp<ViewModelInstance> viewModelInstance() { return m_ViewModelInstance; };
@@ -8,6 +8,7 @@
 #include "rive/renderer.hpp"
 #include "rive/text_engine.hpp"
 #include "rive/audio/audio_source.hpp"
+#include "rive/image_cache.hpp"
 #include "rive/refcnt.hpp"
 #include "rive/span.hpp"
 #include "rive/math/aabb.hpp"
@@ -47,6 +48,30 @@ public:
         const float stops[],     // [count]
         size_t count) = 0;
 
+    // Moves a gradient previously made by this factory to new endpoints and
+    // stops, returning the shader to draw with from now on. Factories that
+    // can mutate their shaders return `shader` itself when nothing still
+    // needs its old values (anything else holding it sees the update). The
+    // default makes a new gradient, as does a null `shader`.
+    virtual rcp<RenderShader> updateLinearGradient(
+        rcp<RenderShader> shader,
+        float sx,
+        float sy,
+        float ex,
+        float ey,
+        const ColorInt colors[], // [count]
+        const float stops[],     // [count]
+        size_t count);
+
+    virtual rcp<RenderShader> updateRadialGradient(
+        rcp<RenderShader> shader,
+        float cx,
+        float cy,
+        float radius,
+        const ColorInt colors[], // [count]
+        const float stops[],     // [count]
+        size_t count);
+
     // Returns a full-formed RenderPath -- can be treated as immutable
     // This call might swap out the arrays backing the points and verbs in the
     // given RawPath, so the caller can expect it to be in an undefined state
@@ -60,6 +85,18 @@ public:
 
     virtual rcp<RenderImage> decodeImage(Span<const uint8_t>) = 0;
 
+    // Decodes an image that's never drawn larger than targetWidth x
+    // targetHeight pixels, letting factories decode or upload a smaller
+    // texture. The returned image still reports the encoded image's full
+    // width and height, so it lays out and draws exactly like decodeImage's.
+    // A target of 0 x 0 decodes at full size. The default ignores the target.
+    virtual rcp<RenderImage> decodeImageAtSize(Span<const uint8_t> bytes,
+                                               uint32_t targetWidth,
+                                               uint32_t targetHeight)
+    {
+        return decodeImage(bytes);
+    }
+
     rcp<Font> decodeFont(Span<const uint8_t>);
 
     rcp<AudioSource> decodeAudio(Span<const uint8_t>);
@@ -67,6 +104,23 @@ public:
     // Non-virtual helpers
 
     rcp<RenderPath> makeRenderPath(const AABB&);
+
+    // Decodes through the image cache when one is set, so everything that
+    // decodes the same bytes with this factory shares one RenderImage.
+    // ImageAsset::decode (and so any FileAssetLoader that decodes assets) and
+    // the CommandServer's global images go through here.
+    rcp<RenderImage> decodeCachedImage(Span<const uint8_t>,
+                                       uint32_t targetWidth = 0,
+                                       uint32_t targetHeight = 0);
+    // Hands an image from decodeCachedImage back to the image cache once the
+    // caller drops it.
+    void releaseCachedImage(const RenderImage*);
+
+    void imageCache(rcp<ImageCache> cache) { m_imageCache = std::move(cache); }
+    ImageCache* imageCache() const { return m_imageCache.get(); }
+
+private:
+    rcp<ImageCache> m_imageCache;
 };
 
 } // namespace rive
@@ -79,6 +79,12 @@ public:
                             ImportResult* result,
                             rcp<FileAssetLoader> assetLoader);
 
+    /// Switches the file, and the artboards it instances from, over to a new
+    /// factory. Lets a file be imported with a stand-in factory on another
+    /// thread. Render objects the source artboards already made with the old
+    /// factory are kept, so only instances should be drawn after this.
+    void factory(Factory*);
+
     /// @returns the file's backboard. All files have exactly one backboard.
     Backboard* backboard() const { return m_backboard; }
 
@@ -88,6 +94,11 @@ public:
 
     Span<const rcp<FileAsset>> assets() const;
 
+    /// Estimates the memory held by the file: its source artboards, their
+    /// animations and state machines, view models and decoded assets. Live
+    /// ArtboardInstances and StateMachineInstances report their own usage.
+    MemoryUsage memoryUsage() const;
+
     // Instances
     std::unique_ptr<ArtboardInstance> artboardDefault() const;
     std::unique_ptr<ArtboardInstance> artboardAt(size_t index) const;
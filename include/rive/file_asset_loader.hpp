@@ -21,6 +21,9 @@ public:
     /// contents of.
     /// @param inBandBytes is a pointer to the bytes in question
     /// @returns bool indicating if we are loading or have loaded the contents
+    ///
+    /// Images decoded with FileAsset::decode share decoded RenderImages
+    /// through the factory's ImageCache, when it has one.
 
     virtual bool loadContents(FileAsset& asset,
                               Span<const uint8_t> inBandBytes,
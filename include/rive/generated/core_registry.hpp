@@ -771,6 +771,479 @@ public:
         }
         return nullptr;
     }
+    static size_t objectSize(int typeKey)
+    {
+        switch (typeKey)
+        {
+            case ViewModelInstanceListItemBase::typeKey:
+                return sizeof(ViewModelInstanceListItem);
+            case ViewModelComponentBase::typeKey:
+                return sizeof(ViewModelComponent);
+            case ViewModelPropertyBase::typeKey:
+                return sizeof(ViewModelProperty);
+            case ViewModelPropertyArtboardBase::typeKey:
+                return sizeof(ViewModelPropertyArtboard);
+            case ViewModelInstanceColorBase::typeKey:
+                return sizeof(ViewModelInstanceColor);
+            case ViewModelPropertyEnumBase::typeKey:
+                return sizeof(ViewModelPropertyEnum);
+            case ViewModelPropertyEnumCustomBase::typeKey:
+                return sizeof(ViewModelPropertyEnumCustom);
+            case DataEnumBase::typeKey:
+                return sizeof(DataEnum);
+            case DataEnumCustomBase::typeKey:
+                return sizeof(DataEnumCustom);
+            case ViewModelPropertyNumberBase::typeKey:
+                return sizeof(ViewModelPropertyNumber);
+            case ViewModelInstanceEnumBase::typeKey:
+                return sizeof(ViewModelInstanceEnum);
+            case ViewModelPropertySymbolListIndexBase::typeKey:
+                return sizeof(ViewModelPropertySymbolListIndex);
+            case ViewModelInstanceArtboardBase::typeKey:
+                return sizeof(ViewModelInstanceArtboard);
+            case ViewModelInstanceStringBase::typeKey:
+                return sizeof(ViewModelInstanceString);
+            case ViewModelPropertyListBase::typeKey:
+                return sizeof(ViewModelPropertyList);
+            case ViewModelPropertyEnumSystemBase::typeKey:
+                return sizeof(ViewModelPropertyEnumSystem);
+            case ViewModelBase::typeKey:
+                return sizeof(ViewModel);
+            case ViewModelPropertyAssetBase::typeKey:
+                return sizeof(ViewModelPropertyAsset);
+            case DataEnumSystemBase::typeKey:
+                return sizeof(DataEnumSystem);
+            case ViewModelPropertyViewModelBase::typeKey:
+                return sizeof(ViewModelPropertyViewModel);
+            case ViewModelInstanceBase::typeKey:
+                return sizeof(ViewModelInstance);
+            case ViewModelPropertyBooleanBase::typeKey:
+                return sizeof(ViewModelPropertyBoolean);
+            case ViewModelPropertyColorBase::typeKey:
+                return sizeof(ViewModelPropertyColor);
+            case ViewModelPropertyAssetImageBase::typeKey:
+                return sizeof(ViewModelPropertyAssetImage);
+            case ViewModelInstanceBooleanBase::typeKey:
+                return sizeof(ViewModelInstanceBoolean);
+            case ViewModelInstanceListBase::typeKey:
+                return sizeof(ViewModelInstanceList);
+            case ViewModelInstanceNumberBase::typeKey:
+                return sizeof(ViewModelInstanceNumber);
+            case ViewModelInstanceTriggerBase::typeKey:
+                return sizeof(ViewModelInstanceTrigger);
+            case ViewModelInstanceSymbolListIndexBase::typeKey:
+                return sizeof(ViewModelInstanceSymbolListIndex);
+            case ViewModelPropertyStringBase::typeKey:
+                return sizeof(ViewModelPropertyString);
+            case ViewModelInstanceViewModelBase::typeKey:
+                return sizeof(ViewModelInstanceViewModel);
+            case ViewModelPropertyTriggerBase::typeKey:
+                return sizeof(ViewModelPropertyTrigger);
+            case ViewModelInstanceAssetBase::typeKey:
+                return sizeof(ViewModelInstanceAsset);
+            case ViewModelInstanceAssetImageBase::typeKey:
+                return sizeof(ViewModelInstanceAssetImage);
+            case DataEnumValueBase::typeKey:
+                return sizeof(DataEnumValue);
+            case DrawTargetBase::typeKey:
+                return sizeof(DrawTarget);
+            case CustomPropertyNumberBase::typeKey:
+                return sizeof(CustomPropertyNumber);
+            case DistanceConstraintBase::typeKey:
+                return sizeof(DistanceConstraint);
+            case FollowPathConstraintBase::typeKey:
+                return sizeof(FollowPathConstraint);
+            case ListFollowPathConstraintBase::typeKey:
+                return sizeof(ListFollowPathConstraint);
+            case IKConstraintBase::typeKey:
+                return sizeof(IKConstraint);
+            case TranslationConstraintBase::typeKey:
+                return sizeof(TranslationConstraint);
+            case ClampedScrollPhysicsBase::typeKey:
+                return sizeof(ClampedScrollPhysics);
+            case ScrollConstraintBase::typeKey:
+                return sizeof(ScrollConstraint);
+            case ElasticScrollPhysicsBase::typeKey:
+                return sizeof(ElasticScrollPhysics);
+            case ScrollBarConstraintBase::typeKey:
+                return sizeof(ScrollBarConstraint);
+            case TransformConstraintBase::typeKey:
+                return sizeof(TransformConstraint);
+            case ScaleConstraintBase::typeKey:
+                return sizeof(ScaleConstraint);
+            case RotationConstraintBase::typeKey:
+                return sizeof(RotationConstraint);
+            case NodeBase::typeKey:
+                return sizeof(Node);
+            case ForegroundLayoutDrawableBase::typeKey:
+                return sizeof(ForegroundLayoutDrawable);
+            case NestedArtboardBase::typeKey:
+                return sizeof(NestedArtboard);
+            case ArtboardComponentListBase::typeKey:
+                return sizeof(ArtboardComponentList);
+            case CustomPropertyColorBase::typeKey:
+                return sizeof(CustomPropertyColor);
+            case SoloBase::typeKey:
+                return sizeof(Solo);
+            case NestedArtboardLayoutBase::typeKey:
+                return sizeof(NestedArtboardLayout);
+            case NSlicerTileModeBase::typeKey:
+                return sizeof(NSlicerTileMode);
+            case AxisYBase::typeKey:
+                return sizeof(AxisY);
+            case LayoutComponentStyleBase::typeKey:
+                return sizeof(LayoutComponentStyle);
+            case AxisXBase::typeKey:
+                return sizeof(AxisX);
+            case NSlicerBase::typeKey:
+                return sizeof(NSlicer);
+            case NSlicedNodeBase::typeKey:
+                return sizeof(NSlicedNode);
+            case ArtboardComponentListOverrideBase::typeKey:
+                return sizeof(ArtboardComponentListOverride);
+            case ListenerFireEventBase::typeKey:
+                return sizeof(ListenerFireEvent);
+            case TransitionSelfComparatorBase::typeKey:
+                return sizeof(TransitionSelfComparator);
+            case StateMachineFireTriggerBase::typeKey:
+                return sizeof(StateMachineFireTrigger);
+            case TransitionValueTriggerComparatorBase::typeKey:
+                return sizeof(TransitionValueTriggerComparator);
+            case KeyFrameUintBase::typeKey:
+                return sizeof(KeyFrameUint);
+            case NestedSimpleAnimationBase::typeKey:
+                return sizeof(NestedSimpleAnimation);
+            case AnimationStateBase::typeKey:
+                return sizeof(AnimationState);
+            case NestedTriggerBase::typeKey:
+                return sizeof(NestedTrigger);
+            case KeyedObjectBase::typeKey:
+                return sizeof(KeyedObject);
+            case AnimationBase::typeKey:
+                return sizeof(Animation);
+            case BlendAnimationDirectBase::typeKey:
+                return sizeof(BlendAnimationDirect);
+            case StateMachineNumberBase::typeKey:
+                return sizeof(StateMachineNumber);
+            case CubicValueInterpolatorBase::typeKey:
+                return sizeof(CubicValueInterpolator);
+            case TransitionTriggerConditionBase::typeKey:
+                return sizeof(TransitionTriggerCondition);
+            case KeyedPropertyBase::typeKey:
+                return sizeof(KeyedProperty);
+            case StateMachineListenerBase::typeKey:
+                return sizeof(StateMachineListener);
+            case TransitionPropertyArtboardComparatorBase::typeKey:
+                return sizeof(TransitionPropertyArtboardComparator);
+            case TransitionPropertyViewModelComparatorBase::typeKey:
+                return sizeof(TransitionPropertyViewModelComparator);
+            case KeyFrameIdBase::typeKey:
+                return sizeof(KeyFrameId);
+            case KeyFrameBoolBase::typeKey:
+                return sizeof(KeyFrameBool);
+            case ListenerBoolChangeBase::typeKey:
+                return sizeof(ListenerBoolChange);
+            case ListenerAlignTargetBase::typeKey:
+                return sizeof(ListenerAlignTarget);
+            case TransitionNumberConditionBase::typeKey:
+                return sizeof(TransitionNumberCondition);
+            case TransitionValueBooleanComparatorBase::typeKey:
+                return sizeof(TransitionValueBooleanComparator);
+            case TransitionViewModelConditionBase::typeKey:
+                return sizeof(TransitionViewModelCondition);
+            case TransitionArtboardConditionBase::typeKey:
+                return sizeof(TransitionArtboardCondition);
+            case AnyStateBase::typeKey:
+                return sizeof(AnyState);
+            case BlendState1DInputBase::typeKey:
+                return sizeof(BlendState1DInput);
+            case CubicInterpolatorComponentBase::typeKey:
+                return sizeof(CubicInterpolatorComponent);
+            case StateMachineLayerBase::typeKey:
+                return sizeof(StateMachineLayer);
+            case KeyFrameStringBase::typeKey:
+                return sizeof(KeyFrameString);
+            case ListenerNumberChangeBase::typeKey:
+                return sizeof(ListenerNumberChange);
+            case CubicEaseInterpolatorBase::typeKey:
+                return sizeof(CubicEaseInterpolator);
+            case TransitionValueIdComparatorBase::typeKey:
+                return sizeof(TransitionValueIdComparator);
+            case StateTransitionBase::typeKey:
+                return sizeof(StateTransition);
+            case NestedBoolBase::typeKey:
+                return sizeof(NestedBool);
+            case KeyFrameDoubleBase::typeKey:
+                return sizeof(KeyFrameDouble);
+            case KeyFrameColorBase::typeKey:
+                return sizeof(KeyFrameColor);
+            case StateMachineBase::typeKey:
+                return sizeof(StateMachine);
+            case StateMachineFireEventBase::typeKey:
+                return sizeof(StateMachineFireEvent);
+            case EntryStateBase::typeKey:
+                return sizeof(EntryState);
+            case LinearAnimationBase::typeKey:
+                return sizeof(LinearAnimation);
+            case StateMachineTriggerBase::typeKey:
+                return sizeof(StateMachineTrigger);
+            case TransitionValueColorComparatorBase::typeKey:
+                return sizeof(TransitionValueColorComparator);
+            case ListenerTriggerChangeBase::typeKey:
+                return sizeof(ListenerTriggerChange);
+            case BlendStateDirectBase::typeKey:
+                return sizeof(BlendStateDirect);
+            case ListenerViewModelChangeBase::typeKey:
+                return sizeof(ListenerViewModelChange);
+            case TransitionValueNumberComparatorBase::typeKey:
+                return sizeof(TransitionValueNumberComparator);
+            case NestedStateMachineBase::typeKey:
+                return sizeof(NestedStateMachine);
+            case ElasticInterpolatorBase::typeKey:
+                return sizeof(ElasticInterpolator);
+            case ExitStateBase::typeKey:
+                return sizeof(ExitState);
+            case NestedNumberBase::typeKey:
+                return sizeof(NestedNumber);
+            case TransitionValueEnumComparatorBase::typeKey:
+                return sizeof(TransitionValueEnumComparator);
+            case KeyFrameCallbackBase::typeKey:
+                return sizeof(KeyFrameCallback);
+            case TransitionValueStringComparatorBase::typeKey:
+                return sizeof(TransitionValueStringComparator);
+            case NestedRemapAnimationBase::typeKey:
+                return sizeof(NestedRemapAnimation);
+            case TransitionValueAssetComparatorBase::typeKey:
+                return sizeof(TransitionValueAssetComparator);
+            case TransitionBoolConditionBase::typeKey:
+                return sizeof(TransitionBoolCondition);
+            case BlendState1DViewModelBase::typeKey:
+                return sizeof(BlendState1DViewModel);
+            case BlendStateTransitionBase::typeKey:
+                return sizeof(BlendStateTransition);
+            case StateMachineBoolBase::typeKey:
+                return sizeof(StateMachineBool);
+            case BlendAnimation1DBase::typeKey:
+                return sizeof(BlendAnimation1D);
+            case DashPathBase::typeKey:
+                return sizeof(DashPath);
+            case LinearGradientBase::typeKey:
+                return sizeof(LinearGradient);
+            case RadialGradientBase::typeKey:
+                return sizeof(RadialGradient);
+            case DashBase::typeKey:
+                return sizeof(Dash);
+            case StrokeBase::typeKey:
+                return sizeof(Stroke);
+            case SolidColorBase::typeKey:
+                return sizeof(SolidColor);
+            case GradientStopBase::typeKey:
+                return sizeof(GradientStop);
+            case FeatherBase::typeKey:
+                return sizeof(Feather);
+            case TrimPathBase::typeKey:
+                return sizeof(TrimPath);
+            case FillBase::typeKey:
+                return sizeof(Fill);
+            case MeshVertexBase::typeKey:
+                return sizeof(MeshVertex);
+            case ShapeBase::typeKey:
+                return sizeof(Shape);
+            case StraightVertexBase::typeKey:
+                return sizeof(StraightVertex);
+            case CubicAsymmetricVertexBase::typeKey:
+                return sizeof(CubicAsymmetricVertex);
+            case MeshBase::typeKey:
+                return sizeof(Mesh);
+            case PointsPathBase::typeKey:
+                return sizeof(PointsPath);
+            case ContourMeshVertexBase::typeKey:
+                return sizeof(ContourMeshVertex);
+            case RectangleBase::typeKey:
+                return sizeof(Rectangle);
+            case CubicMirroredVertexBase::typeKey:
+                return sizeof(CubicMirroredVertex);
+            case TriangleBase::typeKey:
+                return sizeof(Triangle);
+            case EllipseBase::typeKey:
+                return sizeof(Ellipse);
+            case ListPathBase::typeKey:
+                return sizeof(ListPath);
+            case ClippingShapeBase::typeKey:
+                return sizeof(ClippingShape);
+            case PolygonBase::typeKey:
+                return sizeof(Polygon);
+            case StarBase::typeKey:
+                return sizeof(Star);
+            case ImageBase::typeKey:
+                return sizeof(Image);
+            case CubicDetachedVertexBase::typeKey:
+                return sizeof(CubicDetachedVertex);
+            case CustomPropertyGroupBase::typeKey:
+                return sizeof(CustomPropertyGroup);
+            case EventBase::typeKey:
+                return sizeof(Event);
+            case DrawRulesBase::typeKey:
+                return sizeof(DrawRules);
+            case CustomPropertyBooleanBase::typeKey:
+                return sizeof(CustomPropertyBoolean);
+            case LayoutComponentBase::typeKey:
+                return sizeof(LayoutComponent);
+            case ArtboardBase::typeKey:
+                return sizeof(Artboard);
+            case JoystickBase::typeKey:
+                return sizeof(Joystick);
+            case BackboardBase::typeKey:
+                return sizeof(Backboard);
+            case OpenUrlEventBase::typeKey:
+                return sizeof(OpenUrlEvent);
+            case BindablePropertyArtboardBase::typeKey:
+                return sizeof(BindablePropertyArtboard);
+            case BindablePropertyIntegerBase::typeKey:
+                return sizeof(BindablePropertyInteger);
+            case BindablePropertyTriggerBase::typeKey:
+                return sizeof(BindablePropertyTrigger);
+            case BindablePropertyBooleanBase::typeKey:
+                return sizeof(BindablePropertyBoolean);
+            case DataBindBase::typeKey:
+                return sizeof(DataBind);
+            case BindablePropertyAssetBase::typeKey:
+                return sizeof(BindablePropertyAsset);
+            case DataConverterNumberToListBase::typeKey:
+                return sizeof(DataConverterNumberToList);
+            case DataConverterFormulaBase::typeKey:
+                return sizeof(DataConverterFormula);
+            case DataConverterToNumberBase::typeKey:
+                return sizeof(DataConverterToNumber);
+            case DataConverterOperationBase::typeKey:
+                return sizeof(DataConverterOperation);
+            case DataConverterOperationValueBase::typeKey:
+                return sizeof(DataConverterOperationValue);
+            case DataConverterSystemDegsToRadsBase::typeKey:
+                return sizeof(DataConverterSystemDegsToRads);
+            case DataConverterRangeMapperBase::typeKey:
+                return sizeof(DataConverterRangeMapper);
+            case DataConverterInterpolatorBase::typeKey:
+                return sizeof(DataConverterInterpolator);
+            case DataConverterSystemNormalizerBase::typeKey:
+                return sizeof(DataConverterSystemNormalizer);
+            case DataConverterListToLengthBase::typeKey:
+                return sizeof(DataConverterListToLength);
+            case DataConverterGroupItemBase::typeKey:
+                return sizeof(DataConverterGroupItem);
+            case DataConverterGroupBase::typeKey:
+                return sizeof(DataConverterGroup);
+            case DataConverterStringRemoveZerosBase::typeKey:
+                return sizeof(DataConverterStringRemoveZeros);
+            case DataConverterRounderBase::typeKey:
+                return sizeof(DataConverterRounder);
+            case DataConverterStringPadBase::typeKey:
+                return sizeof(DataConverterStringPad);
+            case DataConverterTriggerBase::typeKey:
+                return sizeof(DataConverterTrigger);
+            case DataConverterStringTrimBase::typeKey:
+                return sizeof(DataConverterStringTrim);
+            case FormulaTokenBase::typeKey:
+                return sizeof(FormulaToken);
+            case FormulaTokenArgumentSeparatorBase::typeKey:
+                return sizeof(FormulaTokenArgumentSeparator);
+            case FormulaTokenParenthesisBase::typeKey:
+                return sizeof(FormulaTokenParenthesis);
+            case FormulaTokenParenthesisCloseBase::typeKey:
+                return sizeof(FormulaTokenParenthesisClose);
+            case FormulaTokenOperationBase::typeKey:
+                return sizeof(FormulaTokenOperation);
+            case FormulaTokenFunctionBase::typeKey:
+                return sizeof(FormulaTokenFunction);
+            case FormulaTokenValueBase::typeKey:
+                return sizeof(FormulaTokenValue);
+            case FormulaTokenParenthesisOpenBase::typeKey:
+                return sizeof(FormulaTokenParenthesisOpen);
+            case FormulaTokenInputBase::typeKey:
+                return sizeof(FormulaTokenInput);
+            case DataConverterOperationViewModelBase::typeKey:
+                return sizeof(DataConverterOperationViewModel);
+            case DataConverterBooleanNegateBase::typeKey:
+                return sizeof(DataConverterBooleanNegate);
+            case DataConverterToStringBase::typeKey:
+                return sizeof(DataConverterToString);
+            case DataBindContextBase::typeKey:
+                return sizeof(DataBindContext);
+            case BindablePropertyListBase::typeKey:
+                return sizeof(BindablePropertyList);
+            case BindablePropertyStringBase::typeKey:
+                return sizeof(BindablePropertyString);
+            case BindablePropertyNumberBase::typeKey:
+                return sizeof(BindablePropertyNumber);
+            case BindablePropertyEnumBase::typeKey:
+                return sizeof(BindablePropertyEnum);
+            case BindablePropertyColorBase::typeKey:
+                return sizeof(BindablePropertyColor);
+            case NestedArtboardLeafBase::typeKey:
+                return sizeof(NestedArtboardLeaf);
+            case WeightBase::typeKey:
+                return sizeof(Weight);
+            case BoneBase::typeKey:
+                return sizeof(Bone);
+            case RootBoneBase::typeKey:
+                return sizeof(RootBone);
+            case SkinBase::typeKey:
+                return sizeof(Skin);
+            case TendonBase::typeKey:
+                return sizeof(Tendon);
+            case CubicWeightBase::typeKey:
+                return sizeof(CubicWeight);
+            case TextModifierRangeBase::typeKey:
+                return sizeof(TextModifierRange);
+            case TextFollowPathModifierBase::typeKey:
+                return sizeof(TextFollowPathModifier);
+            case TextInputCursorBase::typeKey:
+                return sizeof(TextInputCursor);
+            case TextInputTextBase::typeKey:
+                return sizeof(TextInputText);
+            case TextStyleFeatureBase::typeKey:
+                return sizeof(TextStyleFeature);
+            case TextVariationModifierBase::typeKey:
+                return sizeof(TextVariationModifier);
+            case TextModifierGroupBase::typeKey:
+                return sizeof(TextModifierGroup);
+            case TextStyleBase::typeKey:
+                return sizeof(TextStyle);
+            case TextStylePaintBase::typeKey:
+                return sizeof(TextStylePaint);
+            case TextInputSelectedTextBase::typeKey:
+                return sizeof(TextInputSelectedText);
+            case TextInputBase::typeKey:
+                return sizeof(TextInput);
+            case TextStyleAxisBase::typeKey:
+                return sizeof(TextStyleAxis);
+            case TextInputSelectionBase::typeKey:
+                return sizeof(TextInputSelection);
+            case TextBase::typeKey:
+                return sizeof(Text);
+            case TextValueRunBase::typeKey:
+                return sizeof(TextValueRun);
+            case CustomPropertyEnumBase::typeKey:
+                return sizeof(CustomPropertyEnum);
+            case CustomPropertyStringBase::typeKey:
+                return sizeof(CustomPropertyString);
+            case FolderBase::typeKey:
+                return sizeof(Folder);
+            case ImageAssetBase::typeKey:
+                return sizeof(ImageAsset);
+            case FontAssetBase::typeKey:
+                return sizeof(FontAsset);
+            case AudioAssetBase::typeKey:
+                return sizeof(AudioAsset);
+            case FileAssetContentsBase::typeKey:
+                return sizeof(FileAssetContents);
+            case AudioEventBase::typeKey:
+                return sizeof(AudioEvent);
+            case CustomPropertyTriggerBase::typeKey:
+                return sizeof(CustomPropertyTrigger);
+        }
+        return 0;
+    }
     static void setUint(Core* object, int propertyKey, uint32_t value)
     {
         switch (propertyKey)
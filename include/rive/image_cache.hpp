@@ -0,0 +1,109 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#ifndef _RIVE_IMAGE_CACHE_HPP_
+#define _RIVE_IMAGE_CACHE_HPP_
+
+#include "rive/refcnt.hpp"
+#include "rive/renderer.hpp"
+#include "rive/span.hpp"
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace rive
+{
+class Factory;
+
+/// Shares decoded RenderImages between everything that decodes the same
+/// encoded bytes through one Factory, e.g. several Files embedding the same
+/// icon atlas. Images are looked up by a hash of their encoded bytes, and
+/// each entry keeps a copy of those bytes so a hash collision can never
+/// return another image.
+///
+/// Every decode() acquires a use of the returned image, which its caller
+/// hands back with release() once it drops the image. Entries stay alive while
+/// they have uses. Once unused, they're kept for reuse while their decoded
+/// size plus their copy of the encoded bytes fits in the byte budget, least
+/// recently used first to go. A budget of 0 only shares images that are still
+/// in use.
+class ImageCache : public RefCnt<ImageCache>
+{
+public:
+    explicit ImageCache(size_t byteBudget = 0) : m_byteBudget(byteBudget) {}
+
+    /// Returns the cached image decoded from the same bytes at the same
+    /// target size, or decodes them with factory and caches the result.
+    /// Returns null when the bytes can't be decoded. Acquires a use of the
+    /// returned image.
+    rcp<RenderImage> decode(Factory* factory,
+                            Span<const uint8_t> encoded,
+                            uint32_t targetWidth = 0,
+                            uint32_t targetHeight = 0);
+
+    size_t byteBudget() const { return m_byteBudget; }
+    void byteBudget(size_t budget);
+
+    /// Releases a use acquired by decode(). Images the cache doesn't hold,
+    /// e.g. after clear(), are ignored.
+    void release(const RenderImage* image);
+
+    /// Drops every entry that has no uses anymore.
+    void purgeUnused();
+
+    /// Drops every entry, whether it's in use or not. Images that are still
+    /// referenced stay alive, but are no longer shared.
+    void clear();
+
+    /// Number of images currently cached.
+    size_t count() const;
+    /// Estimated decoded size of the cached images, assuming RGBA8.
+    size_t decodedBytes() const;
+    /// Size of the encoded bytes the cache keeps a copy of.
+    size_t encodedBytes() const;
+    size_t hits() const;
+    size_t misses() const;
+
+    static uint64_t Hash(Span<const uint8_t> encoded);
+
+private:
+    struct Entry
+    {
+        uint64_t hash;
+        std::vector<uint8_t> encoded;
+        uint32_t targetWidth;
+        uint32_t targetHeight;
+        size_t decodedBytes;
+        rcp<RenderImage> image;
+        uint32_t uses;
+
+        // What keeping the entry costs once it's unused.
+        size_t cachedBytes() const { return decodedBytes + encoded.size(); }
+    };
+    using EntryList = std::list<Entry>;
+
+    static bool matches(const Entry& entry,
+                        Span<const uint8_t> encoded,
+                        uint32_t targetWidth,
+                        uint32_t targetHeight);
+    static bool isUnused(const Entry& entry) { return entry.uses == 0; }
+    rcp<RenderImage> acquire(EntryList::iterator entry);
+    void erase(EntryList::iterator entry);
+    void evict();
+
+    mutable std::mutex m_mutex;
+    size_t m_byteBudget;
+    size_t m_decodedBytes = 0;
+    size_t m_encodedBytes = 0;
+    size_t m_hits = 0;
+    size_t m_misses = 0;
+    // Most recently used first.
+    EntryList m_entries;
+    std::unordered_multimap<uint64_t, EntryList::iterator> m_index;
+    std::unordered_map<const RenderImage*, EntryList::iterator> m_images;
+};
+} // namespace rive
+#endif
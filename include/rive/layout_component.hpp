@@ -156,6 +156,22 @@ private:
     float m_forcedHeight = NAN;
     bool m_forceUpdateLayoutBounds = false;
 
+    // The last few sizes measureLayout returned to Yoga, keyed by the
+    // constraints it was asked for. Only valid until our content is marked
+    // dirty, style changes alone don't invalidate them.
+    struct MeasuredSize
+    {
+        float width;
+        LayoutMeasureMode widthMode;
+        float height;
+        LayoutMeasureMode heightMode;
+        Vec2D size;
+    };
+    static constexpr uint8_t maxMeasuredSizes = 4;
+    MeasuredSize m_measuredSizes[maxMeasuredSizes];
+    uint8_t m_measuredSizeCount = 0;
+    uint8_t m_nextMeasuredSize = 0;
+
 #ifdef WITH_RIVE_LAYOUT
 protected:
     void propagateSizeToChildren(ContainerComponent* component);
@@ -298,6 +314,10 @@ public:
 
     void markLayoutNodeDirty(
         bool shouldForceUpdateLayoutBounds = false) override;
+    // Queues a style sync without marking the Yoga node dirty. syncStyle
+    // only dirties the node if the resulting Yoga style actually changed,
+    // so animating a property that doesn't affect layout is free.
+    void markLayoutStyleChanged();
     void markLayoutStyleDirty();
     void clipChanged() override;
     void widthChanged() override;
@@ -310,6 +330,18 @@ public:
                         LayoutMeasureMode widthMode,
                         float height,
                         LayoutMeasureMode heightMode) override;
+    // measureLayout memoized per constraint, used by the Yoga measure
+    // function.
+    Vec2D measureLayoutCached(float width,
+                              LayoutMeasureMode widthMode,
+                              float height,
+                              LayoutMeasureMode heightMode);
+#ifdef TESTING
+    // How many times measureLayoutCached missed its memo and how many times
+    // syncStyle found a style change that dirtied the Yoga node.
+    int measureCount = 0;
+    int styleDirtyCount = 0;
+#endif
 
     ShapePaintPath* worldPath() override;
     ShapePaintPath* localPath() override;
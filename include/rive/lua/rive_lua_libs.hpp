@@ -3,6 +3,7 @@
 #define _RIVE_LUA_LIBS_HPP_
 #include "lua.h"
 #include "lualib.h"
+#include "rive/lua/scripting_profiler.hpp"
 #include "rive/math/raw_path.hpp"
 #include "rive/renderer.hpp"
 #include "rive/math/vec2d.hpp"
@@ -43,6 +44,7 @@ enum class LuaAtoms : int16_t
     close,
     reset,
     add,
+    addPolyline,
 
     // Mat2D
     invert,
@@ -599,9 +601,19 @@ public:
 
     bool registerScript(const char* name, Span<uint8_t> bytecode);
 
+    // Starts attributing time, steps and allocations to profiler scopes.
+    // Module bodies and property listeners are scoped automatically, hosts
+    // scope their own callbacks with pcall below.
+    ScriptingProfiler* enableProfiler();
+    ScriptingProfiler* profiler() { return m_profiler.get(); }
+
+    // lua_pcall that attributes its cost to the named profiler scope.
+    int pcall(const char* scope, int nargs, int nresults);
+
 private:
     lua_State* m_state;
     ScriptingContext* m_context;
+    std::unique_ptr<ScriptingProfiler> m_profiler;
 };
 
 } // namespace rive
@@ -0,0 +1,103 @@
+#ifdef WITH_RIVE_SCRIPTING
+#ifndef _RIVE_SCRIPTING_PROFILER_HPP_
+#define _RIVE_SCRIPTING_PROFILER_HPP_
+#include "lua.h"
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rive
+{
+// Accumulated cost of one profiler scope (a module body or a callback).
+struct ScriptingScopeStats
+{
+    std::string name;
+    uint32_t calls = 0;
+    // Wall time spent in the scope itself, excluding nested scopes.
+    double seconds = 0.0;
+    // Interrupt safepoints (calls, returns and loop back-edges) the scope
+    // reached. Luau has no cheap per-instruction hook so this stands in for
+    // an instruction count.
+    uint64_t steps = 0;
+    uint64_t allocations = 0;
+    uint64_t allocatedBytes = 0;
+    // Number of times the scope was aborted for exceeding the step budget.
+    uint32_t aborts = 0;
+};
+
+// Attributes the cost of running scripts to named scopes. Enable it with
+// ScriptingVM::enableProfiler and run callbacks through ScriptingVM::pcall
+// (or begin/end scopes manually around lua calls). Work done outside of any
+// scope is not recorded.
+class ScriptingProfiler
+{
+public:
+    // Returns the profiler attached to the VM that owns L, if any.
+    static ScriptingProfiler* from(lua_State* L);
+
+    // Scopes nest; work is only attributed to the innermost one.
+    void beginScope(const char* name);
+    void endScope();
+
+    // Limits the number of steps scripts may take between calls to
+    // beginFrame. A script that exceeds it is aborted with a lua error so a
+    // runaway loop can't stall the frame. 0 (the default) disables it.
+    void stepBudget(uint64_t value) { m_stepBudget = value; }
+    uint64_t stepBudget() const { return m_stepBudget; }
+    void beginFrame() { m_frameSteps = 0; }
+    uint64_t frameSteps() const { return m_frameSteps; }
+
+    const std::vector<ScriptingScopeStats>& stats() const { return m_stats; }
+    const ScriptingScopeStats* stats(const std::string& name) const;
+    void clear();
+
+    // Hooks called by the VM.
+    void step(lua_State* L);
+    void allocated(size_t oldSize, size_t newSize);
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    ScriptingScopeStats* current()
+    {
+        return m_stack.empty() ? nullptr : &m_stats[m_stack.back()];
+    }
+    void chargeTime(clock::time_point now);
+
+    std::vector<ScriptingScopeStats> m_stats;
+    std::unordered_map<std::string, size_t> m_indices;
+    std::vector<size_t> m_stack;
+    clock::time_point m_scopeStart;
+    uint64_t m_stepBudget = 0;
+    uint64_t m_frameSteps = 0;
+};
+
+// Begins a profiler scope (if a profiler is attached to L) for the lifetime
+// of the object.
+class ScriptingProfilerScope
+{
+public:
+    ScriptingProfilerScope(lua_State* L, const char* name) :
+        m_profiler(ScriptingProfiler::from(L))
+    {
+        if (m_profiler != nullptr)
+        {
+            m_profiler->beginScope(name);
+        }
+    }
+    ~ScriptingProfilerScope()
+    {
+        if (m_profiler != nullptr)
+        {
+            m_profiler->endScope();
+        }
+    }
+
+private:
+    ScriptingProfiler* m_profiler;
+};
+} // namespace rive
+#endif
+#endif
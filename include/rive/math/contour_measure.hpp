@@ -8,6 +8,7 @@
 #include "rive/math/raw_path.hpp"
 #include "rive/math/vec2d.hpp"
 #include "rive/refcnt.hpp"
+#include "rive/span.hpp"
 #include <utility>
 
 namespace rive
@@ -19,6 +20,11 @@ public:
     static constexpr unsigned kMaxDot30 = (1 << 30) - 1;
     static constexpr float kInvScaleD30 = 1.0f / (float)kMaxDot30;
 
+    struct PosTan
+    {
+        Vec2D pos, tan;
+    };
+
     // Deliberately making this pack well (12 bytes)
     struct Segment
     {
@@ -44,6 +50,9 @@ public:
 
 private:
     size_t findSegment(float distance) const;
+    size_t findSegment(float distance, size_t startIndex) const;
+    size_t findSegment(float distance, size_t* segmentHint) const;
+    PosTan evalSegment(size_t index, float distance) const;
 
     std::vector<Segment> m_segments;
     std::vector<Vec2D> m_points;
@@ -61,10 +70,6 @@ public:
     float length() const { return m_length; }
     bool isClosed() const { return m_isClosed; }
 
-    struct PosTan
-    {
-        Vec2D pos, tan;
-    };
     struct PosTanDistance
     {
         Vec2D pos, tan;
@@ -84,6 +89,19 @@ public:
     };
     PosTan getPosTan(float distance) const;
 
+    // Same as getPosTan, but starts looking for the segment containing
+    // distance at *segmentHint and stores the segment it found there. A
+    // sequence of queries at increasing distances sharing a hint sweeps
+    // the contour once instead of searching it for each query.
+    PosTan getPosTan(float distance, size_t* segmentHint) const;
+
+    // Computes the position and tangent at each of distances in a single
+    // forward sweep over the segments, evaluating points that land on the
+    // same cubic together. Distances should be sorted in increasing order;
+    // unsorted distances are still correct but search from scratch each
+    // time they go backwards.
+    void getPosTans(Span<const float> distances, PosTan out[]) const;
+
     void getSegment(float startDistance,
                     float endDistance,
                     RawPath* dst,
@@ -15,6 +15,8 @@
 
 namespace rive
 {
+class Mat2D;
+class RawPath;
 
 class HitTester
 {
@@ -52,5 +54,43 @@ public:
                          Span<uint16_t> indices);
 };
 
+// Paths flattened into line segments once so that many point queries can be
+// answered analytically instead of rasterizing the paths for each query.
+class HitTestPolygon
+{
+public:
+    void rewind();
+    // Flattens path (transformed by xform) into the polygon.
+    void addPath(const RawPath& path, const Mat2D& xform);
+    bool empty() const { return m_edges.empty(); }
+    const AABB& bounds() const { return m_bounds; }
+
+    // Whether the square of half size radius centered at point overlaps the
+    // area filled with rule. Open contours are implicitly closed.
+    bool testFill(Vec2D point, float radius, FillRule rule) const;
+
+    // Whether point is within radius of the polygon's outline, not counting
+    // the edges implicitly closing open contours.
+    bool testStroke(Vec2D point, float radius) const;
+
+private:
+    struct Edge
+    {
+        Vec2D p0, p1;
+        AABB bounds;
+        // Added to close an open contour for filling, not stroked.
+        bool implicit;
+    };
+
+    void addEdge(Vec2D p0, Vec2D p1, bool implicit);
+    void closeContour();
+
+    std::vector<Edge> m_edges;
+    AABB m_bounds;
+    Vec2D m_contourStart;
+    Vec2D m_last;
+    bool m_hasContour = false;
+};
+
 } // namespace rive
 #endif
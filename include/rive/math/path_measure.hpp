@@ -15,9 +15,36 @@ public:
     ContourMeasure::PosTanDistance atDistance(float distance) const;
     ContourMeasure::PosTanDistance atPercentage(float percentageDistance) const;
 
+    // Remembers where the previous query landed so that a sequence of
+    // queries at increasing distances (like the glyphs of a line of text)
+    // doesn't search the path from scratch each time.
+    struct Cursor
+    {
+        size_t contourIndex = 0;
+        size_t segmentIndex = 0;
+    };
+    ContourMeasure::PosTanDistance atDistance(float distance,
+                                              Cursor* cursor) const;
+    ContourMeasure::PosTanDistance atPercentage(float percentageDistance,
+                                                Cursor* cursor) const;
+
+    // Batch versions of atDistance and atPercentage. Distances are resolved
+    // in one sweep along the path, so they should be sorted in increasing
+    // order (wrapped percentages may restart once).
+    void atDistances(Span<const float> distances,
+                     ContourMeasure::PosTanDistance out[]) const;
+    void atPercentages(Span<const float> percentageDistances,
+                       ContourMeasure::PosTanDistance out[]) const;
+
     float length() const { return m_length; }
 
 private:
+    // Returns the index of the contour containing distance and makes
+    // distance relative to it, or returns the contour count if distance is
+    // past the end of the path.
+    size_t findContour(float* distance) const;
+    float percentageToDistance(float percentageDistance) const;
+
     float m_length;
     std::vector<rcp<ContourMeasure>> m_contours;
 };
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#ifndef _RIVE_MEMORY_USAGE_HPP_
+#define _RIVE_MEMORY_USAGE_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace rive
+{
+
+class Core;
+class RawPath;
+
+/// Estimated bytes held by a File, ArtboardInstance or StateMachineInstance,
+/// broken down by category. Sizes are computed from object sizes and
+/// container capacities, they don't include allocator overhead.
+struct MemoryUsage
+{
+    /// Core objects and the containers that hold them.
+    size_t objects = 0;
+    /// Vertices and RawPaths built for shapes and composed paths.
+    size_t paths = 0;
+    /// Animations, keyframes, state machines and their runtime state.
+    size_t animation = 0;
+    /// Unicode text, shaping and line breaking results.
+    size_t text = 0;
+    /// Decoded images, audio and asset metadata. Font data isn't exposed by
+    /// the text engine and isn't counted.
+    size_t assets = 0;
+    /// Geometry handed to the Factory as RenderPaths.
+    size_t factoryResources = 0;
+
+    size_t total() const
+    {
+        return objects + paths + animation + text + assets + factoryResources;
+    }
+
+    MemoryUsage& operator+=(const MemoryUsage& other)
+    {
+        objects += other.objects;
+        paths += other.paths;
+        animation += other.animation;
+        text += other.text;
+        assets += other.assets;
+        factoryResources += other.factoryResources;
+        return *this;
+    }
+
+    /// Size of a Core object, looked up by its type key.
+    static size_t objectBytes(const Core* object);
+
+    /// Bytes held by a RawPath's points and verbs.
+    static size_t rawPathBytes(const RawPath& rawPath);
+
+    template <typename T> static size_t vectorBytes(const std::vector<T>& v)
+    {
+        return v.capacity() * sizeof(T);
+    }
+
+    static size_t stringBytes(const std::string& s)
+    {
+        // Short strings live inside the std::string itself.
+        return s.capacity() > 15 ? s.capacity() + 1 : 0;
+    }
+};
+
+} // namespace rive
+#endif
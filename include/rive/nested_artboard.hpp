@@ -43,6 +43,14 @@ private:
     Artboard* findArtboard(
         ViewModelInstanceArtboard* viewModelInstanceArtboard);
     void clearNestedAnimations();
+    // Marks layouts measuring us dirty when the instance's size no longer
+    // matches what the last measureLayout reported.
+    void instanceSizeChanged();
+
+    // Instance size seen by the last measureLayout, so that layouts can drop
+    // their memoized measures when it changes.
+    Vec2D m_measuredInstanceSize;
+    bool m_isMeasured = false;
 
 public:
     NestedArtboard();
@@ -109,7 +117,7 @@ public:
     bool hitTestHost(const Vec2D& position,
                      bool skipOnUnclipped,
                      ArtboardInstance* artboard) override;
-    void markHostTransformDirty() override { markTransformDirty(); }
+    void markHostTransformDirty() override;
     void file(File*) override;
     File* file() const override;
 };
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#ifndef _RIVE_PROFILER_HPP_
+#define _RIVE_PROFILER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rive
+{
+/// Built-in profiler the RIVE_PROF_* macros compile to when RIVE_PROFILER is
+/// defined (premake --with_rive_profiler). Meant for builds without Optick,
+/// e.g. headless servers.
+///
+/// Every thread records into its own fixed size buffers without taking locks:
+/// per scope counts, total and max time and allocations, plus a ring of the
+/// most recent scope events for Chrome traces. Queries may run on any thread
+/// and see a slightly stale snapshot of the others. Buffers are handed back
+/// when their thread exits and reused by the next new thread.
+class Profiler
+{
+public:
+    // Opaque per thread record of one scope name.
+    struct ScopeSlot;
+
+    struct ScopeStats
+    {
+        std::string name;
+        uint64_t count = 0;
+        uint64_t totalNanoseconds = 0;
+        uint64_t maxNanoseconds = 0;
+        uint64_t allocationCount = 0;
+        uint64_t allocatedBytes = 0;
+    };
+
+    /// Times the enclosing C++ scope. name must outlive the profiler, e.g. a
+    /// string literal or __FUNCTION__.
+    class Scope
+    {
+    public:
+        explicit Scope(const char* name);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        // Null when the profiler was disabled as the scope opened.
+        ScopeSlot* m_slot;
+        ScopeSlot* m_parentSlot;
+        uint64_t m_startNanoseconds;
+    };
+
+    /// Recording can be turned off at runtime, leaving one branch per scope.
+    static void enabled(bool value);
+    static bool enabled();
+
+    /// Marks the start of a frame.
+    static void frame();
+    static uint64_t frameCount();
+
+    /// Names the calling thread in traces.
+    static void threadName(const char* name);
+
+    /// Attributes an allocation to the innermost open scope on the calling
+    /// thread. Call it from an allocation hook, e.g. a global operator new.
+    static void recordAllocation(size_t bytes);
+
+    /// Stats for every scope recorded so far, summed across threads and
+    /// sorted by total time, longest first.
+    static std::vector<ScopeStats> stats();
+
+    /// Clears stats, events and the frame count on every thread. Safe to call
+    /// while other threads record: each thread clears its own buffer before
+    /// its next record, and queries ignore it until it has.
+    static void reset();
+
+    /// Recent scope events in Chrome's trace event format, for
+    /// chrome://tracing or Perfetto.
+    static std::string chromeTraceJSON();
+
+#ifdef TESTING
+    /// Number of thread buffers ever allocated.
+    static size_t threadBufferCount();
+#endif
+};
+} // namespace rive
+#endif
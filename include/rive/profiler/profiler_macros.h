@@ -21,6 +21,21 @@
 #define RIVE_PROF_SCOPENAME(name) OPTICK_EVENT(name)
 #define RIVE_PROF_TAG(cat, tag) OPTICK_TAG(cat, tag)
 #define RIVE_PROF_THREAD(name) OPTICK_THREAD(name)
+#elif defined(RIVE_PROFILER) // Built-in profiler
+#include "rive/profiler/profiler.hpp"
+#define RIVE_PROF_CONCAT_(a, b) a##b
+#define RIVE_PROF_CONCAT(a, b) RIVE_PROF_CONCAT_(a, b)
+#ifdef _MSC_VER
+#define RIVE_PROF_FUNCTION __FUNCTION__
+#else
+#define RIVE_PROF_FUNCTION __PRETTY_FUNCTION__
+#endif
+#define RIVE_PROF_FRAME() rive::Profiler::frame();
+#define RIVE_PROF_SCOPE() RIVE_PROF_SCOPENAME(RIVE_PROF_FUNCTION)
+#define RIVE_PROF_SCOPENAME(name)                                              \
+    rive::Profiler::Scope RIVE_PROF_CONCAT(riveProfScope, __LINE__)(name);
+#define RIVE_PROF_TAG(cat, tag)
+#define RIVE_PROF_THREAD(name) rive::Profiler::threadName(name);
 #else // No profiler selected - fallback to no-op
 #define RIVE_PROF_FRAME()
 #define RIVE_PROF_SCOPE()
@@ -19,7 +19,9 @@
 #include "utils/lite_rtti.hpp"
 #include "rive/math/raw_path.hpp"
 #include <stdio.h>
+#include <algorithm>
 #include <cstdint>
+#include <vector>
 
 namespace rive
 {
@@ -153,18 +155,38 @@ public:
     int height() const { return m_Height; }
     const Mat2D& uvTransform() const { return m_uvTransform; }
 
+    // Estimated size of the decoded pixels, assuming RGBA8. Images decoded
+    // smaller than width() x height() report the size actually stored.
+    virtual size_t decodedByteSize() const
+    {
+        return (size_t)m_Width * m_Height * 4;
+    }
+
 #if defined(__EMSCRIPTEN__)
-    void delegate(RenderImageDelegate* delegate) { m_delegate = delegate; }
+    // An image shared through an ImageCache may have several delegates, each
+    // of them is told when it finishes decoding.
+    void addDelegate(RenderImageDelegate* delegate)
+    {
+        m_delegates.push_back(delegate);
+    }
+    void removeDelegate(RenderImageDelegate* delegate)
+    {
+        m_delegates.erase(
+            std::remove(m_delegates.begin(), m_delegates.end(), delegate),
+            m_delegates.end());
+    }
     void decodedAsync() const
     {
-        if (m_delegate != nullptr)
+        // Copied so delegates may remove themselves while being notified.
+        auto delegates = m_delegates;
+        for (auto delegate : delegates)
         {
-            m_delegate->decodedAsync();
+            delegate->decodedAsync();
         }
     }
 
 private:
-    RenderImageDelegate* m_delegate = nullptr;
+    std::vector<RenderImageDelegate*> m_delegates;
 #endif
 };
 
@@ -220,6 +242,10 @@ public:
                                BlendMode,
                                float opacity) = 0;
 
+    // The transform currently applied to draws. Renderers that don't track
+    // it report identity.
+    virtual Mat2D currentTransform() const { return Mat2D(); }
+
     // helpers
 
     void translate(float x, float y);
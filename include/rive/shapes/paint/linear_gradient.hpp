@@ -2,6 +2,7 @@
 #define _RIVE_LINEAR_GRADIENT_HPP_
 #include "rive/generated/shapes/paint/linear_gradient_base.hpp"
 #include "rive/math/vec2d.hpp"
+#include "rive/renderer.hpp"
 #include "rive/shapes/paint/color.hpp"
 #include "rive/shapes/paint/shape_paint_mutator.hpp"
 #include <vector>
@@ -31,12 +32,15 @@ protected:
     void opacityChanged() override;
     void renderOpacityChanged() override;
 
-    virtual void makeGradient(RenderPaint* renderPaint,
-                              Vec2D start,
-                              Vec2D end,
-                              const ColorInt[],
-                              const float[],
-                              size_t count) const;
+    // Returns the gradient shader for the given geometry and stops, updating
+    // `shader` (the one previously returned for our own paint, if any) in
+    // place when the factory supports it.
+    virtual rcp<RenderShader> makeGradient(rcp<RenderShader> shader,
+                                           Vec2D start,
+                                           Vec2D end,
+                                           const ColorInt[],
+                                           const float[],
+                                           size_t count) const;
 
 private:
     // Set m_deformer from the shape paint container
@@ -46,6 +50,7 @@ private:
     Node* m_shapePaintContainer = nullptr;
     PointDeformer* m_deformer = nullptr;
     std::vector<ColorInt> m_colorStorage;
+    rcp<RenderShader> m_shader;
 };
 } // namespace rive
 
@@ -6,12 +6,12 @@ namespace rive
 class RadialGradient : public RadialGradientBase
 {
 public:
-    void makeGradient(RenderPaint* renderPaint,
-                      Vec2D start,
-                      Vec2D end,
-                      const ColorInt[],
-                      const float[],
-                      size_t count) const override;
+    rcp<RenderShader> makeGradient(rcp<RenderShader> shader,
+                                   Vec2D start,
+                                   Vec2D end,
+                                   const ColorInt[],
+                                   const float[],
+                                   size_t count) const override;
 };
 } // namespace rive
 
@@ -26,7 +26,12 @@ public:
 
     void pathCollapseChanged();
 
+    // Builds the paths now if their last update was deferred.
+    void updateDeferred();
+
 private:
+    void buildPaths();
+
     Shape* m_shape;
     ShapePaintPath m_localPath;
     ShapePaintPath m_worldPath;
@@ -6,6 +6,7 @@
 #include "rive/shapes/path_composer.hpp"
 #include "rive/shapes/shape_paint_container.hpp"
 #include "rive/drawable_flag.hpp"
+#include "rive/math/hit_test.hpp"
 #include <vector>
 
 namespace rive
@@ -22,6 +23,10 @@ private:
     std::vector<Path*> m_Paths;
     AABB m_WorldBounds;
     float m_WorldLength = -1;
+    // World space outline used by hitTestHiFi, rebuilt lazily after the
+    // paths change.
+    HitTestPolygon m_hitPolygon;
+    bool m_hitPolygonDirty = true;
 
     bool m_WantDifferencePath = false;
     RenderPathDeformer* m_deformer = nullptr;
@@ -32,7 +37,16 @@ public:
     Shape();
     void buildDependencies() override;
     bool collapse(bool value) override;
+    // Whether the composed paths can skip rebuilding until they're needed:
+    // the shape is fully transparent or outside its artboard's cull rect.
     bool canDeferPathUpdate();
+    // Whether the raw paths can skip rebuilding. Culling doesn't apply to
+    // them, they keep the bounds used to decide whether the shape is culled
+    // accurate.
+    bool canDeferRawPathUpdate();
+    // Whether the shape, including what its paints draw outside its paths,
+    // lies entirely outside the cull rect its artboard was last drawn with.
+    bool isCulled();
     void addPath(Path* path);
     void addToRenderPath(RenderPath* commandPath, const Mat2D& transform);
     std::vector<Path*>& paths() { return m_Paths; }
@@ -42,6 +56,11 @@ public:
     void update(ComponentDirt value) override;
     void draw(Renderer* renderer) override;
     Core* hitTest(HitInfo*, const Mat2D&) override;
+    // Draws this shape with source's RenderPaths wherever a paint's path
+    // holds the same geometry as source's (source being the same shape in
+    // another instance of the same artboard, drawn first). Paths that share
+    // are appended to shared so the caller can stop sharing after drawing.
+    void shareRenderPaths(Shape* source, std::vector<ShapePaintPath*>& shared);
 
     const PathComposer* pathComposer() const { return &m_PathComposer; }
     PathComposer* pathComposer() { return &m_PathComposer; }
@@ -77,6 +96,7 @@ public:
         drawableFlags(drawableFlags() & ~static_cast<unsigned short>(
                                             DrawableFlag::WorldBoundsClean));
         m_WorldLength = -1;
+        m_hitPolygonDirty = true;
     }
 
     AABB computeWorldBounds(const Mat2D* xform = nullptr) const;
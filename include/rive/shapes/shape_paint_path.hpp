@@ -3,6 +3,7 @@
 
 #include "rive/math/raw_path.hpp"
 #include "rive/renderer.hpp"
+#include <atomic>
 
 namespace rive
 {
@@ -15,8 +16,22 @@ public:
     ShapePaintPath(bool isLocal, FillRule fillRule);
     RenderPath* renderPath(const Component* component);
     RenderPath* renderPath(Factory* factory);
+
+    /// Draws with source's RenderPath instead of building an identical one,
+    /// as long as both paths hold the same geometry. Returns false when the
+    /// geometry differs or source hasn't built its RenderPath. Sharing stops
+    /// when this path is rewound or stopSharingRenderPath is called. Once the
+    /// geometry matched, it's only compared again after either path changes.
+    bool shareRenderPath(const ShapePaintPath* source);
+    void stopSharingRenderPath() { m_sharedRenderPath = nullptr; }
+    bool sharesRenderPath() const { return m_sharedRenderPath != nullptr; }
+
     const RawPath* rawPath() const { return &m_rawPath; }
-    RawPath* mutableRawPath() { return &m_rawPath; }
+    RawPath* mutableRawPath()
+    {
+        changed();
+        return &m_rawPath;
+    }
     bool isLocal() const { return m_isLocal; }
     FillRule fillRule() const { return m_fillRule; }
     bool empty() const { return m_rawPath.empty(); }
@@ -54,6 +69,7 @@ public:
     void addRect(const AABB& aabb, PathDirection dir = PathDirection::cw)
     {
         m_rawPath.addRect(aabb, dir);
+        changed();
     }
 
     const bool hasRenderPath() const
@@ -62,6 +78,8 @@ public:
     }
 
 #ifdef TESTING
+    // Times shareRenderPath compared this path's points with a source's.
+    int geometryComparisons = 0;
     size_t numContours()
     {
         size_t contours = 0;
@@ -76,8 +94,25 @@ public:
     }
 #endif
 private:
+    // Stamps the geometry with a new revision. Revisions are unique across
+    // all paths, so a remembered match can't be confused with another path
+    // allocated at the same address.
+    void changed()
+    {
+        m_revision = sm_nextRevision.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static std::atomic<uint64_t> sm_nextRevision;
+
     bool m_isRenderPathDirty = true;
     rcp<RenderPath> m_renderPath;
+    rcp<RenderPath> m_sharedRenderPath;
+    uint64_t m_revision = 0;
+    // The source and revisions of both paths the last time shareRenderPath
+    // found their geometry equal.
+    const ShapePaintPath* m_matchedSource = nullptr;
+    uint64_t m_matchedRevision = 0;
+    uint64_t m_matchedSourceRevision = 0;
     RawPath m_rawPath;
     bool m_isLocal;
     FillRule m_fillRule = FillRule::clockwise;
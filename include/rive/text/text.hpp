@@ -131,6 +131,9 @@ public:
         return false;
 #endif
     }
+
+    /// Bytes held by the unicode text, shaping and line breaking results.
+    size_t shapedTextBytes() const;
 #ifdef TESTING
     const std::vector<OrderedLine>& orderedLines() const
     {
@@ -29,6 +29,8 @@ private:
     RawPath m_worldPath;
     RawPath m_localPath;
     PathMeasure m_pathMeasure;
+    // Glyphs are transformed in order along the path.
+    PathMeasure::Cursor m_pathCursor;
 
     void modifierShapeDirty();
 };
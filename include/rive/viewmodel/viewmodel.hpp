@@ -6,6 +6,7 @@
 #include "rive/viewmodel/symbol_type.hpp"
 #include "rive/refcnt.hpp"
 #include <stdio.h>
+#include <unordered_map>
 namespace rive
 {
 class ViewModel : public ViewModelBase, public RefCnt<ViewModel>
@@ -13,11 +14,16 @@ class ViewModel : public ViewModelBase, public RefCnt<ViewModel>
 private:
     std::vector<ViewModelProperty*> m_Properties;
     std::vector<ViewModelInstance*> m_Instances;
+    // Index of the first property with each name.
+    std::unordered_map<std::string, size_t> m_PropertyIndices;
 
 public:
     ~ViewModel();
     void addProperty(ViewModelProperty* property);
     ViewModelProperty* property(const std::string& name);
+    // Returns the index (which is also the id instance values refer to it
+    // by) of the property with the given name, or -1 if there is none.
+    int propertyIndex(const std::string& name) const;
     ViewModelProperty* property(SymbolType symbolType);
     ViewModelProperty* property(size_t index);
     void addInstance(ViewModelInstance* value);
@@ -14,7 +14,13 @@ class ViewModelInstance : public ViewModelInstanceBase,
 {
 private:
     std::vector<ViewModelInstanceValue*> m_PropertyValues;
-    ViewModel* m_ViewModel;
+    // m_PropertyValues indexed by their viewModelPropertyId (the index of
+    // their property in the view model) for constant time lookups. Ids come
+    // from file data, so only ids below kMaxIndexedPropertyId are indexed
+    // and larger ones fall back to a linear scan.
+    static constexpr uint32_t kMaxIndexedPropertyId = 1024;
+    std::vector<ViewModelInstanceValue*> m_PropertyValuesById;
+    ViewModel* m_ViewModel = nullptr;
 
 public:
     ~ViewModelInstance();
@@ -13,10 +13,7 @@ private:
 
 public:
     ~ViewModelInstanceViewModel();
-    void referenceViewModelInstance(rcp<ViewModelInstance> value)
-    {
-        m_referenceViewModelInstance = value;
-    };
+    void referenceViewModelInstance(rcp<ViewModelInstance> value);
     rcp<ViewModelInstance> referenceViewModelInstance()
     {
         return m_referenceViewModelInstance;
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2022 Rive
+ */
+
+#ifndef _RIVE_SERIALIZE_OP_HPP_
+#define _RIVE_SERIALIZE_OP_HPP_
+
+namespace rive
+{
+// Opcodes written by SerializingFactory/SerializingRenderer and consumed by
+// SerializedStreamReplayer. Values are part of the .sriv format, do not
+// renumber.
+enum class SerializeOp : unsigned char
+{
+    makeRenderBuffer = 0,
+    makeLinearGradient = 1,
+    makeRadialGradient = 2,
+    makeRenderPath = 3,
+    makeRenderPaint = 5,
+    decodeImage = 6,
+    save = 7,
+    restore = 8,
+    transform = 9,
+    drawPath = 10,
+    clipPath = 11,
+    drawImage = 12,
+    drawImageMesh = 13,
+
+    // RenderBuffer
+    setVertexBufferData = 14,
+    setIndexBufferData = 15,
+
+    // RenderPath
+    addRawPath = 16,
+    rewind = 17,
+    fillRule = 18,
+
+    // RenderPaint
+    style = 20,
+    color = 21,
+    thickness = 22,
+    join = 23,
+    cap = 24,
+    feather = 25,
+    blendMode = 26,
+    shader = 27,
+
+    frame = 28,
+    frameSize = 29,
+};
+} // namespace rive
+#endif
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#ifndef _RIVE_SERIALIZED_STREAM_REPLAYER_HPP_
+#define _RIVE_SERIALIZED_STREAM_REPLAYER_HPP_
+
+#include "rive/factory.hpp"
+#include "rive/math/raw_path.hpp"
+#include "rive/renderer.hpp"
+#include "rive/span.hpp"
+#include "utils/serialize_op.hpp"
+#include <vector>
+
+namespace rive
+{
+// Re-issues a stream captured by SerializingFactory against any Factory and
+// Renderer. The stream is decoded once up front so that replaying a frame
+// only pays for the factory and renderer calls themselves, which makes it
+// suitable for benchmarking renderers on recorded frames independently of
+// animation cost:
+//
+//   SerializedStreamReplayer replayer;
+//   replayer.load(bytes);
+//   for (size_t i = 0; i < replayer.frameCount(); i++)
+//   {
+//       replayer.replayFrame(i, factory, renderer);
+//   }
+//
+// Resources (paths, paints, shaders, buffers, images) are created lazily as
+// their ops are encountered, exactly like the original run, so frames must be
+// replayed in order. Call reset() to release them and start over at frame 0.
+class SerializedStreamReplayer
+{
+public:
+    // Decodes a .sriv stream. Returns false if the header or any op is
+    // malformed, in which case no frames are available.
+    bool load(Span<const uint8_t> stream);
+
+    size_t frameCount() const { return m_frames.size(); }
+    uint32_t frameWidth() const { return m_frameWidth; }
+    uint32_t frameHeight() const { return m_frameHeight; }
+
+    // Number of drawPath, drawImage and drawImageMesh calls in a frame.
+    size_t drawCount(size_t frameIndex) const
+    {
+        return m_frames[frameIndex].drawCount;
+    }
+    size_t totalDrawCount() const { return m_totalDrawCount; }
+
+    // Re-issues every factory and renderer call recorded for the given frame.
+    // Must be called with frameIndex == nextFrame().
+    void replayFrame(size_t frameIndex, Factory*, Renderer*);
+    size_t nextFrame() const { return m_nextFrame; }
+
+    // Releases every resource created by previous replays.
+    void reset();
+
+private:
+    struct Command
+    {
+        SerializeOp op;
+        // Id of the resource the op creates or targets.
+        uint32_t id;
+        // Op specific integer arguments (paint id, enum values, buffer ids).
+        uint32_t args[3];
+        float value;
+        // Range of the op's payload in one of the side arrays below.
+        uint32_t offset;
+        uint32_t count;
+    };
+
+    struct Frame
+    {
+        size_t firstCommand;
+        size_t commandCount;
+        size_t drawCount;
+    };
+
+    void execute(const Command&, Factory*, Renderer*);
+
+    template <typename T>
+    static T* resource(std::vector<rcp<T>>& table, uint32_t id)
+    {
+        return id < table.size() ? table[id].get() : nullptr;
+    }
+    template <typename T>
+    static void setResource(std::vector<rcp<T>>& table,
+                            uint32_t id,
+                            rcp<T> value)
+    {
+        if (id >= table.size())
+        {
+            table.resize(id + 1);
+        }
+        table[id] = std::move(value);
+    }
+
+    std::vector<Command> m_commands;
+    std::vector<Frame> m_frames;
+    size_t m_totalDrawCount = 0;
+    uint32_t m_frameWidth = 0;
+    uint32_t m_frameHeight = 0;
+
+    // Payloads referenced by Command::offset/count.
+    std::vector<float> m_floats;
+    std::vector<ColorInt> m_colors;
+    std::vector<float> m_stops;
+    std::vector<uint16_t> m_indices;
+    std::vector<uint8_t> m_bytes;
+    std::vector<RawPath> m_rawPaths;
+
+    // Live resources, indexed by their serialized id.
+    size_t m_nextFrame = 0;
+    std::vector<rcp<RenderBuffer>> m_buffers;
+    std::vector<rcp<RenderShader>> m_shaders;
+    std::vector<rcp<RenderPath>> m_paths;
+    std::vector<rcp<RenderPaint>> m_paints;
+    std::vector<rcp<RenderImage>> m_images;
+};
+} // namespace rive
+#endif
@@ -54,6 +54,10 @@ public:
     void save(const char* filename);
     bool matches(const char* filename);
 
+    // The serialized stream recorded so far, suitable for
+    // SerializedStreamReplayer.
+    Span<const uint8_t> buffer() const { return m_buffer; }
+
 private:
     void saveTarnished(const char* filename);
 
@@ -30,6 +30,10 @@ filter({ 'options:with_rive_layout' })
 do
     defines({ 'WITH_RIVE_LAYOUT' })
 end
+filter({ 'options:with_rive_profiler' })
+do
+    defines({ 'RIVE_PROFILER' })
+end
 filter({})
 
 dependencies = path.getabsolute('dependencies/')
@@ -162,3 +166,8 @@ newoption({
     trigger = 'with_rive_layout',
     description = 'Compiles in layout features.',
 })
+
+newoption({
+    trigger = 'with_rive_profiler',
+    description = 'Routes the RIVE_PROF macros to the built-in profiler.',
+})
@@ -192,6 +192,12 @@ struct PlatformFeatures
     // DrawType::renderPassInitialize when LoadAction::preserveRenderTarget is
     // specified.
     bool msaaColorPreserveNeedsDraw = false;
+    // The gradient texture keeps its contents between flushes (i.e., the
+    // backend doesn't clear or invalidate it before rendering color ramps).
+    // Complex color ramps then stay resident in their rows across frames, and
+    // only get rendered again after their row is evicted or the texture is
+    // reallocated.
+    bool gradTextureIsPersistent = false;
     // Workaround for precision issues. Determines how far apart we space unique
     // path IDs when they will be bit-casted to fp16.
     uint8_t pathIDGranularity = 1;
@@ -384,10 +390,10 @@ enum class PaintType : uint32_t
 };
 
 // Specifies the location of a simple or complex horizontal color ramp within
-// the gradient texture. A simple color ramp is two texels wide, beginning at
-// the specified row and column. A complex color ramp spans the entire width of
-// the gradient texture, on the row:
-//     "GradTextureLayout::complexOffsetY + ColorRampLocation::row".
+// the gradient texture. A complex color ramp spans the entire width of the
+// gradient texture, on the specified row. A simple color ramp is two texels
+// wide, beginning at the specified column of the row:
+//     "GradTextureLayout::simpleOffsetY + ColorRampLocation::row".
 struct ColorRampLocation
 {
     constexpr static uint16_t kComplexGradientMarker = 0xffff;
@@ -443,13 +449,13 @@ private:
 };
 
 // Specifies the height of the gradient texture, and the row at which we
-// transition from simple color ramps to complex.
+// transition from complex color ramps to simple.
 //
 // This information is computed at flush time, once we know exactly how many
-// color ramps of each type will be in the gradient texture.
+// rows the complex color ramps occupy.
 struct GradTextureLayout
 {
-    uint32_t complexOffsetY; // Row of the first complex gradient.
+    uint32_t simpleOffsetY; // Row of the first simple gradient.
     float inverseHeight;     // 1 / textureHeight
 };
 
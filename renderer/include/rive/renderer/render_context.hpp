@@ -12,6 +12,7 @@
 #include "rive/renderer/trivial_block_allocator.hpp"
 #include "rive/shapes/paint/color.hpp"
 #include <array>
+#include <list>
 #include <unordered_map>
 
 class PushRetrofittedTrianglesGMDraw;
@@ -33,6 +34,7 @@ class ImageRectDraw;
 class StencilClipReset;
 class Draw;
 class Gradient;
+class GradientRamp;
 class RenderContextImpl;
 class PathDraw;
 
@@ -46,20 +48,23 @@ enum class ShaderCompilationMode
     standard = allowAsynchronous,
 };
 
-// Used as a key for complex gradients.
+// Used as a key for complex gradients. Holds the gradient's ramp rather than
+// the gradient itself, since a gradient can be updated in place once its draws
+// have been flushed.
 class GradientContentKey
 {
 public:
-    inline GradientContentKey(rcp<const Gradient> gradient);
+    inline GradientContentKey(rcp<const GradientRamp> ramp);
     inline GradientContentKey(GradientContentKey&& other);
     bool operator==(const GradientContentKey&) const;
-    const Gradient* gradient() const { return m_gradient.get(); }
+    const GradientRamp* ramp() const { return m_ramp.get(); }
 
 private:
-    rcp<const Gradient> m_gradient;
+    rcp<const GradientRamp> m_ramp;
 };
 
-// Hashes all stops and all colors in a complex gradient.
+// Hashes all stops and all colors in a complex gradient (precomputed by its
+// GradientRamp).
 class DeepHashGradient
 {
 public:
@@ -239,6 +244,27 @@ public:
     // resources associated with this render context.
     void releaseResources();
 
+    // Running totals for the complex color ramps drawn by this context.
+    //
+    // Complex ramps (more than two stops) keep their row in the gradient
+    // texture across flushes. A hit is a ramp that still had a row; a miss is
+    // one that needed a new row, evicting the least recently used ramp once
+    // every row is taken. uploadedRamps and uploadedSpans count what was
+    // actually rendered into the texture, which on backends whose gradient
+    // texture isn't persistent is every ramp of every flush.
+    struct GradientRampStats
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        uint64_t uploadedRamps = 0;
+        uint64_t uploadedSpans = 0;
+    };
+    const GradientRampStats& gradientRampStats() const
+    {
+        return m_gradientRampStats;
+    }
+
     // Returns the context's TrivialBlockAllocator, which is automatically reset
     // at the end of every frame. (Memory in this allocator is preserved between
     // logical flushes.)
@@ -285,6 +311,9 @@ public:
                                        RenderBufferFlags,
                                        size_t) override;
     rcp<RenderImage> decodeImage(Span<const uint8_t>) override;
+    rcp<RenderImage> decodeImageAtSize(Span<const uint8_t>,
+                                       uint32_t targetWidth,
+                                       uint32_t targetHeight) override;
 
 private:
     friend class Draw;
@@ -298,6 +327,13 @@ private:
     // Resets the CPU-side STL containers so they don't have unbounded growth.
     void resetContainers();
 
+    // Finds or assigns the gradient texture row for a complex color ramp,
+    // moving it to the front of m_gradientRampRows. Returns false if every row
+    // is already in use by the given logical flush.
+    [[nodiscard]] bool allocateGradientRampRow(const GradientContentKey&,
+                                               uint64_t logicalFlushID,
+                                               uint16_t* row);
+
     // Throttled width/height of the atlas texture. If drawing to a render
     // target larger than this, we may create a larger atlas anyway.
     uint32_t atlasMaxSize() const
@@ -388,6 +424,31 @@ private:
     // (clockwiseAtomic mode only.)
     uint32_t m_coverageBufferPrefix = 0;
 
+    // Complex color ramps that have a row in the gradient texture, most
+    // recently used first. Rows are handed out in order until there are
+    // kMaxGradientRampRows, and are then recycled from the back of the list.
+    // A row can't be recycled by the same logical flush that last used it.
+    struct GradientRampRow
+    {
+        GradientContentKey key;
+        uint16_t row;
+        uint64_t lastLogicalFlushID;
+    };
+    constexpr static size_t kMaxGradientRampRows = 1024;
+    std::list<GradientRampRow> m_gradientRampRows;
+    std::unordered_map<GradientContentKey,
+                       std::list<GradientRampRow>::iterator,
+                       DeepHashGradient>
+        m_gradientRampRowIndex;
+    uint64_t m_lastLogicalFlushID = 0;
+
+    // The ramp most recently rendered into each complex row of the gradient
+    // texture, in the order the logical flushes will execute on the GPU.
+    // Cleared whenever the texture loses its contents.
+    std::vector<rcp<const GradientRamp>> m_gradTextureRows;
+
+    GradientRampStats m_gradientRampStats;
+
     // Used by LogicalFlushes for re-ordering high level draws.
     std::vector<int64_t> m_indirectDrawList;
     std::unique_ptr<IntersectionBoard> m_intersectionBoard;
@@ -461,8 +522,8 @@ private:
 
         // Access this flush's gpu::FlushDescriptor (which is not valid until
         // layoutResources()). NOTE: Some fields in the FlushDescriptor
-        // (tessVertexSpanCount, hasTriangleVertices, drawList, and
-        // combinedShaderFeatures) do not become valid until after
+        // (gradSpanCount, tessVertexSpanCount, hasTriangleVertices, drawList,
+        // and combinedShaderFeatures) do not become valid until after
         // writeResources().
         const gpu::FlushDescriptor& desc()
         {
@@ -754,15 +815,20 @@ private:
         // Complex gradients have stop(s) between t=0 and t=1. In theory they
         // should be scaled to a ramp where every stop lands exactly on a pixel
         // center, but for now we just always scale them to the entire gradient
-        // texture width.
+        // texture width. Their rows are assigned by
+        // RenderContext::allocateGradientRampRow().
         std::unordered_map<GradientContentKey, uint16_t, DeepHashGradient>
             m_complexGradients; // [colors[0..n], stops[0..n]] -> rowIdx
-        std::vector<const Gradient*> m_pendingComplexGradDraws;
 
         // Simple and complex gradients both get uploaded to the GPU as sets of
-        // "GradientSpan" instances.
+        // "GradientSpan" instances. Space is reserved for every complex
+        // gradient in the flush, but only the ones whose row doesn't already
+        // hold them get written.
         size_t m_pendingGradSpanCount;
 
+        // Identifies this flush to RenderContext::allocateGradientRampRow().
+        uint64_t m_id;
+
         std::vector<ClipInfo> m_clips;
 
         // High-level draw list. These get built into a low-level list of
@@ -6,13 +6,23 @@
 
 #include "rive/factory.hpp"
 
+#include <memory>
+
 namespace rive
 {
+namespace gpu
+{
+class GradientRampInterner;
+} // namespace gpu
+
 // Partial rive::Factory implementation for the PLS objects that are
 // backend-agnostic.
 class RiveRenderFactory : public Factory
 {
 public:
+    RiveRenderFactory();
+    ~RiveRenderFactory() override;
+
     rcp<RenderShader> makeLinearGradient(float sx,
                                          float sy,
                                          float ex,
@@ -28,10 +38,33 @@ public:
                                          const float stops[],     // [count]
                                          size_t count) override;
 
+    // Gradients are updated in place unless a pending draw still references
+    // them.
+    rcp<RenderShader> updateLinearGradient(rcp<RenderShader>,
+                                           float sx,
+                                           float sy,
+                                           float ex,
+                                           float ey,
+                                           const ColorInt colors[], // [count]
+                                           const float stops[],     // [count]
+                                           size_t count) override;
+
+    rcp<RenderShader> updateRadialGradient(rcp<RenderShader>,
+                                           float cx,
+                                           float cy,
+                                           float radius,
+                                           const ColorInt colors[], // [count]
+                                           const float stops[],     // [count]
+                                           size_t count) override;
+
     rcp<RenderPath> makeRenderPath(RawPath&, FillRule) override;
 
     rcp<RenderPath> makeEmptyRenderPath() override;
 
     rcp<RenderPaint> makeRenderPaint() override;
+
+private:
+    // Shares color ramps between gradients with the same colors and stops.
+    std::unique_ptr<gpu::GradientRampInterner> m_gradientRamps;
 };
 } // namespace rive
@@ -17,9 +17,26 @@ public:
         resetTexture(std::move(texture));
     }
 
+    // Draws a texture that was decoded smaller than the image it represents
+    // as if it were width x height pixels.
+    RiveRenderImage(rcp<gpu::Texture> texture, int width, int height) :
+        RiveRenderImage(width, height)
+    {
+        m_texture = std::move(texture);
+    }
+
     rcp<gpu::Texture> refTexture() const { return m_texture; }
     gpu::Texture* getTexture() { return m_texture.get(); }
 
+    size_t decodedByteSize() const override
+    {
+        if (m_texture == nullptr)
+        {
+            return RenderImage::decodedByteSize();
+        }
+        return (size_t)m_texture->width() * m_texture->height() * 4;
+    }
+
 protected:
     RiveRenderImage(int width, int height)
     {
@@ -32,6 +32,7 @@ public:
     void save() override;
     void restore() override;
     void transform(const Mat2D& matrix) override;
+    Mat2D currentTransform() const override { return m_stack.back().matrix; }
     void drawPath(RenderPath*, RenderPaint*) override;
     void clipPath(RenderPath*) override;
     void drawImage(const RenderImage*,
@@ -509,6 +509,7 @@ RenderContextD3DImpl::RenderContextD3DImpl(
 {
     m_platformFeatures.clipSpaceBottomUp = true;
     m_platformFeatures.framebufferBottomUp = false;
+    m_platformFeatures.gradTextureIsPersistent = true;
     m_platformFeatures.supportsRasterOrdering =
         d3dCapabilities.supportsRasterizerOrderedViews;
     m_platformFeatures.supportsFragmentShaderAtomics = true;
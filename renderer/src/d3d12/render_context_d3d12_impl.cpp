@@ -548,6 +548,7 @@ RenderContextD3D12Impl::RenderContextD3D12Impl(
 
     m_platformFeatures.clipSpaceBottomUp = true;
     m_platformFeatures.framebufferBottomUp = false;
+    m_platformFeatures.gradTextureIsPersistent = true;
     m_platformFeatures.supportsRasterOrdering =
         m_capabilities.supportsRasterizerOrderedViews;
     m_platformFeatures.supportsFragmentShaderAtomics = true;
@@ -551,6 +551,11 @@ PathDraw::PathDraw(IAABB pixelBounds,
     assert(!m_pathRef->getRawPath().empty());
     assert(paint != nullptr);
 
+    if (m_gradientRef != nullptr)
+    {
+        m_gradientRef->lockMutations();
+    }
+
     if (paint->getIsOpaque())
     {
         m_drawContents |= gpu::DrawContents::opaquePaint;
@@ -701,7 +706,11 @@ void PathDraw::releaseRefs()
     Draw::releaseRefs();
     RIVE_DEBUG_CODE(m_pathRef->unlockRawPathMutations();)
     m_pathRef->unref();
-    safe_unref(m_gradientRef);
+    if (m_gradientRef != nullptr)
+    {
+        m_gradientRef->unlockMutations();
+        m_gradientRef->unref();
+    }
 }
 
 void PathDraw::initForMidpointFan(RenderContext* context,
@@ -190,6 +190,9 @@ RenderContextGLImpl::RenderContextGLImpl(
         // to the screen on PowerVR; always go offscreen.
         m_platformFeatures.alwaysFeatherToAtlas = true;
     }
+    // PowerVR writes a texel of the gradient texture before rendering color
+    // ramps (see flush()), so it can't keep ramps resident across flushes.
+    m_platformFeatures.gradTextureIsPersistent = !m_capabilities.isPowerVR;
     m_platformFeatures.clipSpaceBottomUp = true;
     m_platformFeatures.framebufferBottomUp = true;
 
@@ -1633,8 +1636,11 @@ void RenderContextGLImpl::flush(const FlushDescriptor& desc)
         m_state->bindBuffer(GL_ARRAY_BUFFER,
                             gl_buffer_id(gradSpanBufferRing()));
         m_state->bindVAO(m_colorRampVAO);
-        GLenum colorAttachment0 = GL_COLOR_ATTACHMENT0;
-        glInvalidateFramebuffer(GL_FRAMEBUFFER, 1, &colorAttachment0);
+        if (!m_platformFeatures.gradTextureIsPersistent)
+        {
+            GLenum colorAttachment0 = GL_COLOR_ATTACHMENT0;
+            glInvalidateFramebuffer(GL_FRAMEBUFFER, 1, &colorAttachment0);
+        }
         for (auto [instanceCount, baseInstance] : InstanceChunker(
                  desc.gradSpanCount,
                  math::lossless_numeric_cast<uint32_t>(desc.firstGradSpan),
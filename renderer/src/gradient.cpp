@@ -4,6 +4,9 @@
 
 #include "gradient.hpp"
 
+#include <algorithm>
+#include <string_view>
+
 namespace rive::gpu
 {
 // Ensure the given gradient stops are in a format expected by PLS.
@@ -35,22 +38,111 @@ static bool validate_gradient_stops(const ColorInt colors[], // [count]
     return true;
 }
 
-rcp<Gradient> Gradient::MakeLinear(float sx,
-                                   float sy,
-                                   float ex,
-                                   float ey,
-                                   const ColorInt colors[], // [count]
-                                   const float stops[],     // [count]
-                                   size_t count)
+GradientRamp::GradientRamp(const ColorInt colors[], // [count]
+                           const float stops[],     // [count]
+                           size_t count,
+                           size_t hash) :
+    m_colors(colors, count), m_stops(stops, count), m_count(count), m_hash(hash)
 {
-    if (!validate_gradient_stops(colors, stops, count))
+    ColorInt allColors = ~0;
+    for (size_t i = 0; i < count; ++i)
     {
-        return nullptr;
+        allColors &= colors[i];
+    }
+    m_isOpaque = colorAlpha(allColors) == 0xff;
+}
+
+size_t GradientRamp::Hash(const ColorInt colors[], // [count]
+                          const float stops[],     // [count]
+                          size_t count)
+{
+    std::hash<std::string_view> hash;
+    size_t x = hash(std::string_view(reinterpret_cast<const char*>(stops),
+                                     count * sizeof(float)));
+    size_t y = hash(std::string_view(reinterpret_cast<const char*>(colors),
+                                     count * sizeof(ColorInt)));
+    return x ^ y;
+}
+
+bool GradientRamp::equals(const ColorInt colors[], // [count]
+                          const float stops[],     // [count]
+                          size_t count) const
+{
+    return m_count == count &&
+           !memcmp(m_stops.get(), stops, count * sizeof(float)) &&
+           !memcmp(m_colors.get(), colors, count * sizeof(ColorInt));
+}
+
+rcp<const GradientRamp> GradientRampInterner::intern(
+    const ColorInt colors[], // [count]
+    const float stops[],     // [count]
+    size_t count)
+{
+    size_t hash = GradientRamp::Hash(colors, stops, count);
+    auto range = m_ramps.equal_range(hash);
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+        if (iter->second->equals(colors, stops, count))
+        {
+            return iter->second;
+        }
+    }
+
+    if (m_ramps.size() >= m_purgeThreshold)
+    {
+        purgeUnusedRamps();
+        m_purgeThreshold = std::max(m_ramps.size() * 2, kMinPurgeThreshold);
     }
+    auto ramp = make_rcp<GradientRamp>(colors, stops, count, hash);
+    m_ramps.emplace(hash, ramp);
+    return ramp;
+}
 
-    float2 start = {sx, sy};
-    float2 end = {ex, ey};
-    GradDataArray<ColorInt> newColors(colors, count);
+void GradientRampInterner::purgeUnusedRamps()
+{
+    for (auto iter = m_ramps.begin(); iter != m_ramps.end();)
+    {
+        // Gradients only pick up ramps through intern(), on the factory's
+        // thread, so a ramp without gradients can't gain one during the purge.
+        // Anything else still holding a ref keeps its ramp, it just isn't
+        // shared anymore.
+        if (iter->second->gradientCount() == 0)
+        {
+            iter = m_ramps.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+}
+
+static rcp<const GradientRamp> make_ramp(const ColorInt colors[], // [count]
+                                         const float stops[],     // [count]
+                                         size_t count,
+                                         GradientRampInterner* interner)
+{
+    if (interner != nullptr)
+    {
+        return interner->intern(colors, stops, count);
+    }
+    return make_rcp<GradientRamp>(colors,
+                                  stops,
+                                  count,
+                                  GradientRamp::Hash(colors, stops, count));
+}
+
+// Computes the ramp and coefficients of a linear gradient.
+static rcp<const GradientRamp> make_linear_ramp(
+    float2 start,
+    float2 end,
+    const ColorInt colors[], // [count]
+    const float stops[],     // [count]
+    size_t count,
+    GradientRampInterner* interner,
+    std::array<float, 3>* coeffs)
+{
+    assert(validate_gradient_stops(colors, stops, count));
     GradDataArray<float> newStops(stops, count);
 
     // If the stops don't begin and end on 0 and 1, transform the gradient so
@@ -93,33 +185,27 @@ rcp<Gradient> Gradient::MakeLinear(float sx,
                 newStops[i] = fminf(newStops[i], newStops[i + 1]);
             }
         }
-        assert(validate_gradient_stops(newColors.get(), newStops.get(), count));
+        assert(validate_gradient_stops(colors, newStops.get(), count));
     }
 
     float2 v = end - start;
     v *= 1.f / simd::dot(v, v); // dot(v, end - start) == 1
-    return rcp(new Gradient(gpu::PaintType::linearGradient,
-                            std::move(newColors),
-                            std::move(newStops),
-                            count,
-                            v.x,
-                            v.y,
-                            -simd::dot(v, start)));
+    *coeffs = {v.x, v.y, -simd::dot(v, start)};
+    return make_ramp(colors, newStops.get(), count, interner);
 }
 
-rcp<Gradient> Gradient::MakeRadial(float cx,
-                                   float cy,
-                                   float radius,
-                                   const ColorInt colors[], // [count]
-                                   const float stops[],     // [count]
-                                   size_t count)
+// Computes the ramp and coefficients of a radial gradient.
+static rcp<const GradientRamp> make_radial_ramp(
+    float cx,
+    float cy,
+    float radius,
+    const ColorInt colors[], // [count]
+    const float stops[],     // [count]
+    size_t count,
+    GradientRampInterner* interner,
+    std::array<float, 3>* coeffs)
 {
-    if (!validate_gradient_stops(colors, stops, count))
-    {
-        return nullptr;
-    }
-
-    GradDataArray<ColorInt> newColors(colors, count);
+    assert(validate_gradient_stops(colors, stops, count));
     GradDataArray<float> newStops(stops, count);
 
     // If the stops don't end on 1, scale the gradient so they do. This allows
@@ -161,31 +247,129 @@ rcp<Gradient> Gradient::MakeRadial(float cx,
             }
         }
 
-        assert(validate_gradient_stops(newColors.get(), newStops.get(), count));
+        assert(validate_gradient_stops(colors, newStops.get(), count));
     }
 
+    *coeffs = {cx, cy, radius};
+    return make_ramp(colors, newStops.get(), count, interner);
+}
+
+void Gradient::setRamp(rcp<const GradientRamp> ramp)
+{
+    if (ramp != nullptr)
+    {
+        ++ramp->m_gradientCount;
+    }
+    if (m_ramp != nullptr)
+    {
+        assert(m_ramp->m_gradientCount > 0);
+        --m_ramp->m_gradientCount;
+    }
+    m_ramp = std::move(ramp);
+}
+
+rcp<Gradient> Gradient::MakeLinear(float sx,
+                                   float sy,
+                                   float ex,
+                                   float ey,
+                                   const ColorInt colors[], // [count]
+                                   const float stops[],     // [count]
+                                   size_t count,
+                                   GradientRampInterner* interner)
+{
+    if (!validate_gradient_stops(colors, stops, count))
+    {
+        return nullptr;
+    }
+
+    std::array<float, 3> coeffs;
+    rcp<const GradientRamp> ramp = make_linear_ramp({sx, sy},
+                                                    {ex, ey},
+                                                    colors,
+                                                    stops,
+                                                    count,
+                                                    interner,
+                                                    &coeffs);
+    return rcp(new Gradient(gpu::PaintType::linearGradient,
+                            std::move(ramp),
+                            coeffs));
+}
+
+rcp<Gradient> Gradient::MakeRadial(float cx,
+                                   float cy,
+                                   float radius,
+                                   const ColorInt colors[], // [count]
+                                   const float stops[],     // [count]
+                                   size_t count,
+                                   GradientRampInterner* interner)
+{
+    if (!validate_gradient_stops(colors, stops, count))
+    {
+        return nullptr;
+    }
+
+    std::array<float, 3> coeffs;
+    rcp<const GradientRamp> ramp = make_radial_ramp(cx,
+                                                    cy,
+                                                    radius,
+                                                    colors,
+                                                    stops,
+                                                    count,
+                                                    interner,
+                                                    &coeffs);
     return rcp(new Gradient(gpu::PaintType::radialGradient,
-                            std::move(newColors),
-                            std::move(newStops),
-                            count,
-                            cx,
-                            cy,
-                            radius));
+                            std::move(ramp),
+                            coeffs));
 }
 
-bool Gradient::isOpaque() const
+bool Gradient::updateLinear(float sx,
+                            float sy,
+                            float ex,
+                            float ey,
+                            const ColorInt colors[], // [count]
+                            const float stops[],     // [count]
+                            size_t count,
+                            GradientRampInterner* interner)
 {
-    if (m_isOpaque == gpu::TriState::unknown)
+    if (m_paintType != gpu::PaintType::linearGradient ||
+        m_mutationLockCount != 0 ||
+        !validate_gradient_stops(colors, stops, count))
     {
-        ColorInt allColors = ~0;
-        for (int i = 0; i < m_count; ++i)
-        {
-            allColors &= m_colors[i];
-        }
-        m_isOpaque = colorAlpha(allColors) == 0xff ? gpu::TriState::yes
-                                                   : gpu::TriState::no;
+        return false;
+    }
+    setRamp(make_linear_ramp({sx, sy},
+                             {ex, ey},
+                             colors,
+                             stops,
+                             count,
+                             interner,
+                             &m_coeffs));
+    return true;
+}
+
+bool Gradient::updateRadial(float cx,
+                            float cy,
+                            float radius,
+                            const ColorInt colors[], // [count]
+                            const float stops[],     // [count]
+                            size_t count,
+                            GradientRampInterner* interner)
+{
+    if (m_paintType != gpu::PaintType::radialGradient ||
+        m_mutationLockCount != 0 ||
+        !validate_gradient_stops(colors, stops, count))
+    {
+        return false;
     }
-    return m_isOpaque == gpu::TriState::yes;
+    setRamp(make_radial_ramp(cx,
+                             cy,
+                             radius,
+                             colors,
+                             stops,
+                             count,
+                             interner,
+                             &m_coeffs));
+    return true;
 }
 
 } // namespace rive::gpu
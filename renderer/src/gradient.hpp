@@ -7,6 +7,8 @@
 #include "rive/renderer/gpu.hpp"
 #include "rive/renderer.hpp"
 #include <array>
+#include <atomic>
+#include <unordered_map>
 
 namespace rive::gpu
 {
@@ -57,56 +59,146 @@ private:
     T* m_data;
 };
 
+// The colors and stops of a gradient, after Gradient has normalized the stops
+// to span 0..1. Immutable once made, so gradients with the same color ramp can
+// share one.
+class GradientRamp : public RefCnt<GradientRamp>
+{
+public:
+    GradientRamp(const ColorInt colors[], // [count]
+                 const float stops[],     // [count]
+                 size_t count,
+                 size_t hash);
+
+    static size_t Hash(const ColorInt colors[], // [count]
+                       const float stops[],     // [count]
+                       size_t count);
+
+    const ColorInt* colors() const { return m_colors.get(); }
+    const float* stops() const { return m_stops.get(); }
+    size_t count() const { return m_count; }
+    size_t hash() const { return m_hash; }
+    bool isOpaque() const { return m_isOpaque; }
+
+    bool equals(const ColorInt colors[], // [count]
+                const float stops[],     // [count]
+                size_t count) const;
+
+    // Number of Gradients currently drawing with this ramp.
+    uint32_t gradientCount() const { return m_gradientCount; }
+
+private:
+    friend class Gradient;
+
+    GradDataArray<ColorInt> m_colors;
+    GradDataArray<float> m_stops;
+    size_t m_count;
+    size_t m_hash;
+    bool m_isOpaque;
+    // Gradients can be released from any thread.
+    mutable std::atomic<uint32_t> m_gradientCount{0};
+};
+
+// Content-hashed table of GradientRamps, so every gradient made with the same
+// colors and stops shares a single copy of them. Ramps that no Gradient uses
+// anymore are dropped whenever it doubles in size. Not thread safe; owned by a
+// factory.
+class GradientRampInterner
+{
+public:
+    rcp<const GradientRamp> intern(const ColorInt colors[], // [count]
+                                   const float stops[],     // [count]
+                                   size_t count);
+
+    size_t size() const { return m_ramps.size(); }
+
+private:
+    void purgeUnusedRamps();
+
+    constexpr static size_t kMinPurgeThreshold = 64;
+
+    std::unordered_multimap<size_t, rcp<const GradientRamp>> m_ramps;
+    size_t m_purgeThreshold = kMinPurgeThreshold;
+};
+
 // RenderShader implementation for Rive's pixel local storage renderer.
 class Gradient : public LITE_RTTI_OVERRIDE(RenderShader, Gradient)
 {
 public:
+    ~Gradient() override { setRamp(nullptr); }
+
     static rcp<Gradient> MakeLinear(float sx,
                                     float sy,
                                     float ex,
                                     float ey,
                                     const ColorInt colors[], // [count]
                                     const float stops[],     // [count]
-                                    size_t count);
+                                    size_t count,
+                                    GradientRampInterner* = nullptr);
 
     static rcp<Gradient> MakeRadial(float cx,
                                     float cy,
                                     float radius,
                                     const ColorInt colors[], // [count]
                                     const float stops[],     // [count]
-                                    size_t count);
+                                    size_t count,
+                                    GradientRampInterner* = nullptr);
+
+    // Update the gradient in place. Returns false, leaving the gradient
+    // unchanged, if it's a different type of gradient, the stops are invalid,
+    // or a draw that hasn't been flushed yet still references it.
+    bool updateLinear(float sx,
+                      float sy,
+                      float ex,
+                      float ey,
+                      const ColorInt colors[], // [count]
+                      const float stops[],     // [count]
+                      size_t count,
+                      GradientRampInterner* = nullptr);
+
+    bool updateRadial(float cx,
+                      float cy,
+                      float radius,
+                      const ColorInt colors[], // [count]
+                      const float stops[],     // [count]
+                      size_t count,
+                      GradientRampInterner* = nullptr);
 
     PaintType paintType() const { return m_paintType; }
     const float* coeffs() const { return m_coeffs.data(); }
-    const ColorInt* colors() const { return m_colors.get(); }
-    const float* stops() const { return m_stops.get(); }
-    size_t count() const { return m_count; }
-    bool isOpaque() const;
+    const GradientRamp* ramp() const { return m_ramp.get(); }
+    const ColorInt* colors() const { return m_ramp->colors(); }
+    const float* stops() const { return m_ramp->stops(); }
+    size_t count() const { return m_ramp->count(); }
+    bool isOpaque() const { return m_ramp->isOpaque(); }
+
+    // Draws read the gradient when their flush is prepared, so they lock it
+    // against in-place updates until they release their refs.
+    void lockMutations() const { ++m_mutationLockCount; }
+    void unlockMutations() const
+    {
+        assert(m_mutationLockCount > 0);
+        --m_mutationLockCount;
+    }
 
 private:
     Gradient(PaintType paintType,
-             GradDataArray<ColorInt>&& colors, // [count]
-             GradDataArray<float>&& stops,     // [count]
-             size_t count,
-             float coeffX,
-             float coeffY,
-             float coeffZ) :
-        m_paintType(paintType),
-        m_colors(std::move(colors)),
-        m_stops(std::move(stops)),
-        m_count(count),
-        m_coeffs{coeffX, coeffY, coeffZ}
+             rcp<const GradientRamp> ramp,
+             const std::array<float, 3>& coeffs) :
+        m_paintType(paintType), m_coeffs(coeffs)
     {
         assert(paintType == gpu::PaintType::linearGradient ||
                paintType == gpu::PaintType::radialGradient);
+        setRamp(std::move(ramp));
     }
 
+    // Moves this gradient's use from its current ramp to the new one.
+    void setRamp(rcp<const GradientRamp>);
+
     PaintType m_paintType; // Specifically, linearGradient or radialGradient.
-    GradDataArray<ColorInt> m_colors;
-    GradDataArray<float> m_stops;
-    size_t m_count;
+    rcp<const GradientRamp> m_ramp;
     std::array<float, 3> m_coeffs;
-    mutable gpu::TriState m_isOpaque = gpu::TriState::unknown;
+    mutable uint32_t m_mutationLockCount = 0;
 };
 
 } // namespace rive::gpu
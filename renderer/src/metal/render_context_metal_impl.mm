@@ -458,6 +458,7 @@ RenderContextMetalImpl::RenderContextMetalImpl(
     m_platformFeatures.avoidFlatVaryings = true;
     m_platformFeatures.clipSpaceBottomUp = true;
     m_platformFeatures.framebufferBottomUp = false;
+    m_platformFeatures.gradTextureIsPersistent = true;
     if ([m_gpu supportsFamily:MTLGPUFamilyApple2] ||
         [m_gpu supportsFamily:MTLGPUFamilyMac2])
     {
@@ -1221,7 +1222,8 @@ void RenderContextMetalImpl::flush(const FlushDescriptor& desc)
             [MTLRenderPassDescriptor renderPassDescriptor];
         gradPass.renderTargetWidth = kGradTextureWidth;
         gradPass.renderTargetHeight = desc.gradDataHeight;
-        gradPass.colorAttachments[0].loadAction = MTLLoadActionDontCare;
+        // Complex color ramps stay resident between flushes.
+        gradPass.colorAttachments[0].loadAction = MTLLoadActionLoad;
         gradPass.colorAttachments[0].storeAction = MTLStoreActionStore;
         gradPass.colorAttachments[0].texture = m_gradientTexture;
 
@@ -15,8 +15,6 @@
 
 #include "shaders/constants.glsl"
 
-#include <string_view>
-
 #ifdef RIVE_DECODERS
 #include "rive/decoders/bitmap_decoder.hpp"
 #endif
@@ -57,51 +55,34 @@ constexpr static size_t resource_texture_height(size_t itemCount)
     return (itemCount + WidthInItems - 1) / WidthInItems;
 }
 
-constexpr static size_t gradient_data_height(size_t simpleRampCount,
-                                             size_t complexRampCount)
-{
-    return resource_texture_height<gpu::kGradTextureWidthInSimpleRamps>(
-               simpleRampCount) +
-           complexRampCount;
-}
-
-inline GradientContentKey::GradientContentKey(rcp<const Gradient> gradient) :
-    m_gradient(std::move(gradient))
+inline GradientContentKey::GradientContentKey(rcp<const GradientRamp> ramp) :
+    m_ramp(std::move(ramp))
 {}
 
 inline GradientContentKey::GradientContentKey(GradientContentKey&& other) :
-    m_gradient(std::move(other.m_gradient))
+    m_ramp(std::move(other.m_ramp))
 {}
 
 bool GradientContentKey::operator==(const GradientContentKey& other) const
 {
-    if (m_gradient.get() == other.m_gradient.get())
+    const GradientRamp* ramp = m_ramp.get();
+    const GradientRamp* otherRamp = other.m_ramp.get();
+    // Interned ramps with the same content are the same object.
+    if (ramp == otherRamp)
     {
         return true;
     }
     else
     {
-        return m_gradient->count() == other.m_gradient->count() &&
-               !memcmp(m_gradient->stops(),
-                       other.m_gradient->stops(),
-                       m_gradient->count() * sizeof(float)) &&
-               !memcmp(m_gradient->colors(),
-                       other.m_gradient->colors(),
-                       m_gradient->count() * sizeof(ColorInt));
+        return ramp->equals(otherRamp->colors(),
+                            otherRamp->stops(),
+                            otherRamp->count());
     }
 }
 
 size_t DeepHashGradient::operator()(const GradientContentKey& key) const
 {
-    const Gradient* grad = key.gradient();
-    std::hash<std::string_view> hash;
-    size_t x =
-        hash(std::string_view(reinterpret_cast<const char*>(grad->stops()),
-                              grad->count() * sizeof(float)));
-    size_t y =
-        hash(std::string_view(reinterpret_cast<const char*>(grad->colors()),
-                              grad->count() * sizeof(ColorInt)));
-    return x ^ y;
+    return key.ramp()->hash();
 }
 
 RenderContext::RenderContext(std::unique_ptr<RenderContextImpl> impl) :
@@ -119,6 +100,13 @@ RenderContext::~RenderContext()
 {
     // Always call flush() to avoid deadlock.
     assert(!m_didBeginFrame);
+    // The image cache belongs to the Factory base, which outlives this
+    // destructor. Let go of the images it holds while they can still reach
+    // their GPU resources.
+    if (ImageCache* cache = imageCache())
+    {
+        cache->clear();
+    }
     // Delete the logical flushes before the block allocators let go of their
     // allocations.
     m_logicalFlushes.clear();
@@ -137,13 +125,24 @@ rcp<RenderBuffer> RenderContext::makeRenderBuffer(RenderBufferType type,
 }
 
 rcp<RenderImage> RenderContext::decodeImage(Span<const uint8_t> encodedBytes)
+{
+    return decodeImageAtSize(encodedBytes, 0, 0);
+}
+
+rcp<RenderImage> RenderContext::decodeImageAtSize(
+    Span<const uint8_t> encodedBytes,
+    uint32_t targetWidth,
+    uint32_t targetHeight)
 {
     RIVE_PROF_SCOPE()
     rcp<Texture> texture = m_impl->platformDecodeImageTexture(encodedBytes);
 #ifdef RIVE_DECODERS
     if (texture == nullptr)
     {
-        auto bitmap = Bitmap::decode(encodedBytes.data(), encodedBytes.size());
+        auto bitmap = Bitmap::decode(encodedBytes.data(),
+                                     encodedBytes.size(),
+                                     targetWidth,
+                                     targetHeight);
         if (bitmap)
         {
             // For now, RenderContextImpl::makeImageTexture() only accepts RGBA.
@@ -158,6 +157,14 @@ rcp<RenderImage> RenderContext::decodeImage(Span<const uint8_t> encodedBytes)
                                                height,
                                                mipLevelCount,
                                                bitmap->bytes());
+            if (texture != nullptr && (width != bitmap->sourceWidth() ||
+                                       height != bitmap->sourceHeight()))
+            {
+                return make_rcp<RiveRenderImage>(
+                    std::move(texture),
+                    bitmap->sourceWidth(),
+                    bitmap->sourceHeight());
+            }
         }
     }
 #endif
@@ -169,6 +176,8 @@ void RenderContext::releaseResources()
 {
     assert(!m_didBeginFrame);
     resetContainers();
+    m_gradientRampRowIndex.clear();
+    m_gradientRampRows.clear();
     setResourceSizes(ResourceAllocationCounts());
     m_maxRecentResourceRequirements = ResourceAllocationCounts();
     m_lastResourceTrimTimeInSeconds = m_impl->secondsNow();
@@ -192,6 +201,50 @@ void RenderContext::resetContainers()
     m_intersectionBoard = nullptr;
 }
 
+bool RenderContext::allocateGradientRampRow(const GradientContentKey& key,
+                                            uint64_t logicalFlushID,
+                                            uint16_t* row)
+{
+    auto iter = m_gradientRampRowIndex.find(key);
+    if (iter != m_gradientRampRowIndex.end())
+    {
+        ++m_gradientRampStats.hits;
+        m_gradientRampRows.splice(m_gradientRampRows.begin(),
+                                  m_gradientRampRows,
+                                  iter->second);
+        iter->second->lastLogicalFlushID = logicalFlushID;
+        *row = iter->second->row;
+        return true;
+    }
+
+    uint16_t newRow;
+    if (m_gradientRampRows.size() < kMaxGradientRampRows)
+    {
+        newRow = static_cast<uint16_t>(m_gradientRampRows.size());
+    }
+    else
+    {
+        GradientRampRow& leastRecent = m_gradientRampRows.back();
+        if (leastRecent.lastLogicalFlushID == logicalFlushID)
+        {
+            // Every row is referenced by this flush.
+            return false;
+        }
+        ++m_gradientRampStats.evictions;
+        newRow = leastRecent.row;
+        m_gradientRampRowIndex.erase(leastRecent.key);
+        m_gradientRampRows.pop_back();
+    }
+
+    ++m_gradientRampStats.misses;
+    m_gradientRampRows.push_front(
+        {GradientContentKey(ref_rcp(key.ramp())), newRow, logicalFlushID});
+    m_gradientRampRowIndex.emplace(GradientContentKey(ref_rcp(key.ramp())),
+                                   m_gradientRampRows.begin());
+    *row = newRow;
+    return true;
+}
+
 RenderContext::LogicalFlush::LogicalFlush(RenderContext* parent) : m_ctx(parent)
 {
     rewind();
@@ -205,8 +258,8 @@ void RenderContext::LogicalFlush::rewind()
     m_simpleGradients.clear();
     m_pendingSimpleGradDraws.clear();
     m_complexGradients.clear();
-    m_pendingComplexGradDraws.clear();
     m_pendingGradSpanCount = 0;
+    m_id = ++m_ctx->m_lastLogicalFlushID;
     m_clips.clear();
     m_draws.clear();
     m_combinedDrawBounds = {std::numeric_limits<int32_t>::max(),
@@ -267,10 +320,6 @@ void RenderContext::LogicalFlush::resetContainers()
     m_complexGradients.rehash(0);
     m_complexGradients.reserve(kDefaultComplexGradientCapacity);
 
-    m_pendingComplexGradDraws.clear();
-    m_pendingComplexGradDraws.shrink_to_fit();
-    m_pendingComplexGradDraws.reserve(kDefaultComplexGradientCapacity);
-
     m_pendingAtlasDraws.clear();
     m_pendingAtlasDraws.shrink_to_fit();
     // Don't reserve any space in m_pendingAtlasDraws since there are many
@@ -499,9 +548,11 @@ bool RenderContext::LogicalFlush::allocateGradient(
         }
         else
         {
-            if (gradient_data_height(m_simpleGradients.size() + 1,
-                                     m_complexGradients.size()) >
-                kMaxTextureHeight)
+            // The rows above kMaxGradientRampRows are left for simple
+            // gradients.
+            if (resource_texture_height<gpu::kGradTextureWidthInSimpleRamps>(
+                    m_simpleGradients.size() + 1) >
+                kMaxTextureHeight - kMaxGradientRampRows)
             {
                 // We ran out of rows in the gradient texture. Caller has to
                 // flush and try again.
@@ -522,34 +573,26 @@ bool RenderContext::LogicalFlush::allocateGradient(
     {
         // This is a complex gradient. Render it to an entire row of the
         // gradient texture.
-        GradientContentKey key(ref_rcp(gradient));
+        GradientContentKey key(ref_rcp(gradient->ramp()));
         auto iter = m_complexGradients.find(key);
         uint16_t row;
         if (iter != m_complexGradients.end())
         {
-            row = iter->second; // This gradient is already in the texture.
+            row = iter->second; // This gradient is already in the flush.
         }
         else
         {
-            if (gradient_data_height(m_simpleGradients.size(),
-                                     m_complexGradients.size() + 1) >
-                kMaxTextureHeight)
+            if (!m_ctx->allocateGradientRampRow(key, m_id, &row))
             {
                 // We ran out of rows in the gradient texture. Caller has to
                 // flush and try again.
                 return false;
             }
-
-            row = static_cast<uint32_t>(m_complexGradients.size());
             m_complexGradients.emplace(std::move(key), row);
-            m_pendingComplexGradDraws.push_back(gradient);
 
             size_t spanCount = stopCount - 1;
             m_pendingGradSpanCount += spanCount;
         }
-        // Store the row relative to the first complex gradient for now.
-        // PaintData::set() will offset this value by the number of simple
-        // gradient rows once its final value is known.
         colorRampLocation->row = row;
         colorRampLocation->col = ColorRampLocation::kComplexGradientMarker;
     }
@@ -922,11 +965,11 @@ void RenderContext::LogicalFlush::layoutResources(
             kMaxTessellationAlignmentVertices;
     }
 
-    // Complex gradients begin on the first row immediately after the simple
-    // gradients.
-    m_gradTextureLayout.complexOffsetY = math::lossless_numeric_cast<uint32_t>(
-        resource_texture_height<gpu::kGradTextureWidthInSimpleRamps>(
-            m_simpleGradients.size()));
+    // Simple gradients begin on the first row after the complex gradient rows.
+    // Every draw in the frame has allocated its gradient by now, so no later
+    // flush will hand out a row past this one.
+    m_gradTextureLayout.simpleOffsetY =
+        math::lossless_numeric_cast<uint32_t>(m_ctx->m_gradientRampRows.size());
 
     m_flushDesc.renderTarget = flushResources.renderTarget;
     m_flushDesc.interlockMode = m_ctx->frameInterlockMode();
@@ -1029,7 +1072,9 @@ void RenderContext::LogicalFlush::layoutResources(
     m_flushDesc.firstGradSpan = runningFrameLayoutCounts->gradSpanCount +
                                 runningFrameLayoutCounts->gradSpanPaddingCount;
     m_flushDesc.gradDataHeight = math::lossless_numeric_cast<uint32_t>(
-        m_gradTextureLayout.complexOffsetY + m_complexGradients.size());
+        m_gradTextureLayout.simpleOffsetY +
+        resource_texture_height<gpu::kGradTextureWidthInSimpleRamps>(
+            m_simpleGradients.size()));
     m_flushDesc.tessDataHeight = tessDataHeight;
     m_flushDesc.clockwiseFillOverride = frameDescriptor.clockwiseFillOverride;
     m_flushDesc.wireframe = frameDescriptor.wireframe;
@@ -1121,6 +1166,7 @@ void RenderContext::LogicalFlush::writeResources()
             // 1px borders to the left and right.
             auto [color0, color1] = m_pendingSimpleGradDraws[i];
             uint32_t y = math::lossless_numeric_cast<uint32_t>(
+                m_gradTextureLayout.simpleOffsetY +
                 i / gpu::kGradTextureWidthInSimpleRamps);
             size_t centerX = (i % gpu::kGradTextureWidthInSimpleRamps) * 2 + 1;
             uint32_t centerXFixed = math::lossless_numeric_cast<uint32_t>(
@@ -1135,53 +1181,77 @@ void RenderContext::LogicalFlush::writeResources()
         }
     }
 
-    // Write out the vertex data for rendering complex gradients.
-    assert(m_complexGradients.size() == m_pendingComplexGradDraws.size());
-    if (!m_pendingComplexGradDraws.empty())
+    // Write out the vertex data for rendering complex gradients. Skip the ones
+    // whose row still holds them from an earlier flush.
+    std::vector<rcp<const GradientRamp>>& textureRows =
+        m_ctx->m_gradTextureRows;
+    if (!platformFeatures.gradTextureIsPersistent)
     {
-        // The viewport will start at simpleGradDataHeight when rendering color
-        // ramps.
-        for (uint32_t i = 0; i < m_pendingComplexGradDraws.size(); ++i)
+        // Every flush starts with an empty gradient texture.
+        textureRows.clear();
+    }
+    size_t gradSpanCount = m_pendingSimpleGradDraws.size();
+    for (const auto& [key, row] : m_complexGradients)
+    {
+        const GradientRamp* ramp = key.ramp();
+        const float* stops = ramp->stops();
+        const ColorInt* colors = ramp->colors();
+        size_t stopCount = ramp->count();
+        if (row >= textureRows.size())
         {
-            // Push "GradientSpan" instances that will render each section of
-            // this color ramp's gradient.
-            const Gradient* gradient = m_pendingComplexGradDraws[i];
-            const float* stops = gradient->stops();
-            const ColorInt* colors = gradient->colors();
-            size_t stopCount = gradient->count();
-            uint32_t y = i + m_gradTextureLayout.complexOffsetY;
-
-            // "stop * m + a" converts a stop position to a fixed-point x
-            // coordinate in the gradient texture. (In an ideal world, stops
-            // would all be aligned on pixel centers for the texture sampling to
-            // be identical to the gradient, but here we just stretch it across
-            // kGradTextureWidth pixels and hope everything looks ok.)
-            float m = (kGradTextureWidth - 1.f) * ONE_TEXEL_FIXED;
-            float a = .5f * ONE_TEXEL_FIXED;
-            uint32_t lastXFixed = static_cast<uint32_t>(stops[0] * m + a);
-            ColorInt lastColor = colors[0];
-            assert(stopCount >= 2);
-            for (size_t i = 1; i < stopCount; ++i)
-            {
-                uint32_t xFixed = static_cast<uint32_t>(stops[i] * m + a);
-                // stops[] must be ordered.
-                assert(lastXFixed <= xFixed && xFixed < 65536);
-                uint32_t flags = GRAD_SPAN_FLAG_COMPLEX_BORDER;
-                if (i == 1)
-                    flags |= GRAD_SPAN_FLAG_LEFT_BORDER;
-                if (i == stopCount - 1)
-                    flags |= GRAD_SPAN_FLAG_RIGHT_BORDER;
-                m_ctx->m_gradSpanData.set_back(lastXFixed,
-                                               xFixed,
-                                               y,
-                                               flags,
-                                               lastColor,
-                                               colors[i]);
-                lastColor = colors[i];
-                lastXFixed = xFixed;
-            }
+            textureRows.resize(row + 1);
+        }
+        else if (textureRows[row] != nullptr &&
+                 (textureRows[row].get() == ramp ||
+                  textureRows[row]->equals(colors, stops, stopCount)))
+        {
+            continue; // This row already holds the ramp.
+        }
+        textureRows[row] = ref_rcp(ramp);
+        ++m_ctx->m_gradientRampStats.uploadedRamps;
+        m_ctx->m_gradientRampStats.uploadedSpans += stopCount - 1;
+        gradSpanCount += stopCount - 1;
+
+        // Push "GradientSpan" instances that will render each section of
+        // this color ramp's gradient.
+        uint32_t y = row;
+
+        // "stop * m + a" converts a stop position to a fixed-point x
+        // coordinate in the gradient texture. (In an ideal world, stops
+        // would all be aligned on pixel centers for the texture sampling to
+        // be identical to the gradient, but here we just stretch it across
+        // kGradTextureWidth pixels and hope everything looks ok.)
+        float m = (kGradTextureWidth - 1.f) * ONE_TEXEL_FIXED;
+        float a = .5f * ONE_TEXEL_FIXED;
+        uint32_t lastXFixed = static_cast<uint32_t>(stops[0] * m + a);
+        ColorInt lastColor = colors[0];
+        assert(stopCount >= 2);
+        for (size_t i = 1; i < stopCount; ++i)
+        {
+            uint32_t xFixed = static_cast<uint32_t>(stops[i] * m + a);
+            // stops[] must be ordered.
+            assert(lastXFixed <= xFixed && xFixed < 65536);
+            uint32_t flags = GRAD_SPAN_FLAG_COMPLEX_BORDER;
+            if (i == 1)
+                flags |= GRAD_SPAN_FLAG_LEFT_BORDER;
+            if (i == stopCount - 1)
+                flags |= GRAD_SPAN_FLAG_RIGHT_BORDER;
+            m_ctx->m_gradSpanData.set_back(lastXFixed,
+                                           xFixed,
+                                           y,
+                                           flags,
+                                           lastColor,
+                                           colors[i]);
+            lastColor = colors[i];
+            lastXFixed = xFixed;
         }
     }
+    // Leave the space reserved for skipped ramps unused.
+    assert(gradSpanCount <= m_pendingGradSpanCount);
+    m_ctx->m_gradSpanData.push_back_n(nullptr,
+                                      m_pendingGradSpanCount - gradSpanCount);
+    m_flushDesc.gradSpanCount =
+        math::lossless_numeric_cast<uint32_t>(gradSpanCount);
 
     // Write a path record for the clearColor paint (used by atomic mode).
     // This also allows us to index the storage buffers directly by pathID.
@@ -1864,6 +1934,8 @@ void RenderContext::setResourceSizes(ResourceAllocationCounts allocs,
         m_impl->resizeGradientTexture(
             gpu::kGradTextureWidth,
             math::lossless_numeric_cast<uint32_t>(allocs.gradTextureHeight));
+        // The new texture doesn't hold any ramps yet.
+        m_gradTextureRows.clear();
     }
 
     assert(allocs.tessTextureHeight <= kMaxTextureHeight);
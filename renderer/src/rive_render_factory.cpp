@@ -10,6 +10,12 @@
 
 namespace rive
 {
+RiveRenderFactory::RiveRenderFactory() :
+    m_gradientRamps(std::make_unique<gpu::GradientRampInterner>())
+{}
+
+RiveRenderFactory::~RiveRenderFactory() {}
+
 rcp<RenderShader> RiveRenderFactory::makeLinearGradient(
     float sx,
     float sy,
@@ -19,7 +25,14 @@ rcp<RenderShader> RiveRenderFactory::makeLinearGradient(
     const float stops[],     // [count]
     size_t count)
 {
-    return gpu::Gradient::MakeLinear(sx, sy, ex, ey, colors, stops, count);
+    return gpu::Gradient::MakeLinear(sx,
+                                     sy,
+                                     ex,
+                                     ey,
+                                     colors,
+                                     stops,
+                                     count,
+                                     m_gradientRamps.get());
 }
 
 rcp<RenderShader> RiveRenderFactory::makeRadialGradient(
@@ -30,7 +43,61 @@ rcp<RenderShader> RiveRenderFactory::makeRadialGradient(
     const float stops[],     // [count]
     size_t count)
 {
-    return gpu::Gradient::MakeRadial(cx, cy, radius, colors, stops, count);
+    return gpu::Gradient::MakeRadial(cx,
+                                     cy,
+                                     radius,
+                                     colors,
+                                     stops,
+                                     count,
+                                     m_gradientRamps.get());
+}
+
+rcp<RenderShader> RiveRenderFactory::updateLinearGradient(
+    rcp<RenderShader> shader,
+    float sx,
+    float sy,
+    float ex,
+    float ey,
+    const ColorInt colors[], // [count]
+    const float stops[],     // [count]
+    size_t count)
+{
+    auto gradient = lite_rtti_cast<gpu::Gradient*>(shader.get());
+    if (gradient != nullptr && gradient->updateLinear(sx,
+                                                      sy,
+                                                      ex,
+                                                      ey,
+                                                      colors,
+                                                      stops,
+                                                      count,
+                                                      m_gradientRamps.get()))
+    {
+        return shader;
+    }
+    return makeLinearGradient(sx, sy, ex, ey, colors, stops, count);
+}
+
+rcp<RenderShader> RiveRenderFactory::updateRadialGradient(
+    rcp<RenderShader> shader,
+    float cx,
+    float cy,
+    float radius,
+    const ColorInt colors[], // [count]
+    const float stops[],     // [count]
+    size_t count)
+{
+    auto gradient = lite_rtti_cast<gpu::Gradient*>(shader.get());
+    if (gradient != nullptr && gradient->updateRadial(cx,
+                                                      cy,
+                                                      radius,
+                                                      colors,
+                                                      stops,
+                                                      count,
+                                                      m_gradientRamps.get()))
+    {
+        return shader;
+    }
+    return makeRadialGradient(cx, cy, radius, colors, stops, count);
 }
 
 rcp<RenderPath> RiveRenderFactory::makeRenderPath(RawPath& rawPath,
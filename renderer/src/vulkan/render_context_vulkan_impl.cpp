@@ -172,7 +172,8 @@ public:
         VkAttachmentDescription attachment = {
             .format = VK_FORMAT_R8G8B8A8_UNORM,
             .samples = VK_SAMPLE_COUNT_1_BIT,
-            .loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+            // Complex color ramps stay resident between flushes.
+            .loadOp = VK_ATTACHMENT_LOAD_OP_LOAD,
             .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
             .initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
             .finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
@@ -610,6 +611,7 @@ RenderContextVulkanImpl::RenderContextVulkanImpl(
     // texture. We need to draw the previous renderTarget contents into it
     // manually when LoadAction::preserveRenderTarget is specified.
     m_platformFeatures.msaaColorPreserveNeedsDraw = true;
+    m_platformFeatures.gradTextureIsPersistent = true;
     m_platformFeatures.maxCoverageBufferLength =
         std::min(physicalDeviceProps.limits.maxStorageBufferRange, 1u << 28) /
         sizeof(uint32_t);
@@ -1162,15 +1164,17 @@ void RenderContextVulkanImpl::flush(const FlushDescriptor& desc)
     if (desc.gradSpanCount > 0)
     {
         // Wait for previous accesses to finish before rendering to the gradient
-        // texture.
+        // texture. The render pass loads the rows kept from earlier flushes, so
+        // it reads the attachment as well as writing it.
         m_gradTexture->barrier(
             commandBuffer,
             {
                 .pipelineStages = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
-                .accessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                .accessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT |
+                              VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
                 .layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
             },
-            vkutil::ImageAccessAction::invalidateContents);
+            vkutil::ImageAccessAction::preserveContents);
 
         VkRect2D renderArea = {
             .extent = {gpu::kGradTextureWidth, desc.gradDataHeight},
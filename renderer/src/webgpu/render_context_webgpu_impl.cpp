@@ -993,6 +993,7 @@ RenderContextWebGPUImpl::RenderContextWebGPUImpl(
     m_platformFeatures.supportsRasterOrdering = true;
     m_platformFeatures.clipSpaceBottomUp = true;
     m_platformFeatures.framebufferBottomUp = false;
+    m_platformFeatures.gradTextureIsPersistent = true;
 
 #ifdef RIVE_WAGYU
     m_capabilities.backendType = static_cast<wgpu::BackendType>(
@@ -2597,7 +2598,7 @@ void RenderContextWebGPUImpl::flush(const FlushDescriptor& desc)
     };
 
     // Render the complex color ramps to the gradient texture.
-    if (desc.gradDataHeight > 0)
+    if (desc.gradSpanCount > 0)
     {
         wgpu::BindGroupDescriptor colorRampBindGroupDesc = {
             .layout = m_colorRampPipeline->bindGroupLayout(),
@@ -2607,7 +2608,8 @@ void RenderContextWebGPUImpl::flush(const FlushDescriptor& desc)
 
         wgpu::RenderPassColorAttachment attachment = {
             .view = m_gradientTextureView,
-            .loadOp = wgpu::LoadOp::Clear,
+            // Complex color ramps stay resident between flushes.
+            .loadOp = wgpu::LoadOp::Load,
             .storeOp = wgpu::StoreOp::Store,
             .clearValue = {},
         };
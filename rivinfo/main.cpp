@@ -76,6 +76,23 @@ public:
 
 //////////////////////////////////////////////////
 
+// Set by --memory, adds a "memory" struct to files, artboards and machines.
+static bool gDumpMemory = false;
+
+static void dump(JSoner& js, const rive::MemoryUsage& usage)
+{
+    js.pushStruct("memory");
+    js.add("objects", std::to_string(usage.objects).c_str());
+    js.add("paths", std::to_string(usage.paths).c_str());
+    js.add("animation", std::to_string(usage.animation).c_str());
+    js.add("text", std::to_string(usage.text).c_str());
+    js.add("assets", std::to_string(usage.assets).c_str());
+    js.add("factoryResources",
+           std::to_string(usage.factoryResources).c_str());
+    js.add("total", std::to_string(usage.total()).c_str());
+    js.pop();
+}
+
 static void dump(JSoner& js, rive::LinearAnimationInstance* anim)
 {
     js.pushStruct();
@@ -99,6 +116,10 @@ static void dump(JSoner& js, rive::StateMachineInstance* smi)
         }
         js.pop();
     }
+    if (gDumpMemory)
+    {
+        dump(js, smi->memoryUsage());
+    }
     js.pop();
 }
 
@@ -124,6 +145,11 @@ static void dump(JSoner& js, rive::ArtboardInstance* abi)
         }
         js.pop();
     }
+    if (gDumpMemory)
+    {
+        abi->advance(0.0f);
+        dump(js, abi->memoryUsage());
+    }
     js.pop();
 }
 
@@ -136,9 +162,13 @@ static void dump(JSoner& js, rive::File* file)
         dump(js, file->artboardAt(i).get());
     }
     js.pop();
+    if (gDumpMemory)
+    {
+        dump(js, file->memoryUsage());
+    }
 }
 
-static rcp<rive::File> open_file(const char name[])
+static rive::rcp<rive::File> open_file(const char name[])
 {
     FILE* f = fopen(name, "rb");
     if (!f)
@@ -180,6 +210,11 @@ int main(int argc, const char* argv[])
             filename = argv[++i];
             continue;
         }
+        if (is_arg(argv[i], "--memory", "-m"))
+        {
+            gDumpMemory = true;
+            continue;
+        }
         printf("Unrecognized argument %s\n", argv[i]);
         return 1;
     }
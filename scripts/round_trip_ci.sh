@@ -40,7 +40,7 @@ TESTS=(
     "output/tests/test_189_no_trim.json:189 objects"
     "output/tests/test_190_no_trim.json:190 objects (previous threshold)"
     "output/tests/test_273_no_trim.json:273 objects"
-    "output/tests/bee_baby_NO_TRIMPATH.json:Full bee_baby (1142 objects)"
+    "output/tests/bee_baby_NO_TRIMPATH.json:Full bee_baby (827 objects)"
 )
 
 PASSED=0
@@ -9,6 +9,8 @@
 
 using namespace rive;
 
+namespace rive
+{
 class KeyedPropertyData
 {
 public:
@@ -50,127 +52,124 @@ public:
         }
     }
 };
+} // namespace rive
 
-class AnimationsData
+AnimationsData::AnimationsData(std::vector<const LinearAnimation*>& animations,
+                               bool useFirstAsBaseline)
 {
+    bool isFirstAnimation = useFirstAsBaseline;
+    for (auto animation : animations)
+    {
+        findKeyedObjects(animation, isFirstAnimation);
+        isFirstAnimation = false;
+    }
+}
 
-private:
-    std::vector<std::unique_ptr<KeyedObjectData>> keyedObjectsData;
-    KeyedObjectData* getKeyedObjectData(const KeyedObject* keyedObject)
+AnimationsData::~AnimationsData() {}
+
+KeyedObjectData* AnimationsData::getKeyedObjectData(
+    const KeyedObject* keyedObject)
+{
+    for (auto& keyedObjectData : keyedObjectsData)
     {
-        for (auto& keyedObjectData : keyedObjectsData)
+        if (keyedObjectData->objectId == keyedObject->objectId())
         {
-            if (keyedObjectData->objectId == keyedObject->objectId())
-            {
-                return keyedObjectData.get();
-            }
+            return keyedObjectData.get();
         }
-
-        auto keyedObjectData =
-            rivestd::make_unique<KeyedObjectData>(keyedObject->objectId());
-        auto ref = keyedObjectData.get();
-        keyedObjectsData.push_back(std::move(keyedObjectData));
-        return ref;
     }
 
-    void findKeyedObjects(const LinearAnimation* animation,
-                          bool isFirstAnimation)
+    auto keyedObjectData =
+        rivestd::make_unique<KeyedObjectData>(keyedObject->objectId());
+    auto ref = keyedObjectData.get();
+    keyedObjectsData.push_back(std::move(keyedObjectData));
+    return ref;
+}
+
+void AnimationsData::findKeyedObjects(const LinearAnimation* animation,
+                                      bool isFirstAnimation)
+{
+    size_t index = 0;
+    while (index < animation->numKeyedObjects())
     {
-        size_t index = 0;
-        while (index < animation->numKeyedObjects())
-        {
-            auto keyedObject = animation->getObject(index);
-            auto keyedObjectData = getKeyedObjectData(keyedObject);
+        auto keyedObject = animation->getObject(index);
+        auto keyedObjectData = getKeyedObjectData(keyedObject);
 
-            keyedObjectData->addProperties(keyedObject, isFirstAnimation);
-            index++;
-        }
+        keyedObjectData->addProperties(keyedObject, isFirstAnimation);
+        index++;
     }
+}
 
-public:
-    AnimationsData(std::vector<const LinearAnimation*>& animations,
-                   bool useFirstAsBaseline)
+void AnimationsData::writeObjects(AnimationReset* animationReset,
+                                  ArtboardInstance* artboard)
+{
+    for (auto& keyedObjectData : keyedObjectsData)
     {
-        bool isFirstAnimation = useFirstAsBaseline;
-        for (auto animation : animations)
+        auto object = artboard->resolve(keyedObjectData->objectId);
+        if (object == nullptr)
         {
-            findKeyedObjects(animation, isFirstAnimation);
-            isFirstAnimation = false;
+            continue;
         }
-    }
-
-    void writeObjects(AnimationReset* animationReset,
-                      ArtboardInstance* artboard)
-    {
-        for (auto& keyedObjectData : keyedObjectsData)
+        auto component = object->as<Component>();
+        const auto& propertiesData = keyedObjectData->keyedPropertiesData;
+        if (propertiesData.size() > 0)
         {
-            auto object = artboard->resolve(keyedObjectData->objectId);
-            if (object == nullptr)
+            animationReset->writeObjectId(keyedObjectData->objectId);
+            animationReset->writeTotalProperties(
+                (uint32_t)propertiesData.size());
+            for (const auto& keyedPropertyData : propertiesData)
             {
-                continue;
-            }
-            auto component = object->as<Component>();
-            auto propertiesData = keyedObjectData->keyedPropertiesData;
-            if (propertiesData.size() > 0)
-            {
-                animationReset->writeObjectId(keyedObjectData->objectId);
-                animationReset->writeTotalProperties(
-                    (uint32_t)propertiesData.size());
-                for (auto keyedPropertyData : propertiesData)
+                auto keyedProperty = keyedPropertyData.keyedProperty;
+                auto propertyKey = keyedProperty->propertyKey();
+                switch (CoreRegistry::propertyFieldId(propertyKey))
                 {
-                    auto keyedProperty = keyedPropertyData.keyedProperty;
-                    auto propertyKey = keyedProperty->propertyKey();
-                    switch (CoreRegistry::propertyFieldId(propertyKey))
-                    {
-                        case CoreDoubleType::id:
-                            animationReset->writePropertyKey(propertyKey);
-                            if (keyedPropertyData.isBaseline)
-                            {
-                                auto firstKeyframe = keyedProperty->first();
-                                if (firstKeyframe != nullptr)
-                                {
-                                    auto value = keyedProperty->first()
-                                                     ->as<KeyFrameDouble>()
-                                                     ->value();
-                                    animationReset->writePropertyValue(value);
-                                }
-                            }
-                            else
+                    case CoreDoubleType::id:
+                        animationReset->writePropertyKey(propertyKey);
+                        if (keyedPropertyData.isBaseline)
+                        {
+                            auto firstKeyframe = keyedProperty->first();
+                            if (firstKeyframe != nullptr)
                             {
-                                animationReset->writePropertyValue(
-                                    CoreRegistry::getDouble(component,
-                                                            propertyKey));
+                                auto value = keyedProperty->first()
+                                                 ->as<KeyFrameDouble>()
+                                                 ->value();
+                                animationReset->writePropertyValue(value);
                             }
-                            break;
-                        case CoreColorType::id:
+                        }
+                        else
+                        {
+                            animationReset->writePropertyValue(
+                                CoreRegistry::getDouble(component,
+                                                        propertyKey));
+                        }
+                        break;
+                    case CoreColorType::id:
 
-                            animationReset->writePropertyKey(propertyKey);
-                            if (keyedPropertyData.isBaseline)
-                            {
-                                auto firstKeyframe = keyedProperty->first();
-                                if (firstKeyframe != nullptr)
-                                {
-                                    auto value = keyedProperty->first()
-                                                     ->as<KeyFrameColor>()
-                                                     ->value();
-                                    animationReset->writePropertyValue(
-                                        (float)value);
-                                }
-                            }
-                            else
+                        animationReset->writePropertyKey(propertyKey);
+                        if (keyedPropertyData.isBaseline)
+                        {
+                            auto firstKeyframe = keyedProperty->first();
+                            if (firstKeyframe != nullptr)
                             {
+                                auto value = keyedProperty->first()
+                                                 ->as<KeyFrameColor>()
+                                                 ->value();
                                 animationReset->writePropertyValue(
-                                    (float)CoreRegistry::getColor(component,
-                                                                  propertyKey));
+                                    (float)value);
                             }
-                            break;
-                    }
+                        }
+                        else
+                        {
+                            animationReset->writePropertyValue(
+                                (float)CoreRegistry::getColor(component,
+                                                              propertyKey));
+                        }
+                        break;
                 }
             }
         }
-        animationReset->complete();
     }
-};
+    animationReset->complete();
+}
 
 std::unique_ptr<AnimationReset> AnimationResetFactory::getInstance()
 {
@@ -204,11 +203,28 @@ std::unique_ptr<AnimationReset> AnimationResetFactory::fromStates(
     StateInstance* stateFrom,
     StateInstance* currentState,
     ArtboardInstance* artboard)
+{
+    auto animationsData = dataFromStates(stateFrom, currentState);
+    return fromData(animationsData.get(), artboard);
+}
+
+std::unique_ptr<AnimationsData> AnimationResetFactory::dataFromStates(
+    StateInstance* stateFrom,
+    StateInstance* currentState)
 {
     std::vector<const LinearAnimation*> animations;
     fromState(stateFrom, animations);
     fromState(currentState, animations);
-    return fromAnimations(animations, artboard, false);
+    return rivestd::make_unique<AnimationsData>(animations, false);
+}
+
+std::unique_ptr<AnimationReset> AnimationResetFactory::fromData(
+    AnimationsData* animationsData,
+    ArtboardInstance* artboard)
+{
+    auto animationReset = AnimationResetFactory::getInstance();
+    animationsData->writeObjects(animationReset.get(), artboard);
+    return animationReset;
 }
 
 std::unique_ptr<AnimationReset> AnimationResetFactory::fromAnimations(
@@ -216,11 +232,8 @@ std::unique_ptr<AnimationReset> AnimationResetFactory::fromAnimations(
     ArtboardInstance* artboard,
     bool useFirstAsBaseline)
 {
-    auto animationsData = new AnimationsData(animations, useFirstAsBaseline);
-    auto animationReset = AnimationResetFactory::getInstance();
-    animationsData->writeObjects(animationReset.get(), artboard);
-    delete animationsData;
-    return animationReset;
+    AnimationsData animationsData(animations, useFirstAsBaseline);
+    return fromData(&animationsData, artboard);
 }
 
 std::vector<std::unique_ptr<AnimationReset>> AnimationResetFactory::m_resources;
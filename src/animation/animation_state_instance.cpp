@@ -42,4 +42,10 @@ bool AnimationStateInstance::keepGoing() const { return m_KeepGoing; }
 void AnimationStateInstance::clearSpilledTime()
 {
     m_AnimationInstance.clearSpilledTime();
+}
+
+void AnimationStateInstance::reset()
+{
+    m_AnimationInstance.restart(state()->as<AnimationState>()->speed());
+    m_KeepGoing = true;
 }
\ No newline at end of file
@@ -9,7 +9,8 @@ using namespace rive;
 
 BlendState1DInstance::BlendState1DInstance(const BlendState1D* blendState,
                                            ArtboardInstance* instance) :
-    BlendStateInstance<BlendState1D, BlendAnimation1D>(blendState, instance)
+    BlendStateInstance<BlendState1D, BlendAnimation1D>(blendState, instance),
+    m_ArtboardInstance(instance)
 {
 
     if ((static_cast<LayerStateFlags>(blendState->flags()) &
@@ -20,16 +21,35 @@ BlendState1DInstance::BlendState1DInstance(const BlendState1D* blendState,
         {
             animations.push_back(blendAnimation->animation());
         }
+        // Keep the collected properties so a recycled instance can take a
+        // fresh snapshot without walking the animations again.
+        m_AnimationsData = rivestd::make_unique<AnimationsData>(animations, true);
         m_AnimationReset =
-            AnimationResetFactory::fromAnimations(animations, instance, true);
+            AnimationResetFactory::fromData(m_AnimationsData.get(), instance);
     }
 }
 
-BlendState1DInstance::~BlendState1DInstance()
+BlendState1DInstance::~BlendState1DInstance() { recycle(); }
+
+void BlendState1DInstance::recycle()
 {
     if (m_AnimationReset != nullptr)
     {
         AnimationResetFactory::release(std::move(m_AnimationReset));
+        m_AnimationReset = nullptr;
+    }
+}
+
+void BlendState1DInstance::reset()
+{
+    BlendStateInstance<BlendState1D, BlendAnimation1D>::reset();
+    m_From = nullptr;
+    m_To = nullptr;
+    if (m_AnimationsData != nullptr && m_AnimationReset == nullptr)
+    {
+        m_AnimationReset =
+            AnimationResetFactory::fromData(m_AnimationsData.get(),
+                                            m_ArtboardInstance);
     }
 }
 
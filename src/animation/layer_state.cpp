@@ -1,10 +1,17 @@
 #include "rive/animation/layer_state.hpp"
+#include "rive/animation/layer_state_flags.hpp"
+#include "rive/animation/transition_artboard_condition.hpp"
 #include "rive/animation/transition_bool_condition.hpp"
+#include "rive/animation/transition_property_viewmodel_comparator.hpp"
+#include "rive/animation/transition_self_comparator.hpp"
+#include "rive/animation/transition_value_comparator.hpp"
+#include "rive/animation/transition_viewmodel_condition.hpp"
 #include "rive/importers/import_stack.hpp"
 #include "rive/importers/state_machine_layer_importer.hpp"
 #include "rive/generated/animation/state_machine_layer_base.hpp"
 #include "rive/animation/state_transition.hpp"
 #include "rive/animation/system_state_instance.hpp"
+#include <algorithm>
 
 using namespace rive;
 
@@ -39,9 +46,78 @@ StatusCode LayerState::onAddedClean(CoreContext* context)
             return code;
         }
     }
+    buildTransitionDependencies();
     return StatusCode::Ok;
 }
 
+static bool comparatorReadsValues(const TransitionComparator* comparator)
+{
+    return comparator == nullptr ||
+           comparator->is<TransitionPropertyViewModelComparator>() ||
+           comparator->is<TransitionValueComparator>() ||
+           comparator->is<TransitionSelfComparator>();
+}
+
+void LayerState::buildTransitionDependencies()
+{
+    m_transitionInputIds.clear();
+    m_transitionsReadViewModel = false;
+    m_transitionsDependOnValues =
+        (static_cast<LayerStateFlags>(flags()) & LayerStateFlags::Random) !=
+        LayerStateFlags::Random;
+    for (auto transition : m_Transitions)
+    {
+        if (!m_transitionsDependOnValues)
+        {
+            break;
+        }
+        if (transition->isDisabled())
+        {
+            continue;
+        }
+        if (transition->enableExitTime())
+        {
+            m_transitionsDependOnValues = false;
+            break;
+        }
+        for (size_t i = 0; i < transition->conditionCount(); i++)
+        {
+            auto condition = transition->condition(i);
+            if (condition->is<TransitionInputCondition>())
+            {
+                auto inputId =
+                    condition->as<TransitionInputCondition>()->inputId();
+                if (std::find(m_transitionInputIds.begin(),
+                              m_transitionInputIds.end(),
+                              inputId) == m_transitionInputIds.end())
+                {
+                    m_transitionInputIds.push_back(inputId);
+                }
+            }
+            else if (condition->is<TransitionViewModelCondition>() &&
+                     !condition->is<TransitionArtboardCondition>())
+            {
+                auto viewModelCondition =
+                    condition->as<TransitionViewModelCondition>();
+                if (!comparatorReadsValues(
+                        viewModelCondition->leftComparator()) ||
+                    !comparatorReadsValues(
+                        viewModelCondition->rightComparator()))
+                {
+                    m_transitionsDependOnValues = false;
+                    break;
+                }
+                m_transitionsReadViewModel = true;
+            }
+            else
+            {
+                m_transitionsDependOnValues = false;
+                break;
+            }
+        }
+    }
+}
+
 StatusCode LayerState::import(ImportStack& importStack)
 {
     auto layerImporter = importStack.latest<StateMachineLayerImporter>(
@@ -254,6 +254,19 @@ void LinearAnimationInstance::reset(float speedMultiplier = 1.0)
                                     : m_animation->endTime();
 }
 
+void LinearAnimationInstance::restart(float speedMultiplier)
+{
+    m_time = (speedMultiplier >= 0) ? m_animation->startTime()
+                                    : m_animation->endTime();
+    m_speedDirection = (speedMultiplier >= 0) ? 1 : -1;
+    m_totalTime = 0.0f;
+    m_lastTotalTime = 0.0f;
+    m_spilledTime = 0.0f;
+    m_direction = 1;
+    m_didLoop = false;
+    m_loopValue = -1;
+}
+
 uint32_t LinearAnimationInstance::fps() const { return m_animation->fps(); }
 
 uint32_t LinearAnimationInstance::duration() const
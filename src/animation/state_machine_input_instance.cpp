@@ -17,6 +17,7 @@ const std::string& SMIInput::name() const { return m_input->name(); }
 
 void SMIInput::valueChanged()
 {
+    m_changeStamp = m_machineInstance->nextChangeStamp();
     m_machineInstance->markNeedsAdvance();
 #ifdef WITH_RIVE_TOOLS
     auto callback = m_machineInstance->m_inputChangedCallback;
@@ -43,8 +43,11 @@
 #include "rive/audio_event.hpp"
 #include "rive/dirtyable.hpp"
 #include "rive/profiler/profiler_macros.h"
+#include <algorithm>
+#include <map>
 #include <unordered_map>
 #include <chrono>
+#include <limits>
 
 using namespace rive;
 namespace rive
@@ -57,6 +60,10 @@ public:
         delete m_anyStateInstance;
         delete m_currentState;
         delete m_stateFrom;
+        for (auto instance : m_idleStates)
+        {
+            delete instance;
+        }
     }
 
     void init(StateMachineInstance* stateMachineInstance,
@@ -69,6 +76,11 @@ public:
         m_anyStateInstance =
             layer->anyState()->makeInstance(instance).release();
         m_layer = layer;
+        m_idleStates.resize(layer->stateCount(), nullptr);
+        for (size_t i = 0; i < layer->stateCount(); i++)
+        {
+            m_stateIndices[layer->state(i)] = i;
+        }
         changeState(m_layer->entryState());
 
 #ifdef TESTING
@@ -84,19 +96,49 @@ public:
 
     void resetState()
     {
-        if (m_stateFrom != m_anyStateInstance && m_stateFrom != m_currentState)
+        if (m_stateFrom != m_currentState)
         {
-            delete m_stateFrom;
+            releaseState(m_stateFrom);
         }
         m_stateFrom = nullptr;
-        if (m_currentState != m_anyStateInstance)
-        {
-            delete m_currentState;
-        }
+        releaseState(m_currentState);
         m_currentState = nullptr;
         changeState(m_layer->entryState());
     }
 
+    // Returns an instance for the given state, recycling the one left behind
+    // the last time the layer was in that state when possible.
+    StateInstance* acquireState(const LayerState* state)
+    {
+        auto itr = m_stateIndices.find(state);
+        if (itr != m_stateIndices.end() && m_idleStates[itr->second] != nullptr)
+        {
+            auto instance = m_idleStates[itr->second];
+            m_idleStates[itr->second] = nullptr;
+            instance->reset();
+            return instance;
+        }
+        return state->makeInstance(m_artboardInstance).release();
+    }
+
+    // Keeps a state instance the layer no longer uses for a later
+    // acquireState, only deleting it if the slot is already taken.
+    void releaseState(StateInstance* instance)
+    {
+        if (instance == nullptr || instance == m_anyStateInstance)
+        {
+            return;
+        }
+        auto itr = m_stateIndices.find(instance->state());
+        if (itr != m_stateIndices.end() && m_idleStates[itr->second] == nullptr)
+        {
+            instance->recycle();
+            m_idleStates[itr->second] = instance;
+            return;
+        }
+        delete instance;
+    }
+
     void updateMix(float seconds)
     {
         if (m_transition != nullptr && m_stateFrom != nullptr &&
@@ -225,10 +267,11 @@ public:
                        m_currentState->state()->events());
         }
 
-        m_currentState =
-            stateTo == nullptr
-                ? nullptr
-                : stateTo->makeInstance(m_artboardInstance).release();
+        m_currentState = stateTo == nullptr ? nullptr : acquireState(stateTo);
+        // Both the current state's transitions and the any state's (which
+        // can't target the current state) need to be evaluated again.
+        m_anyStateSettledStamp = 0;
+        m_currentStateSettledStamp = 0;
 
         // Fire start events for the state we're changing to.
         if (m_currentState != nullptr)
@@ -340,10 +383,20 @@ public:
 
     void buildAnimationResetForTransition()
     {
+        // Which properties need resetting only depends on the two states, so
+        // collect them once per pair and only re-read the values after that.
+        auto& animationsData = m_animationsData[std::make_pair(
+            m_stateFrom == nullptr ? nullptr : m_stateFrom->state(),
+            m_currentState == nullptr ? nullptr : m_currentState->state())];
+        if (animationsData == nullptr)
+        {
+            animationsData =
+                AnimationResetFactory::dataFromStates(m_stateFrom,
+                                                      m_currentState);
+        }
         m_animationReset =
-            AnimationResetFactory::fromStates(m_stateFrom,
-                                              m_currentState,
-                                              m_artboardInstance);
+            AnimationResetFactory::fromData(animationsData.get(),
+                                            m_artboardInstance);
     }
 
     void clearAnimationReset()
@@ -355,17 +408,64 @@ public:
         }
     }
 
+    // Whether any value read by the transitions of state changed since they
+    // were last evaluated (at settledStamp) without finding one allowed.
+    bool transitionInputsChanged(const LayerState* state,
+                                 uint64_t settledStamp) const
+    {
+        if (settledStamp == 0 || !state->transitionsDependOnValues())
+        {
+            return true;
+        }
+        if (state->transitionsReadViewModel() &&
+            m_stateMachineInstance->m_dataBindChangeStamp > settledStamp)
+        {
+            return true;
+        }
+        for (auto inputId : state->transitionInputIds())
+        {
+            auto input = m_stateMachineInstance->input(inputId);
+            if (input == nullptr || input->m_changeStamp > settledStamp)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     bool tryChangeState(StateInstance* stateFromInstance)
     {
         if (stateFromInstance == nullptr)
         {
             return false;
         }
+        uint64_t& settledStamp = stateFromInstance == m_anyStateInstance
+                                     ? m_anyStateSettledStamp
+                                     : m_currentStateSettledStamp;
+        if (!transitionInputsChanged(stateFromInstance->state(),
+                                     settledStamp))
+        {
+            return false;
+        }
+#ifdef TESTING
+        m_stateMachineInstance->transitionEvaluationCount++;
+#endif
         auto outState = m_currentState;
         auto transition = findAllowedTransition(stateFromInstance);
-        if (transition != nullptr)
+        if (transition == nullptr)
+        {
+            settledStamp = m_stateMachineInstance->m_changeStamp;
+        }
+        else
         {
             clearAnimationReset();
+            // Old state from is done. Recycle it before changing state so
+            // that bouncing between two states keeps reusing both instances.
+            if (m_stateFrom != outState)
+            {
+                releaseState(m_stateFrom);
+            }
+            m_stateFrom = nullptr;
             changeState(transition->stateTo());
             m_stateMachineChangedOnAdvance = true;
             // state actually has changed
@@ -383,11 +483,6 @@ public:
                 m_transitionCompleted = false;
             }
 
-            if (m_stateFrom != m_anyStateInstance)
-            {
-                // Old state from is done.
-                delete m_stateFrom;
-            }
             m_stateFrom = outState;
 
             if (!m_transitionCompleted)
@@ -499,6 +594,21 @@ private:
     StateInstance* m_currentState = nullptr;
     StateInstance* m_stateFrom = nullptr;
 
+    // Machine change stamps at which the any state's and the current state's
+    // transitions were last evaluated without finding one allowed, 0 when
+    // they must be evaluated.
+    uint64_t m_anyStateSettledStamp = 0;
+    uint64_t m_currentStateSettledStamp = 0;
+
+    // Instances of states the layer has left, indexed like the layer's
+    // states, so transitions allocate nothing once each state has been
+    // visited.
+    std::vector<StateInstance*> m_idleStates;
+    std::unordered_map<const LayerState*, size_t> m_stateIndices;
+    std::map<std::pair<const LayerState*, const LayerState*>,
+             std::unique_ptr<AnimationsData>>
+        m_animationsData;
+
     const StateTransition* m_transition = nullptr;
     std::unique_ptr<AnimationReset> m_animationReset = nullptr;
     bool m_transitionCompleted = false;
@@ -1250,6 +1360,8 @@ HitResult StateMachineInstance::updateListeners(Vec2D position,
                                                 ListenerType hitType,
                                                 float timeStamp)
 {
+    // Hover and press states can change even when nothing is hit.
+    wake();
     if (m_artboardInstance->frameOrigin())
     {
         position -= Vec2D(
@@ -1800,6 +1912,7 @@ void StateMachineInstance::updateDataBinds()
         {
             dataBind->dirt(ComponentDirt::None);
             dataBind->update(d);
+            dataBindsChanged();
         }
     }
 }
@@ -1898,6 +2011,14 @@ void StateMachineInstance::reset()
 bool StateMachineInstance::advanceAndApply(float seconds)
 {
     RIVE_PROF_SCOPE()
+    if (m_sleeping)
+    {
+        if (!shouldWake())
+        {
+            return false;
+        }
+        m_sleeping = false;
+    }
     // Advancing by 0 could return false, when it shouldn't. Force keepGoing
     // to true.
     bool keepGoing = this->advance(seconds, true) || seconds == 0.0f;
@@ -1937,13 +2058,90 @@ bool StateMachineInstance::advanceAndApply(float seconds)
             break;
         }
     }
-    return keepGoing || !m_reportedEvents.empty() ||
-           !m_reportedListenerViewModels.empty();
+    keepGoing = keepGoing || !m_reportedEvents.empty() ||
+                !m_reportedListenerViewModels.empty();
+    // A zero second advance reports keepGoing regardless, so only settle
+    // after advancing time.
+    if (m_sleepWhenSettled && !keepGoing && seconds > 0.0f && !shouldWake())
+    {
+        m_sleeping = true;
+    }
+    return keepGoing;
 }
 
-void StateMachineInstance::markNeedsAdvance() { m_needsAdvance = true; }
+void StateMachineInstance::markNeedsAdvance()
+{
+    m_needsAdvance = true;
+    m_sleeping = false;
+}
 bool StateMachineInstance::needsAdvance() const { return m_needsAdvance; }
 
+void StateMachineInstance::sleepWhenSettled(bool value)
+{
+    m_sleepWhenSettled = value;
+    if (!value)
+    {
+        m_sleeping = false;
+    }
+}
+
+float StateMachineInstance::secondsUntilWake() const
+{
+    return isSleeping() ? std::numeric_limits<float>::infinity() : 0.0f;
+}
+
+static bool nestedArtboardsNeedAdvance(const Artboard* artboard)
+{
+    for (auto nestedArtboard : artboard->nestedArtboards())
+    {
+        auto instance = nestedArtboard->artboardInstance();
+        if (instance == nullptr)
+        {
+            continue;
+        }
+        if (instance->hasDirt(ComponentDirt::Components))
+        {
+            return true;
+        }
+        for (auto animation : nestedArtboard->nestedAnimations())
+        {
+            if (animation->is<NestedStateMachine>())
+            {
+                auto stateMachineInstance =
+                    animation->as<NestedStateMachine>()->stateMachineInstance();
+                if (stateMachineInstance != nullptr &&
+                    stateMachineInstance->needsAdvance())
+                {
+                    return true;
+                }
+            }
+        }
+        if (nestedArtboardsNeedAdvance(instance))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool StateMachineInstance::shouldWake() const
+{
+    if (m_needsAdvance || !m_reportedEvents.empty() ||
+        !m_reportedListenerViewModels.empty() ||
+        m_artboardInstance->hasDirt(ComponentDirt::Components))
+    {
+        return true;
+    }
+    for (auto dataBind : m_dataBinds)
+    {
+        if (dataBind->dirt() != ComponentDirt::None)
+        {
+            return true;
+        }
+    }
+    return nestedArtboardsNeedAdvance(m_artboardInstance);
+}
+
 void StateMachineInstance::resetState()
 {
     for (size_t i = 0; i < m_layerCount; i++)
@@ -2010,6 +2208,7 @@ void StateMachineInstance::dataContext(DataContext* dataContext)
 void StateMachineInstance::internalDataContext(DataContext* dataContext)
 {
     m_DataContext = dataContext;
+    dataBindsChanged();
     for (auto dataBind : m_dataBinds)
     {
         if (dataBind->is<DataBindContext>())
@@ -2025,6 +2224,7 @@ void StateMachineInstance::internalDataContext(DataContext* dataContext)
 
 void StateMachineInstance::clearDataContext()
 {
+    dataBindsChanged();
     if (m_ownsDataContext && m_DataContext != nullptr)
     {
         delete m_DataContext;
@@ -2133,6 +2333,39 @@ const EventReport StateMachineInstance::reportedEventAt(std::size_t index) const
     return m_reportedEvents[index];
 }
 
+template <typename K, typename V>
+static size_t mapBytes(const std::unordered_map<K, V>& map)
+{
+    // Each entry is a node holding the pair and a next pointer.
+    return map.bucket_count() * sizeof(void*) +
+           map.size() * (sizeof(std::pair<const K, V>) + sizeof(void*));
+}
+
+MemoryUsage StateMachineInstance::memoryUsage() const
+{
+    MemoryUsage usage;
+    usage.animation += sizeof(StateMachineInstance) +
+                       m_layerCount * sizeof(StateMachineLayerInstance) +
+                       MemoryUsage::vectorBytes(m_inputInstances) +
+                       MemoryUsage::vectorBytes(m_hitComponents) +
+                       MemoryUsage::vectorBytes(m_listenerGroups) +
+                       MemoryUsage::vectorBytes(m_reportedEvents) +
+                       MemoryUsage::vectorBytes(m_reportingEvents) +
+                       mapBytes(m_bindablePropertyInstances) +
+                       mapBytes(m_bindableDataBindsToTarget) +
+                       mapBytes(m_bindableDataBindsToSource);
+    // Inputs are counted at the size of the largest input type.
+    usage.animation +=
+        m_inputInstances.size() *
+        std::max({sizeof(SMIBool), sizeof(SMINumber), sizeof(SMITrigger)});
+    usage.objects += MemoryUsage::vectorBytes(m_dataBinds);
+    for (auto dataBind : m_dataBinds)
+    {
+        usage.objects += MemoryUsage::objectBytes(dataBind);
+    }
+    return usage;
+}
+
 void StateMachineInstance::notify(const std::vector<EventReport>& events,
                                   NestedArtboard* context)
 {
@@ -12,6 +12,16 @@
 #include "rive/draw_target_placement.hpp"
 #include "rive/drawable.hpp"
 #include "rive/animation/keyed_object.hpp"
+#include "rive/animation/keyed_property.hpp"
+#include "rive/animation/keyframe.hpp"
+#include "rive/animation/layer_state.hpp"
+#include "rive/animation/listener_action.hpp"
+#include "rive/animation/nested_state_machine.hpp"
+#include "rive/animation/state_machine_input.hpp"
+#include "rive/animation/state_machine_layer.hpp"
+#include "rive/animation/state_machine_listener.hpp"
+#include "rive/animation/state_transition.hpp"
+#include "rive/animation/transition_condition.hpp"
 #include "rive/factory.hpp"
 #include "rive/renderer.hpp"
 #include "rive/shapes/paint/shape_paint.hpp"
@@ -29,7 +39,9 @@
 #include "rive/animation/nested_trigger.hpp"
 #include "rive/animation/state_machine_input_instance.hpp"
 #include "rive/animation/state_machine_instance.hpp"
+#include "rive/shapes/path.hpp"
 #include "rive/shapes/shape.hpp"
+#include "rive/text/text.hpp"
 #include "rive/text/text_value_run.hpp"
 #include "rive/event.hpp"
 #include "rive/assets/audio_asset.hpp"
@@ -822,6 +834,7 @@ void Artboard::update(ComponentDirt value)
 
 void Artboard::updateDataBinds()
 {
+    RIVE_PROF_SCOPE()
     for (auto artboardHost : m_ArtboardHosts)
     {
         artboardHost->updateDataBinds();
@@ -1040,6 +1053,7 @@ bool Artboard::syncStyleChanges()
 
 void Artboard::calculateLayout()
 {
+    RIVE_PROF_SCOPE()
 #if defined(WITH_RIVE_TOOLS) && !defined(TESTING)
     calculateLayoutInternal(NAN, NAN);
 #else
@@ -1058,6 +1072,7 @@ void Artboard::calculateLayout()
 
 bool Artboard::updatePass(bool isRoot)
 {
+    RIVE_PROF_SCOPE()
     updateDataBinds();
     bool didUpdate = false;
     syncStyleChangesWithUpdate();
@@ -1237,7 +1252,25 @@ bool Artboard::hitTestPoint(const Vec2D& position,
 
 void Artboard::draw(Renderer* renderer) { draw(renderer, DrawOption::kNormal); }
 
+void Artboard::draw(Renderer* renderer, const AABB& cullRect, DrawOption option)
+{
+    // Bring the rect into world space, undoing the frame origin translation
+    // draw applies.
+    m_worldCullRect =
+        m_FrameOrigin ? cullRect.offset(-layoutWidth() * originX(),
+                                        -layoutHeight() * originY())
+                      : cullRect;
+    m_hasCullRect = true;
+    drawInternal(renderer, option);
+}
+
 void Artboard::draw(Renderer* renderer, DrawOption option)
+{
+    m_hasCullRect = false;
+    drawInternal(renderer, option);
+}
+
+void Artboard::drawInternal(Renderer* renderer, DrawOption option)
 {
     RIVE_PROF_SCOPE()
 
@@ -1289,6 +1322,11 @@ void Artboard::draw(Renderer* renderer, DrawOption option)
             {
                 continue;
             }
+            if (m_hasCullRect && drawable->is<Shape>() &&
+                drawable->as<Shape>()->isCulled())
+            {
+                continue;
+            }
             drawable->draw(renderer);
         }
     }
@@ -1383,6 +1421,152 @@ bool Artboard::hasAudio() const
     return false;
 }
 
+static size_t animationBytes(const LinearAnimation* animation)
+{
+    size_t bytes = MemoryUsage::objectBytes(animation);
+    for (size_t i = 0; i < animation->numKeyedObjects(); i++)
+    {
+        auto keyedObject = animation->getObject(i);
+        bytes += MemoryUsage::objectBytes(keyedObject);
+        for (size_t j = 0; j < keyedObject->numKeyedProperties(); j++)
+        {
+            auto keyedProperty = keyedObject->getProperty(j);
+            bytes += MemoryUsage::objectBytes(keyedProperty);
+            for (size_t k = 0; k < keyedProperty->numKeyFrames(); k++)
+            {
+                auto keyFrame = keyedProperty->getKeyFrame(k);
+                bytes += MemoryUsage::objectBytes(keyFrame);
+            }
+        }
+    }
+    return bytes;
+}
+
+static size_t stateMachineBytes(const StateMachine* stateMachine)
+{
+    size_t bytes = MemoryUsage::objectBytes(stateMachine);
+    for (size_t i = 0; i < stateMachine->inputCount(); i++)
+    {
+        bytes += MemoryUsage::objectBytes(stateMachine->input(i));
+    }
+    for (size_t i = 0; i < stateMachine->layerCount(); i++)
+    {
+        auto layer = stateMachine->layer(i);
+        bytes += MemoryUsage::objectBytes(layer);
+        for (size_t j = 0; j < layer->stateCount(); j++)
+        {
+            auto state = layer->state(j);
+            bytes += MemoryUsage::objectBytes(state);
+            for (size_t k = 0; k < state->transitionCount(); k++)
+            {
+                auto transition = state->transition(k);
+                bytes += MemoryUsage::objectBytes(transition);
+                for (size_t c = 0; c < transition->conditionCount(); c++)
+                {
+                    bytes +=
+                        MemoryUsage::objectBytes(transition->condition(c));
+                }
+            }
+        }
+    }
+    for (size_t i = 0; i < stateMachine->listenerCount(); i++)
+    {
+        auto listener = stateMachine->listener(i);
+        bytes += MemoryUsage::objectBytes(listener);
+        for (size_t j = 0; j < listener->actionCount(); j++)
+        {
+            bytes += MemoryUsage::objectBytes(listener->action(j));
+        }
+    }
+    for (size_t i = 0; i < stateMachine->dataBindCount(); i++)
+    {
+        bytes += MemoryUsage::objectBytes(stateMachine->dataBind(i));
+    }
+    return bytes;
+}
+
+static void addPathUsage(MemoryUsage& usage, const ShapePaintPath* path)
+{
+    size_t bytes = MemoryUsage::rawPathBytes(*path->rawPath());
+    usage.paths += bytes;
+    if (path->hasRenderPath())
+    {
+        // The factory keeps its own copy of the geometry.
+        usage.factoryResources += bytes;
+    }
+}
+
+MemoryUsage Artboard::memoryUsage() const
+{
+    MemoryUsage usage;
+    usage.objects += MemoryUsage::vectorBytes(m_Objects) +
+                     MemoryUsage::vectorBytes(m_DependencyOrder) +
+                     MemoryUsage::vectorBytes(m_Drawables);
+    for (auto object : m_Objects)
+    {
+        if (object == nullptr)
+        {
+            continue;
+        }
+        usage.objects += MemoryUsage::objectBytes(object);
+        if (object->is<Path>())
+        {
+            auto path = object->as<Path>();
+            usage.paths += MemoryUsage::rawPathBytes(path->rawPath());
+        }
+        else if (object->is<Shape>())
+        {
+            auto composer = object->as<Shape>()->pathComposer();
+            addPathUsage(usage, composer->localPath());
+            addPathUsage(usage, composer->worldPath());
+            addPathUsage(usage, composer->localClockwisePath());
+        }
+        else if (object->is<Text>())
+        {
+            usage.text += object->as<Text>()->shapedTextBytes();
+        }
+        else if (object->is<NestedArtboard>())
+        {
+            for (auto animation :
+                 object->as<NestedArtboard>()->nestedAnimations())
+            {
+                if (animation->is<NestedStateMachine>())
+                {
+                    auto machine = animation->as<NestedStateMachine>()
+                                       ->stateMachineInstance();
+                    if (machine != nullptr)
+                    {
+                        usage += machine->memoryUsage();
+                    }
+                }
+            }
+        }
+    }
+    for (auto artboardHost : m_ArtboardHosts)
+    {
+        for (int i = 0; i < artboardHost->artboardCount(); i++)
+        {
+            auto artboard = artboardHost->artboardInstance(i);
+            if (artboard != nullptr)
+            {
+                usage += artboard->memoryUsage();
+            }
+        }
+    }
+    if (!isInstance())
+    {
+        for (auto animation : m_Animations)
+        {
+            usage.animation += animationBytes(animation);
+        }
+        for (auto stateMachine : m_StateMachines)
+        {
+            usage.animation += stateMachineBytes(stateMachine);
+        }
+    }
+    return usage;
+}
+
 bool Artboard::isTranslucent(const LinearAnimation* anim) const
 {
     // For now we're conservative/lazy -- if we see that any of our paints are
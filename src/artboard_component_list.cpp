@@ -5,6 +5,7 @@
 #include "rive/constraints/list_constraint.hpp"
 #include "rive/constraints/scrolling/scroll_constraint.hpp"
 #include "rive/layout_component.hpp"
+#include "rive/shapes/shape.hpp"
 #include "rive/viewmodel/viewmodel_instance_symbol_list_index.hpp"
 #include "rive/world_transform_component.hpp"
 #include "rive/layout/layout_data.hpp"
@@ -469,11 +470,7 @@ void ArtboardComponentList::draw(Renderer* renderer)
                     auto artboard = artboardInstance(i);
                     if (artboard != nullptr)
                     {
-                        renderer->save();
-                        auto transform = m_artboardTransforms[artboard];
-                        renderer->transform(transform);
-                        artboard->draw(renderer);
-                        renderer->restore();
+                        drawArtboard(renderer, artboard);
                     }
                     if (i == endIndex)
                     {
@@ -491,16 +488,62 @@ void ArtboardComponentList::draw(Renderer* renderer)
                 auto artboard = artboardInstance(i);
                 if (artboard != nullptr)
                 {
-                    renderer->save();
-                    auto transform = m_artboardTransforms[artboard];
-                    renderer->transform(transform);
-                    artboard->draw(renderer);
-                    renderer->restore();
+                    drawArtboard(renderer, artboard);
                 }
             }
         }
     }
     renderer->restore();
+    m_drawnSources.clear();
+}
+
+void ArtboardComponentList::drawArtboard(Renderer* renderer,
+                                         ArtboardInstance* artboard)
+{
+    renderer->save();
+    auto transform = m_artboardTransforms[artboard];
+    renderer->transform(transform);
+    auto source = artboard->artboardSource();
+    auto itr = m_drawnSources.find(source);
+    if (itr == m_drawnSources.end())
+    {
+        m_drawnSources[source] = artboard;
+        artboard->draw(renderer);
+    }
+    else
+    {
+        shareRenderPaths(artboard, itr->second);
+        artboard->draw(renderer);
+        for (auto path : m_sharedRenderPaths)
+        {
+            path->stopSharingRenderPath();
+        }
+        m_sharedRenderPaths.clear();
+    }
+    renderer->restore();
+}
+
+void ArtboardComponentList::shareRenderPaths(ArtboardInstance* artboard,
+                                             ArtboardInstance* source)
+{
+    auto& objects = artboard->objects();
+    auto& sourceObjects = source->objects();
+    if (objects.size() != sourceObjects.size())
+    {
+        return;
+    }
+    for (size_t i = 0; i < objects.size(); i++)
+    {
+        auto object = objects[i];
+        auto sourceObject = sourceObjects[i];
+        if (object != nullptr && sourceObject != nullptr &&
+            object->is<Shape>() &&
+            object->coreType() == sourceObject->coreType())
+        {
+            object->as<Shape>()->shareRenderPaths(sourceObject->as<Shape>(),
+                                                  m_sharedRenderPaths);
+        }
+    }
 }
 
 Core* ArtboardComponentList::hitTest(HitInfo*, const Mat2D&) { return nullptr; }
@@ -2,6 +2,7 @@
 #include "rive/artboard.hpp"
 #include "rive/factory.hpp"
 #include "rive/assets/file_asset_referencer.hpp"
+#include <cmath>
 
 using namespace rive;
 
@@ -10,9 +11,19 @@ ImageAsset::~ImageAsset()
 #if defined(__EMSCRIPTEN__)
     if (m_RenderImage != nullptr)
     {
-        m_RenderImage->delegate(nullptr);
+        m_RenderImage->removeDelegate(this);
     }
 #endif
+    releaseCachedImage();
+}
+
+void ImageAsset::releaseCachedImage()
+{
+    if (m_imageCache != nullptr)
+    {
+        m_imageCache->release(m_RenderImage.get());
+        m_imageCache = nullptr;
+    }
 }
 
 #if defined(__EMSCRIPTEN__)
@@ -30,19 +41,38 @@ bool ImageAsset::decode(SimpleArray<uint8_t>& data, Factory* factory)
 #ifdef TESTING
     decodedByteSize = data.size();
 #endif
-    renderImage(factory->decodeImage(data));
+    uint32_t targetWidth = 0;
+    uint32_t targetHeight = 0;
+    if (m_decodeScale > 0.0f && m_decodeScale < 1.0f)
+    {
+        // Sizes stored in the file are in pixels, older files may not have
+        // them in which case the image decodes at full size.
+        targetWidth = (uint32_t)std::ceil(width() * m_decodeScale);
+        targetHeight = (uint32_t)std::ceil(height() * m_decodeScale);
+    }
+    rcp<ImageCache> cache = ref_rcp(factory->imageCache());
+    renderImage(factory->decodeCachedImage(data, targetWidth, targetHeight));
+    if (m_RenderImage != nullptr)
+    {
+        m_imageCache = std::move(cache);
+    }
     return m_RenderImage != nullptr;
 }
 
 void ImageAsset::renderImage(rcp<RenderImage> renderImage)
 {
-    m_RenderImage = std::move(renderImage);
 #if defined(__EMSCRIPTEN__)
     if (m_RenderImage != nullptr)
     {
-        m_RenderImage->delegate(this);
+        m_RenderImage->removeDelegate(this);
+    }
+    if (renderImage != nullptr)
+    {
+        renderImage->addDelegate(this);
     }
 #endif
+    releaseCachedImage();
+    m_RenderImage = std::move(renderImage);
     for (auto ref : fileAssetReferencers())
     {
         ref->assetUpdated();
@@ -5,6 +5,7 @@
 #include "rive/audio/audio_engine.hpp"
 #include "rive/audio/audio_sound.hpp"
 #include "rive/audio/audio_source.hpp"
+#include "rive/audio/offline_mixer.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -94,7 +95,7 @@ static ma_node_vtable measure_levels_vtable = {LevelsNode::measureLevels,
 
 void AudioEngine::initLevelMonitor()
 {
-    if (m_levelMonitor == nullptr)
+    if (m_levelMonitor == nullptr && m_engine != nullptr)
     {
         m_levelMonitor = new LevelsNode();
         m_levelMonitor->engine = this;
@@ -149,8 +150,20 @@ float AudioEngine::level(uint32_t channel)
 }
 #endif
 
-void AudioEngine::start() { ma_engine_start(m_engine); }
-void AudioEngine::stop() { ma_engine_stop(m_engine); }
+void AudioEngine::start()
+{
+    if (m_engine != nullptr)
+    {
+        ma_engine_start(m_engine);
+    }
+}
+void AudioEngine::stop()
+{
+    if (m_engine != nullptr)
+    {
+        ma_engine_stop(m_engine);
+    }
+}
 
 rcp<AudioEngine> AudioEngine::Make(uint32_t numChannels, uint32_t sampleRate)
 {
@@ -225,12 +238,28 @@ rcp<AudioEngine> AudioEngine::Make(uint32_t numChannels, uint32_t sampleRate)
     return rcp<AudioEngine>(new AudioEngine(engine, context));
 }
 
+rcp<AudioEngine> AudioEngine::MakeOffline(uint32_t numChannels,
+                                          uint32_t sampleRate,
+                                          uint32_t maxVoices)
+{
+    return rcp<AudioEngine>(new AudioEngine(
+        new OfflineMixer(numChannels, sampleRate, maxVoices)));
+}
+
 uint32_t AudioEngine::channels() const
 {
+    if (m_offlineMixer != nullptr)
+    {
+        return m_offlineMixer->channels();
+    }
     return ma_engine_get_channels(m_engine);
 }
 uint32_t AudioEngine::sampleRate() const
 {
+    if (m_offlineMixer != nullptr)
+    {
+        return m_offlineMixer->sampleRate();
+    }
     return ma_engine_get_sample_rate(m_engine);
 }
 
@@ -238,6 +267,33 @@ AudioEngine::AudioEngine(ma_engine* engine, ma_context* context) :
     m_device(ma_engine_get_device(engine)), m_engine(engine), m_context(context)
 {}
 
+AudioEngine::AudioEngine(OfflineMixer* offlineMixer) :
+    m_device(nullptr),
+    m_engine(nullptr),
+    m_context(nullptr),
+    m_offlineMixer(offlineMixer)
+{}
+
+bool AudioEngine::playOffline(rcp<AudioSource> source,
+                              uint64_t startTime,
+                              float volume,
+                              Artboard* artboard)
+{
+    if (m_offlineMixer == nullptr)
+    {
+        return false;
+    }
+    return m_offlineMixer->play(std::move(source), startTime, volume, artboard);
+}
+
+void AudioEngine::renderFrames(float* frames, uint64_t numFrames)
+{
+    if (m_offlineMixer != nullptr)
+    {
+        m_offlineMixer->render(frames, numFrames);
+    }
+}
+
 rcp<AudioSound> AudioEngine::play(rcp<AudioSource> source,
                                   uint64_t startTime,
                                   uint64_t endTime,
@@ -249,6 +305,16 @@ rcp<AudioSound> AudioEngine::play(rcp<AudioSource> source,
         // Requested to stop sound before start.
         return nullptr;
     }
+    if (m_offlineMixer != nullptr)
+    {
+        m_offlineMixer->play(std::move(source),
+                             startTime,
+                             1.0f,
+                             artboard,
+                             soundStartTime,
+                             endTime);
+        return nullptr;
+    }
 
     std::unique_lock<std::mutex> lock(m_mutex);
     // We have to dispose completed sounds out of the completed callback. So we
@@ -392,6 +458,11 @@ size_t AudioEngine::playingSoundCount()
 
 void AudioEngine::stop(Artboard* artboard)
 {
+    if (m_offlineMixer != nullptr)
+    {
+        m_offlineMixer->stop(artboard);
+        return;
+    }
     std::unique_lock<std::mutex> lock(m_mutex);
     auto sound = m_playingSoundsHead;
     while (sound != nullptr)
@@ -426,8 +497,11 @@ AudioEngine::~AudioEngine()
     }
     m_completedSounds.clear();
 
-    ma_engine_uninit(m_engine);
-    delete m_engine;
+    if (m_engine != nullptr)
+    {
+        ma_engine_uninit(m_engine);
+        delete m_engine;
+    }
 
 #if (TARGET_IPHONE_SIMULATOR || TARGET_OS_MACCATALYST || TARGET_OS_IPHONE) &&  \
     !defined(MA_NO_DEVICE_IO)
@@ -452,6 +526,10 @@ AudioEngine::~AudioEngine()
 
 uint64_t AudioEngine::timeInFrames()
 {
+    if (m_offlineMixer != nullptr)
+    {
+        return m_offlineMixer->timeInFrames();
+    }
     return (uint64_t)ma_engine_get_time_in_pcm_frames(m_engine);
 }
 
@@ -475,6 +553,15 @@ bool AudioEngine::readAudioFrames(float* frames,
                                   uint64_t numFrames,
                                   uint64_t* framesRead)
 {
+    if (m_offlineMixer != nullptr)
+    {
+        m_offlineMixer->render(frames, numFrames);
+        if (framesRead != nullptr)
+        {
+            *framesRead = numFrames;
+        }
+        return true;
+    }
     return ma_engine_read_pcm_frames(m_engine,
                                      (void*)frames,
                                      (ma_uint64)numFrames,
@@ -489,11 +576,8 @@ bool AudioEngine::sumAudioFrames(float* frames, uint64_t numFrames)
     {
         m_readFrames.resize(count);
     }
-    ma_uint64 framesRead = 0;
-    if (ma_engine_read_pcm_frames(m_engine,
-                                  (void*)m_readFrames.data(),
-                                  (ma_uint64)numFrames,
-                                  &framesRead) != MA_SUCCESS)
+    uint64_t framesRead = 0;
+    if (!readAudioFrames(m_readFrames.data(), numFrames, &framesRead))
     {
         return false;
     }
@@ -0,0 +1,282 @@
+#ifdef WITH_RIVE_AUDIO
+#include "rive/audio/offline_mixer.hpp"
+#include "rive/math/simd.hpp"
+#include "miniaudio.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace rive;
+
+OfflineMixer::OfflineMixer(uint32_t channels,
+                           uint32_t sampleRate,
+                           uint32_t maxVoices) :
+    m_channels(channels),
+    m_sampleRate(sampleRate),
+    m_voices(maxVoices),
+    m_voiceArtboards(maxVoices, nullptr),
+    m_freeVoices(maxVoices),
+    m_plays(maxVoices)
+{
+    m_active.reserve(maxVoices);
+    for (uint32_t i = 0; i < maxVoices; i++)
+    {
+        m_freeVoices.push(i);
+    }
+}
+
+OfflineMixer::~OfflineMixer() {}
+
+// Keeps at most one idle clip per voice. Clips still playing are never
+// evicted, the least recently played idle ones go first.
+void OfflineMixer::evictClips()
+{
+    while (m_clips.size() >= m_voices.size())
+    {
+        auto oldest = m_clips.end();
+        for (auto itr = m_clips.begin(); itr != m_clips.end(); ++itr)
+        {
+            if (itr->second->voiceCount.load(std::memory_order_acquire) == 0 &&
+                (oldest == m_clips.end() ||
+                 itr->second->lastPlayed < oldest->second->lastPlayed))
+            {
+                oldest = itr;
+            }
+        }
+        if (oldest == m_clips.end())
+        {
+            return;
+        }
+        m_clips.erase(oldest);
+    }
+}
+
+OfflineMixer::Clip* OfflineMixer::clip(const rcp<AudioSource>& source)
+{
+    auto itr = m_clips.find(source.get());
+    if (itr != m_clips.end())
+    {
+        itr->second->lastPlayed = ++m_playCount;
+        return itr->second.get();
+    }
+
+    std::unique_ptr<Clip> clip(new Clip());
+    clip->source = source;
+    clip->lastPlayed = ++m_playCount;
+    if (source->isBuffered())
+    {
+        Span<float> samples = source->bufferedSamples();
+        uint32_t sourceChannels = source->channels();
+        uint32_t sourceSampleRate = source->sampleRate();
+        ma_uint64 sourceFrames = samples.size() / sourceChannels;
+        if (sourceChannels == m_channels && sourceSampleRate == m_sampleRate)
+        {
+            clip->samples.assign(samples.begin(),
+                                 samples.begin() + sourceFrames * m_channels);
+        }
+        else
+        {
+            // Passing null output returns the converted frame count.
+            ma_uint64 frameCount = ma_convert_frames(nullptr,
+                                                     0,
+                                                     ma_format_f32,
+                                                     m_channels,
+                                                     m_sampleRate,
+                                                     samples.data(),
+                                                     sourceFrames,
+                                                     ma_format_f32,
+                                                     sourceChannels,
+                                                     sourceSampleRate);
+            clip->samples.resize(frameCount * m_channels);
+            frameCount = ma_convert_frames(clip->samples.data(),
+                                           frameCount,
+                                           ma_format_f32,
+                                           m_channels,
+                                           m_sampleRate,
+                                           samples.data(),
+                                           sourceFrames,
+                                           ma_format_f32,
+                                           sourceChannels,
+                                           sourceSampleRate);
+            clip->samples.resize(frameCount * m_channels);
+        }
+    }
+    else
+    {
+        ma_decoder decoder;
+        ma_decoder_config config =
+            ma_decoder_config_init(ma_format_f32, m_channels, m_sampleRate);
+        auto bytes = source->bytes();
+        if (ma_decoder_init_memory(bytes.data(),
+                                   bytes.size(),
+                                   &config,
+                                   &decoder) != MA_SUCCESS)
+        {
+            fprintf(stderr,
+                    "OfflineMixer::clip - Failed to initialize decoder.\n");
+            return nullptr;
+        }
+        // Not every format knows its length up front, so read in chunks.
+        const ma_uint64 chunkFrames = 4096;
+        for (;;)
+        {
+            size_t offset = clip->samples.size();
+            clip->samples.resize(offset + chunkFrames * m_channels);
+            ma_uint64 framesRead = 0;
+            ma_decoder_read_pcm_frames(&decoder,
+                                       clip->samples.data() + offset,
+                                       chunkFrames,
+                                       &framesRead);
+            clip->samples.resize(offset + framesRead * m_channels);
+            if (framesRead < chunkFrames)
+            {
+                break;
+            }
+        }
+        ma_decoder_uninit(&decoder);
+        clip->samples.shrink_to_fit();
+    }
+    clip->frameCount = clip->samples.size() / m_channels;
+
+    evictClips();
+    Clip* result = clip.get();
+    m_clips[source.get()] = std::move(clip);
+    return result;
+}
+
+bool OfflineMixer::play(rcp<AudioSource> source,
+                        uint64_t startTime,
+                        float volume,
+                        const Artboard* artboard,
+                        uint64_t soundStartTime,
+                        uint64_t endTime)
+{
+    Clip* sourceClip = clip(source);
+    if (sourceClip == nullptr)
+    {
+        return false;
+    }
+    uint64_t endFrame = sourceClip->frameCount;
+    if (endTime != 0)
+    {
+        if (endTime <= startTime)
+        {
+            return false;
+        }
+        endFrame = std::min(endFrame, soundStartTime + endTime - startTime);
+    }
+    if (soundStartTime >= endFrame)
+    {
+        return false;
+    }
+    uint32_t index;
+    if (!m_freeVoices.pop(index))
+    {
+        return false;
+    }
+    Voice& voice = m_voices[index];
+    voice.clip = sourceClip;
+    voice.startTime = startTime;
+    voice.cursor = soundStartTime;
+    voice.endFrame = endFrame;
+    voice.volume = volume;
+    voice.stopped.store(false, std::memory_order_relaxed);
+    sourceClip->voiceCount.fetch_add(1, std::memory_order_relaxed);
+    m_voiceArtboards[index] = artboard;
+    // Can't fail, there are never more plays in flight than voices.
+    m_plays.push(index);
+    return true;
+}
+
+void OfflineMixer::stop(const Artboard* artboard)
+{
+    // Voices that already finished get flagged too, which is harmless: play
+    // clears the flag before handing a voice back to the rendering thread.
+    for (size_t i = 0; i < m_voices.size(); i++)
+    {
+        if (m_voiceArtboards[i] == artboard)
+        {
+            m_voices[i].stopped.store(true, std::memory_order_release);
+        }
+    }
+}
+
+void OfflineMixer::receivePlays()
+{
+    uint32_t index;
+    while (m_plays.pop(index))
+    {
+        m_active.push_back(index);
+    }
+}
+
+void OfflineMixer::release(size_t activeIndex)
+{
+    Voice& voice = m_voices[m_active[activeIndex]];
+    voice.clip->voiceCount.fetch_sub(1, std::memory_order_release);
+    m_freeVoices.push(m_active[activeIndex]);
+    m_active[activeIndex] = m_active.back();
+    m_active.pop_back();
+}
+
+void OfflineMixer::render(float* frames, uint64_t numFrames)
+{
+    receivePlays();
+    for (size_t i = 0; i < m_active.size();)
+    {
+        if (m_voices[m_active[i]].stopped.load(std::memory_order_acquire))
+        {
+            release(i);
+        }
+        else
+        {
+            i++;
+        }
+    }
+
+    memset(frames, 0, numFrames * m_channels * sizeof(float));
+    uint64_t blockStart = m_frame.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < m_active.size();)
+    {
+        Voice& voice = m_voices[m_active[i]];
+        // Sounds played for a time that already passed start right away.
+        uint64_t offset =
+            voice.startTime > blockStart ? voice.startTime - blockStart : 0;
+        if (offset >= numFrames)
+        {
+            i++;
+            continue;
+        }
+        uint64_t count =
+            std::min(numFrames - offset, voice.endFrame - voice.cursor);
+
+        const float* src =
+            voice.clip->samples.data() + voice.cursor * m_channels;
+        float* dst = frames + offset * m_channels;
+        size_t sampleCount = (size_t)count * m_channels;
+        const size_t alignedCount = sampleCount - sampleCount % 4;
+        float4 volume = float4(voice.volume);
+        for (size_t s = 0; s < alignedCount; s += 4)
+        {
+            simd::store(dst + s,
+                        simd::load4f(dst + s) + simd::load4f(src + s) * volume);
+        }
+        for (size_t s = alignedCount; s < sampleCount; s++)
+        {
+            dst[s] += src[s] * voice.volume;
+        }
+
+        voice.cursor += count;
+        if (voice.cursor == voice.endFrame)
+        {
+            release(i);
+        }
+        else
+        {
+            i++;
+        }
+    }
+    m_frame.store(blockStart + numFrames, std::memory_order_release);
+}
+
+#endif
@@ -32,10 +32,19 @@ void AudioEvent::play()
 #endif
                                              AudioEngine::RuntimeEngine();
 
+    if (engine->isOffline())
+    {
+        engine->playOffline(audioSource,
+                            engine->timeInFrames(),
+                            volume,
+                            artboard());
+        return;
+    }
+
     auto sound =
         engine->play(audioSource, engine->timeInFrames(), 0, 0, artboard());
 
-    if (volume != 1.0f)
+    if (sound != nullptr && volume != 1.0f)
     {
         sound->volume(volume);
     }
@@ -10,6 +10,8 @@
 #include "rive/assets/font_asset.hpp"
 #include "rive/viewmodel/runtime/viewmodel_runtime.hpp"
 #include "rive/animation/state_machine_instance.hpp"
+#include <atomic>
+#include <deque>
 
 namespace rive
 {
@@ -133,6 +135,101 @@ public:
     void removeAudioSource(std::string name) { m_audioAssets.erase(name); }
     void removeFont(std::string name) { m_fontAssets.erase(name); }
 
+    // Loads assets for a file imported on an import thread. Import threads
+    // can't look handles up on the server, so it has a copy of the global
+    // assets as they were when the file was queued for import. They can't
+    // use the server's factory either, so in-band assets are only copied
+    // during the import and decoded on the server by decodeInBandAssets().
+    class Snapshot : public FileAssetLoader
+    {
+    public:
+        bool loadContents(FileAsset& asset,
+                          Span<const uint8_t> inBandBytes,
+                          Factory* factory) override
+        {
+            if (asset.is<ImageAsset>())
+            {
+                auto itr = images.find(asset.uniqueName());
+                if (itr != images.end() && itr->second != nullptr)
+                {
+                    asset.as<ImageAsset>()->renderImage(itr->second);
+                    return true;
+                }
+            }
+            else if (asset.is<AudioAsset>())
+            {
+                auto itr = audioSources.find(asset.uniqueName());
+                if (itr != audioSources.end() && itr->second != nullptr)
+                {
+                    asset.as<AudioAsset>()->audioSource(itr->second);
+                    return true;
+                }
+            }
+            else if (asset.is<FontAsset>())
+            {
+                auto itr = fonts.find(asset.uniqueName());
+                if (itr != fonts.end() && itr->second != nullptr)
+                {
+                    asset.as<FontAsset>()->font(itr->second);
+                    return true;
+                }
+            }
+            if (inBandBytes.empty())
+            {
+                return false;
+            }
+            m_inBandAssets.push_back(
+                {ref_rcp(&asset),
+                 SimpleArray<uint8_t>(inBandBytes.data(),
+                                      inBandBytes.size())});
+            return true;
+        }
+
+        // Server thread only. Decodes the in-band assets copied during the
+        // import, the same way File would have on the server thread.
+        void decodeInBandAssets(Factory* factory)
+        {
+            for (auto& inBandAsset : m_inBandAssets)
+            {
+                inBandAsset.asset->decode(inBandAsset.bytes, factory);
+            }
+            m_inBandAssets.clear();
+        }
+
+        std::unordered_map<std::string, rcp<RenderImage>> images;
+        std::unordered_map<std::string, rcp<AudioSource>> audioSources;
+        std::unordered_map<std::string, rcp<Font>> fonts;
+
+    private:
+        struct InBandAsset
+        {
+            rcp<FileAsset> asset;
+            SimpleArray<uint8_t> bytes;
+        };
+        std::vector<InBandAsset> m_inBandAssets;
+    };
+
+    rcp<Snapshot> snapshot() const
+    {
+        auto snapshot = make_rcp<Snapshot>();
+        for (const auto& pair : m_imageAssets)
+        {
+            snapshot->images[pair.first] =
+                ref_rcp(m_server->getImage(pair.second));
+        }
+        for (const auto& pair : m_audioAssets)
+        {
+            snapshot->audioSources[pair.first] =
+                ref_rcp(m_server->getAudioSource(pair.second));
+        }
+        for (const auto& pair : m_fontAssets)
+        {
+            snapshot->fonts[pair.first] =
+                ref_rcp(m_server->getFont(pair.second));
+        }
+        return snapshot;
+    }
+
 #ifdef TESTING
     RenderImageHandle testing_imageNamed(std::string name)
     {
@@ -167,6 +264,280 @@ private:
     std::unordered_map<std::string, FontHandle> m_fontAssets;
 };
 
+namespace
+{
+// Stands in for the server's factory on the import threads. Importing makes
+// render objects for the source artboards, which are never drawn, so these
+// just have to accept whatever is set on them.
+class ImportFactory : public Factory
+{
+    class Buffer : public LITE_RTTI_OVERRIDE(RenderBuffer, Buffer)
+    {
+    public:
+        Buffer(RenderBufferType type,
+               RenderBufferFlags flags,
+               size_t sizeInBytes) :
+            LITE_RTTI_OVERRIDE(RenderBuffer, Buffer)(type, flags, sizeInBytes),
+            m_storage(sizeInBytes)
+        {}
+
+    private:
+        void* onMap() override { return m_storage.data(); }
+        void onUnmap() override {}
+
+        std::vector<uint8_t> m_storage;
+    };
+
+    class Shader : public LITE_RTTI_OVERRIDE(RenderShader, Shader)
+    {};
+
+    class Paint : public LITE_RTTI_OVERRIDE(RenderPaint, Paint)
+    {
+    public:
+        void style(RenderPaintStyle) override {}
+        void color(ColorInt) override {}
+        void thickness(float) override {}
+        void join(StrokeJoin) override {}
+        void cap(StrokeCap) override {}
+        void blendMode(BlendMode) override {}
+        void shader(rcp<RenderShader>) override {}
+        void invalidateStroke() override {}
+    };
+
+    class Path : public LITE_RTTI_OVERRIDE(RenderPath, Path)
+    {
+    public:
+        void rewind() override {}
+        void fillRule(FillRule) override {}
+        void addRenderPath(RenderPath*, const Mat2D&) override {}
+        void addRawPath(const RawPath&) override {}
+        void moveTo(float, float) override {}
+        void lineTo(float, float) override {}
+        void cubicTo(float, float, float, float, float, float) override {}
+        void close() override {}
+    };
+
+public:
+    rcp<RenderBuffer> makeRenderBuffer(RenderBufferType type,
+                                       RenderBufferFlags flags,
+                                       size_t sizeInBytes) override
+    {
+        return make_rcp<Buffer>(type, flags, sizeInBytes);
+    }
+
+    rcp<RenderShader> makeLinearGradient(float,
+                                         float,
+                                         float,
+                                         float,
+                                         const ColorInt[],
+                                         const float[],
+                                         size_t) override
+    {
+        return make_rcp<Shader>();
+    }
+
+    rcp<RenderShader> makeRadialGradient(float,
+                                         float,
+                                         float,
+                                         const ColorInt[],
+                                         const float[],
+                                         size_t) override
+    {
+        return make_rcp<Shader>();
+    }
+
+    rcp<RenderPath> makeRenderPath(RawPath&, FillRule) override
+    {
+        return make_rcp<Path>();
+    }
+
+    rcp<RenderPath> makeEmptyRenderPath() override { return make_rcp<Path>(); }
+
+    rcp<RenderPaint> makeRenderPaint() override { return make_rcp<Paint>(); }
+
+    // In-band assets are decoded on the server, see
+    // CommandFileAssetLoader::Snapshot.
+    rcp<RenderImage> decodeImage(Span<const uint8_t>) override
+    {
+        return nullptr;
+    }
+};
+} // namespace
+
+// Runs File::import for loadFile commands on a pool of threads. Imports are
+// handed back to the server thread, which is the only one that installs them.
+// The server's factory is only safe to use on the server thread, so files are
+// imported with an ImportFactory instead. They're switched over to the
+// server's factory, and their in-band assets are decoded, when installed.
+class CommandServer::FileImporter
+{
+public:
+    using AssetSnapshot = CommandFileAssetLoader::Snapshot;
+
+    struct Import
+    {
+        FileHandle handle;
+        uint64_t requestId;
+        std::vector<uint8_t> rivBytes;
+        rcp<AssetSnapshot> assetLoader;
+        rcp<File> file;
+        bool done = false;
+
+        // Server thread only. Moves the file over to the server's factory,
+        // decodes its in-band assets and hands it over for installing.
+        rcp<File> finish(Factory* factory)
+        {
+            if (file != nullptr)
+            {
+                file->factory(factory);
+                assetLoader->decodeInBandAssets(factory);
+            }
+            assetLoader = nullptr;
+            return std::move(file);
+        }
+    };
+
+    FileImporter(uint32_t threadCount,
+                 std::function<void()> onImportFinished) :
+        m_onImportFinished(std::move(onImportFinished))
+    {
+        for (uint32_t i = 0; i < threadCount; ++i)
+        {
+            m_threads.emplace_back(&FileImporter::importLoop, this);
+        }
+    }
+
+    ~FileImporter()
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_exiting = true;
+        }
+        m_queueConditionVariable.notify_all();
+        for (auto& thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    // Server thread only.
+    void import(FileHandle handle,
+                uint64_t requestId,
+                std::vector<uint8_t> rivBytes,
+                rcp<AssetSnapshot> assetLoader)
+    {
+        auto import = std::make_shared<Import>();
+        import->handle = handle;
+        import->requestId = requestId;
+        import->rivBytes = std::move(rivBytes);
+        import->assetLoader = std::move(assetLoader);
+        m_pending.push_back(import);
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_queue.push_back(std::move(import));
+        }
+        m_queueConditionVariable.notify_one();
+    }
+
+    // Checked by the server while it waits for commands, so it doesn't need
+    // the lock.
+    bool hasFinishedImports() const { return m_finishedCount > 0; }
+
+    // Server thread only. Removes and returns every finished import.
+    std::vector<std::shared_ptr<Import>> takeFinished()
+    {
+        std::vector<std::shared_ptr<Import>> finished;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (auto itr = m_pending.begin(); itr != m_pending.end();)
+        {
+            if ((*itr)->done)
+            {
+                finished.push_back(std::move(*itr));
+                itr = m_pending.erase(itr);
+            }
+            else
+            {
+                ++itr;
+            }
+        }
+        m_finishedCount -= static_cast<uint32_t>(finished.size());
+        return finished;
+    }
+
+    // Server thread only. Waits for the handle's import if it's pending and
+    // returns it, or null if it isn't pending.
+    std::shared_ptr<Import> wait(FileHandle handle)
+    {
+        auto itr = std::find_if(m_pending.begin(),
+                                m_pending.end(),
+                                [handle](const std::shared_ptr<Import>& i) {
+                                    return i->handle == handle;
+                                });
+        if (itr == m_pending.end())
+        {
+            return nullptr;
+        }
+        std::shared_ptr<Import> import = std::move(*itr);
+        m_pending.erase(itr);
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_doneConditionVariable.wait(lock, [&import] { return import->done; });
+        m_finishedCount--;
+        return import;
+    }
+
+    bool hasPendingImports() const { return !m_pending.empty(); }
+    FileHandle oldestPendingHandle() const { return m_pending.front()->handle; }
+
+private:
+    void importLoop()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (;;)
+        {
+            m_queueConditionVariable.wait(lock, [this] {
+                return m_exiting || !m_queue.empty();
+            });
+            if (m_exiting)
+            {
+                return;
+            }
+            std::shared_ptr<Import> import = std::move(m_queue.front());
+            m_queue.pop_front();
+            lock.unlock();
+
+            rcp<File> file = File::import(import->rivBytes,
+                                          &m_importFactory,
+                                          nullptr,
+                                          import->assetLoader);
+
+            lock.lock();
+            import->file = std::move(file);
+            import->rivBytes = {};
+            import->done = true;
+            m_finishedCount++;
+            m_doneConditionVariable.notify_all();
+            lock.unlock();
+            m_onImportFinished();
+            lock.lock();
+        }
+    }
+
+    ImportFactory m_importFactory;
+    const std::function<void()> m_onImportFinished;
+    std::vector<std::thread> m_threads;
+
+    std::mutex m_mutex;
+    std::condition_variable m_queueConditionVariable;
+    std::condition_variable m_doneConditionVariable;
+    std::deque<std::shared_ptr<Import>> m_queue;
+    std::atomic<uint32_t> m_finishedCount{0};
+    bool m_exiting = false;
+
+    // Imports that haven't been installed yet, in the order they were
+    // requested. Only touched by the server thread.
+    std::vector<std::shared_ptr<Import>> m_pending;
+};
+
 std::ostream& operator<<(std::ostream& os, DataType t)
 {
     switch (t)
@@ -249,16 +620,108 @@ bool CommandServer::testing_globalFontContains(std::string name)
 #endif
 
 CommandServer::CommandServer(rcp<CommandQueue> commandBuffer,
-                             Factory* factory) :
+                             Factory* factory,
+                             uint32_t importThreadCount) :
     m_commandQueue(std::move(commandBuffer)),
     m_factory(factory),
 #ifndef NDEBUG
     m_threadID(std::this_thread::get_id()),
 #endif
     m_fileAssetLoader(make_rcp<CommandFileAssetLoader>(this))
-{}
+{
+    if (importThreadCount > 0)
+    {
+        CommandQueue* commandQueue = m_commandQueue.get();
+        m_fileImporter = std::unique_ptr<FileImporter>(
+            new FileImporter(importThreadCount, [commandQueue]() {
+                // Wake the server if it's waiting for commands so it can
+                // install the file. Taking the mutex first makes sure the
+                // server is either still checking for work or already
+                // waiting.
+                {
+                    std::unique_lock<std::mutex> lock(
+                        commandQueue->m_commandMutex);
+                }
+                commandQueue->m_commandConditionVariable.notify_one();
+            }));
+    }
+}
 
-CommandServer::~CommandServer() {}
+CommandServer::~CommandServer()
+{
+    // Stop the import threads before releasing anything their imports may
+    // still reference.
+    m_fileImporter = nullptr;
+    for (RenderImageHandle handle : m_cachedImages)
+    {
+        m_factory->releaseCachedImage(m_images[handle].get());
+    }
+}
+
+void CommandServer::installFile(FileHandle handle,
+                                uint64_t requestId,
+                                rcp<File> file)
+{
+    if (file != nullptr)
+    {
+        m_fileDependencies[handle] = {};
+        m_files[handle] = std::move(file);
+
+        std::unique_lock<std::mutex> messageLock(
+            m_commandQueue->m_messageMutex);
+        m_commandQueue->m_messageStream << CommandQueue::Message::fileLoaded;
+        m_commandQueue->m_messageStream << handle;
+        m_commandQueue->m_messageStream << requestId;
+    }
+    else
+    {
+        ErrorReporter<FileHandle>(this,
+                                  handle,
+                                  requestId,
+                                  CommandQueue::Message::fileError)
+            << "failed to load Rive file.";
+    }
+}
+
+void CommandServer::installFinishedImports()
+{
+    if (m_fileImporter == nullptr)
+    {
+        return;
+    }
+    for (auto& import : m_fileImporter->takeFinished())
+    {
+        installFile(import->handle,
+                    import->requestId,
+                    import->finish(m_factory));
+    }
+}
+
+File* CommandServer::waitForFile(FileHandle handle)
+{
+    if (m_fileImporter != nullptr)
+    {
+        if (auto import = m_fileImporter->wait(handle))
+        {
+            installFile(import->handle,
+                        import->requestId,
+                        import->finish(m_factory));
+        }
+    }
+    return getFile(handle);
+}
+
+void CommandServer::waitForAllFiles()
+{
+    if (m_fileImporter == nullptr)
+    {
+        return;
+    }
+    while (m_fileImporter->hasPendingImports())
+    {
+        waitForFile(m_fileImporter->oldestPendingHandle());
+    }
+}
 
 File* CommandServer::getFile(FileHandle handle) const
 {
@@ -462,7 +925,9 @@ bool CommandServer::waitCommands()
     if (commandStream.empty())
     {
         std::unique_lock<std::mutex> lock(m_commandQueue->m_commandMutex);
-        while (commandStream.empty())
+        while (commandStream.empty() &&
+               (m_fileImporter == nullptr ||
+                !m_fileImporter->hasFinishedImports()))
         {
             assert(m_commandQueue->m_callbacks.empty());
             assert(m_commandQueue->m_byteVectors.empty());
@@ -481,6 +946,9 @@ bool CommandServer::processCommands()
 
     PODStream& commandStream = m_commandQueue->m_commandStream;
     PODStream& messageStream = m_commandQueue->m_messageStream;
+
+    installFinishedImports();
+
     std::unique_lock<std::mutex> lock(m_commandQueue->m_commandMutex);
 
     // Early out if we don't have anything to process.
@@ -512,29 +980,20 @@ bool CommandServer::processCommands()
                 commandStream >> requestId;
                 m_commandQueue->m_byteVectors >> rivBytes;
                 lock.unlock();
-                rcp<rive::File> file = rive::File::import(rivBytes,
-                                                          m_factory,
-                                                          nullptr,
-                                                          m_fileAssetLoader);
-                if (file != nullptr)
+                if (m_fileImporter != nullptr)
                 {
-                    m_fileDependencies[handle] = {};
-                    m_files[handle] = std::move(file);
-
-                    std::unique_lock<std::mutex> messageLock(
-                        m_commandQueue->m_messageMutex);
-                    messageStream << CommandQueue::Message::fileLoaded;
-                    messageStream << handle;
-                    messageStream << requestId;
-                }
-                else
-                {
-                    ErrorReporter<FileHandle>(this,
-                                              handle,
-                                              requestId,
-                                              CommandQueue::Message::fileError)
-                        << "failed to load Rive file.";
+                    m_fileImporter->import(handle,
+                                           requestId,
+                                           std::move(rivBytes),
+                                           m_fileAssetLoader->snapshot());
+                    break;
                 }
+                installFile(handle,
+                            requestId,
+                            rive::File::import(rivBytes,
+                                               m_factory,
+                                               nullptr,
+                                               m_fileAssetLoader));
                 break;
             }
 
@@ -545,6 +1004,8 @@ bool CommandServer::processCommands()
                 commandStream >> handle;
                 commandStream >> requestId;
                 lock.unlock();
+                // Report the load before the delete.
+                waitForFile(handle);
                 m_files.erase(handle);
                 auto itr = m_fileDependencies.find(handle);
                 if (itr != m_fileDependencies.end())
@@ -575,10 +1036,11 @@ bool CommandServer::processCommands()
                 m_commandQueue->m_byteVectors >> bytes;
                 lock.unlock();
 
-                auto image = factory()->decodeImage(bytes);
+                auto image = factory()->decodeCachedImage(bytes);
                 if (image)
                 {
                     m_images[handle] = std::move(image);
+                    m_cachedImages.insert(handle);
                     std::unique_lock<std::mutex> messageLock(
                         m_commandQueue->m_messageMutex);
                     messageStream << CommandQueue::Message::imageDecoded;
@@ -637,6 +1099,10 @@ bool CommandServer::processCommands()
                 commandStream >> handle;
                 commandStream >> requestId;
                 lock.unlock();
+                if (m_cachedImages.erase(handle))
+                {
+                    factory()->releaseCachedImage(m_images[handle].get());
+                }
                 m_images.erase(handle);
                 m_fileAssetLoader->removeRenderImage(handle);
                 std::unique_lock<std::mutex> messageLock(
@@ -820,7 +1286,7 @@ bool CommandServer::processCommands()
                 commandStream >> requestId;
                 m_commandQueue->m_names >> name;
                 lock.unlock();
-                if (rive::File* file = getFile(fileHandle))
+                if (rive::File* file = waitForFile(fileHandle))
                 {
                     if (auto artboard = name.empty()
                                             ? file->artboardDefault()
@@ -904,7 +1370,7 @@ bool CommandServer::processCommands()
                     m_commandQueue->m_names >> viewModelInstanceName;
                 }
                 lock.unlock();
-                if (auto file = getFile(fileHandle))
+                if (auto file = waitForFile(fileHandle))
                 {
                     ViewModelRuntime* viewModel = nullptr;
 
@@ -1574,6 +2040,8 @@ bool CommandServer::processCommands()
                 CommandServerCallback callback;
                 m_commandQueue->m_callbacks >> callback;
                 lock.unlock();
+                // The callback may look at any file.
+                waitForAllFiles();
                 callback(this);
                 break;
             }
@@ -1603,7 +2071,7 @@ bool CommandServer::processCommands()
                 commandStream >> handle;
                 commandStream >> requestId;
                 lock.unlock();
-                auto file = getFile(handle);
+                auto file = waitForFile(handle);
                 if (file)
                 {
                     auto artboards = file->artboards();
@@ -1639,7 +2107,7 @@ bool CommandServer::processCommands()
                 commandStream >> handle;
                 commandStream >> requestId;
                 lock.unlock();
-                auto file = getFile(handle);
+                auto file = waitForFile(handle);
                 if (file)
                 {
                     auto enums = file->enums();
@@ -1733,7 +2201,7 @@ bool CommandServer::processCommands()
                 auto artboard = getArtboardInstance(artboardHandle);
                 if (artboard)
                 {
-                    auto file = getFile(fileHandle);
+                    auto file = waitForFile(fileHandle);
                     if (file)
                     {
                         auto defaultViewModel =
@@ -1812,7 +2280,7 @@ bool CommandServer::processCommands()
                 commandStream >> handle;
                 commandStream >> requestId;
                 lock.unlock();
-                auto file = getFile(handle);
+                auto file = waitForFile(handle);
                 if (file)
                 {
                     auto numViewModels = file->viewModelCount();
@@ -1850,7 +2318,7 @@ bool CommandServer::processCommands()
                 commandStream >> requestId;
                 m_commandQueue->m_names >> viewModelName;
                 lock.unlock();
-                auto file = getFile(handle);
+                auto file = waitForFile(handle);
                 if (file)
                 {
                     auto model = file->viewModelByName(viewModelName);
@@ -1905,7 +2373,7 @@ bool CommandServer::processCommands()
                 commandStream >> requestId;
                 m_commandQueue->m_names >> viewModelName;
                 lock.unlock();
-                auto file = getFile(handle);
+                auto file = waitForFile(handle);
                 if (file)
                 {
                     auto model = file->viewModelByName(viewModelName);
@@ -18,49 +18,58 @@ using namespace rive;
 void FollowPathConstraint::distanceChanged() { markConstraintDirty(); }
 void FollowPathConstraint::orientChanged() { markConstraintDirty(); }
 
+bool FollowPathConstraint::followsPath() const
+{
+    return m_Target->is<Shape>() || m_Target->is<Path>();
+}
+
 const Mat2D FollowPathConstraint::targetTransform(float distanceOffset) const
 {
-    if (m_Target->is<Shape>() || m_Target->is<Path>())
+    if (followsPath())
+    {
+        return targetTransform(m_pathMeasure.atPercentage(distanceOffset));
+    }
+    else
     {
-        auto result = m_pathMeasure.atPercentage(distanceOffset);
-        Vec2D position = result.pos;
-        Mat2D transformB = Mat2D(m_Target->worldTransform());
+        return m_Target->worldTransform();
+    }
+}
+
+const Mat2D FollowPathConstraint::targetTransform(
+    const ContourMeasure::PosTanDistance& result) const
+{
+    Vec2D position = result.pos;
+    Mat2D transformB = Mat2D(m_Target->worldTransform());
 
-        if (orient())
+    if (orient())
+    {
+        auto componentsB = transformB.decompose();
+        auto tangentRotation = std::atan2(result.tan.y, result.tan.x);
+        float angleB = std::fmod(componentsB.rotation(), math::PI * 2);
+        float diff = tangentRotation - angleB;
+        if (diff > math::PI)
         {
-            auto componentsB = transformB.decompose();
-            auto tangentRotation = std::atan2(result.tan.y, result.tan.x);
-            float angleB = std::fmod(componentsB.rotation(), math::PI * 2);
-            float diff = tangentRotation - angleB;
-            if (diff > math::PI)
-            {
-                diff -= math::PI * 2;
-            }
-            else if (diff < -math::PI)
-            {
-                diff += math::PI * 2;
-            }
-            transformB = Mat2D::fromRotation(angleB + diff * strength());
+            diff -= math::PI * 2;
         }
-        Vec2D offsetPosition = Vec2D();
-        if (offset())
+        else if (diff < -math::PI)
         {
-            if (parent()->is<TransformComponent>())
-            {
-                Mat2D components =
-                    parent()->as<TransformComponent>()->transform();
-                offsetPosition.x = components[4];
-                offsetPosition.y = components[5];
-            }
+            diff += math::PI * 2;
         }
-        transformB[4] = position.x + offsetPosition.x;
-        transformB[5] = position.y + offsetPosition.y;
-        return transformB;
+        transformB = Mat2D::fromRotation(angleB + diff * strength());
     }
-    else
+    Vec2D offsetPosition = Vec2D();
+    if (offset())
     {
-        return m_Target->worldTransform();
+        if (parent()->is<TransformComponent>())
+        {
+            Mat2D components = parent()->as<TransformComponent>()->transform();
+            offsetPosition.x = components[4];
+            offsetPosition.y = components[5];
+        }
     }
+    transformB[4] = position.x + offsetPosition.x;
+    transformB[5] = position.y + offsetPosition.y;
+    return transformB;
 }
 
 void FollowPathConstraint::constrain(TransformComponent* component)
@@ -21,13 +21,38 @@ void ListFollowPathConstraint::constrainList(ConstrainableList* list)
     float startToEndDistance = distanceEnd() - distance();
     float offsetDistance =
         count <= 1 ? 0 : startToEndDistance / ((float)count - 1);
+
+    // Items are evenly spaced along the path, so measure all of them in a
+    // single sweep instead of searching the path for each one.
+    bool batched =
+        m_Target != nullptr && !m_Target->isCollapsed() && followsPath();
+    if (batched)
+    {
+        m_itemOffsets.resize(count);
+        m_itemResults.resize(count);
+        for (int i = 0; i < count; i++)
+        {
+            m_itemOffsets[i] = startOffset + i * offsetDistance;
+        }
+        m_pathMeasure.atPercentages(m_itemOffsets, m_itemResults.data());
+    }
     for (int i = 0; i < count; i++)
     {
         auto transform = transforms[i];
-        auto transformComponents =
-            constrainAtOffset(*transform,
-                              listTransform,
-                              startOffset + i * offsetDistance);
+        TransformComponents transformComponents;
+        if (batched)
+        {
+            Mat2D transformB(targetTransform(m_itemResults[i]));
+            transformComponents =
+                constrainHelper(*transform, transformB, listTransform);
+        }
+        else
+        {
+            transformComponents =
+                constrainAtOffset(*transform,
+                                  listTransform,
+                                  startOffset + i * offsetDistance);
+        }
         auto transformB = Mat2D::compose(transformComponents);
         transform->xx(transformB.xx());
         transform->xy(transformB.xy());
@@ -31,8 +31,18 @@ void DataBindContext::bindFromContext(DataContext* dataContext)
 {
     if (dataContext != nullptr)
     {
-        auto vmSource =
-            dataContext->getViewModelProperty(m_SourcePathIdsBuffer);
+        auto version = dataContext->version();
+        if (dataContext != m_resolvedContext || version != m_resolvedVersion)
+        {
+            m_resolvedContext = dataContext;
+            m_resolvedVersion = version;
+            m_resolvedSource =
+                dataContext->getViewModelProperty(m_SourcePathIdsBuffer);
+#ifdef TESTING
+            sourcePathResolutions++;
+#endif
+        }
+        auto vmSource = m_resolvedSource;
         if (vmSource != m_Source)
         {
             if (vmSource != nullptr)
@@ -1,21 +1,42 @@
 #include "rive/data_bind/data_context.hpp"
 #include "rive/viewmodel/viewmodel_instance_viewmodel.hpp"
+#include <algorithm>
 
 using namespace rive;
 
+std::atomic<uint32_t> DataContext::sm_nextStamp(0);
+std::atomic<uint32_t> DataContext::sm_referencesStamp(0);
+
 DataContext::DataContext(rcp<ViewModelInstance> viewModelInstance) :
-    m_ViewModelInstance(viewModelInstance)
+    m_ViewModelInstance(viewModelInstance), m_stamp(nextStamp())
 {}
 
+uint32_t DataContext::version() const
+{
+    // Stamps only grow, so the newest stamp in the chain changes whenever
+    // any link of it does.
+    uint32_t version = std::max(m_stamp, sm_referencesStamp.load());
+    for (auto context = m_Parent; context != nullptr;
+         context = context->m_Parent)
+    {
+        version = std::max(version, context->m_stamp);
+    }
+    return version;
+}
+
 void DataContext::viewModelInstance(rcp<ViewModelInstance> value)
 {
-    m_ViewModelInstance = value;
+    if (m_ViewModelInstance != value)
+    {
+        m_ViewModelInstance = value;
+        m_stamp = nextStamp();
+    }
 }
 
 void DataContext::advanced() { m_ViewModelInstance->advanced(); }
 
 ViewModelInstanceValue* DataContext::getViewModelProperty(
-    const std::vector<uint32_t> path) const
+    const std::vector<uint32_t>& path) const
 {
     std::vector<uint32_t>::const_iterator it;
     if (path.size() == 0)
@@ -53,7 +74,7 @@ skip_path:
 }
 
 rcp<ViewModelInstance> DataContext::getViewModelInstance(
-    const std::vector<uint32_t> path) const
+    const std::vector<uint32_t>& path) const
 {
     std::vector<uint32_t>::const_iterator it;
     if (path.size() == 0)
@@ -12,6 +12,29 @@
 
 using namespace rive;
 
+rcp<RenderShader> Factory::updateLinearGradient(rcp<RenderShader>,
+                                                float sx,
+                                                float sy,
+                                                float ex,
+                                                float ey,
+                                                const ColorInt colors[],
+                                                const float stops[],
+                                                size_t count)
+{
+    return makeLinearGradient(sx, sy, ex, ey, colors, stops, count);
+}
+
+rcp<RenderShader> Factory::updateRadialGradient(rcp<RenderShader>,
+                                                float cx,
+                                                float cy,
+                                                float radius,
+                                                const ColorInt colors[],
+                                                const float stops[],
+                                                size_t count)
+{
+    return makeRadialGradient(cx, cy, radius, colors, stops, count);
+}
+
 rcp<RenderPath> Factory::makeRenderPath(const AABB& r)
 {
     RawPath rawPath;
@@ -19,6 +42,25 @@ rcp<RenderPath> Factory::makeRenderPath(const AABB& r)
     return makeRenderPath(rawPath, FillRule::nonZero);
 }
 
+rcp<RenderImage> Factory::decodeCachedImage(Span<const uint8_t> span,
+                                            uint32_t targetWidth,
+                                            uint32_t targetHeight)
+{
+    if (m_imageCache == nullptr)
+    {
+        return decodeImageAtSize(span, targetWidth, targetHeight);
+    }
+    return m_imageCache->decode(this, span, targetWidth, targetHeight);
+}
+
+void Factory::releaseCachedImage(const RenderImage* image)
+{
+    if (m_imageCache != nullptr)
+    {
+        m_imageCache->release(image);
+    }
+}
+
 rcp<Font> Factory::decodeFont(Span<const uint8_t> span)
 {
 #ifdef WITH_RIVE_TEXT
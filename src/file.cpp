@@ -53,6 +53,8 @@
 #include "rive/data_bind/converters/data_converter_number_to_list.hpp"
 #include "rive/assets/file_asset.hpp"
 #include "rive/assets/audio_asset.hpp"
+#include "rive/assets/image_asset.hpp"
+#include "rive/audio/audio_source.hpp"
 #include "rive/assets/file_asset_contents.hpp"
 #include "rive/viewmodel/viewmodel.hpp"
 #include "rive/viewmodel/data_enum.hpp"
@@ -248,6 +250,16 @@ File::File(Factory* factory, rcp<FileAssetLoader> assetLoader) :
     assert(factory);
 }
 
+void File::factory(Factory* factory)
+{
+    assert(factory);
+    m_factory = factory;
+    for (auto artboard : m_artboards)
+    {
+        artboard->m_Factory = factory;
+    }
+}
+
 File::~File()
 {
 #if defined(DEBUG) && defined(WITH_RIVE_TOOLS)
@@ -1064,6 +1076,77 @@ rcp<ViewModelRuntime> File::createViewModelRuntime(ViewModel* viewModel) const
 
 Span<const rcp<FileAsset>> File::assets() const { return m_fileAssets; }
 
+static size_t assetBytes(FileAsset* asset)
+{
+    size_t bytes = MemoryUsage::objectBytes(asset) + asset->cdnUuid().size();
+    if (asset->is<ImageAsset>())
+    {
+        auto image = asset->as<ImageAsset>()->renderImage();
+        if (image != nullptr)
+        {
+            bytes += image->decodedByteSize();
+        }
+    }
+    else if (asset->is<AudioAsset>())
+    {
+        auto source = asset->as<AudioAsset>()->audioSource();
+        if (source != nullptr)
+        {
+            bytes += source->isBuffered()
+                         ? source->bufferedSamples().size() * sizeof(float)
+                         : source->bytes().size();
+        }
+    }
+    return bytes;
+}
+
+MemoryUsage File::memoryUsage() const
+{
+    MemoryUsage usage;
+    usage.objects += sizeof(File) + MemoryUsage::objectBytes(m_backboard);
+    for (auto artboard : m_artboards)
+    {
+        usage += artboard->memoryUsage();
+    }
+    for (auto converter : m_DataConverters)
+    {
+        usage.objects += MemoryUsage::objectBytes(converter);
+    }
+    for (auto interpolator : m_keyframeInterpolators)
+    {
+        usage.animation += MemoryUsage::objectBytes(interpolator);
+    }
+    for (auto physics : m_scrollPhysics)
+    {
+        usage.objects += MemoryUsage::objectBytes(physics);
+    }
+    for (auto dataEnum : m_Enums)
+    {
+        usage.objects += MemoryUsage::objectBytes(dataEnum);
+    }
+    for (auto viewModel : m_ViewModels)
+    {
+        usage.objects += MemoryUsage::objectBytes(viewModel);
+        for (auto property : viewModel->properties())
+        {
+            usage.objects += MemoryUsage::objectBytes(property);
+        }
+    }
+    for (auto viewModelInstance : m_ViewModelInstances)
+    {
+        usage.objects += MemoryUsage::objectBytes(viewModelInstance);
+        for (auto value : viewModelInstance->propertyValues())
+        {
+            usage.objects += MemoryUsage::objectBytes(value);
+        }
+    }
+    for (const rcp<FileAsset>& asset : m_fileAssets)
+    {
+        usage.assets += assetBytes(asset.get());
+    }
+    return usage;
+}
+
 const std::vector<DataEnum*>& File::enums() const { return m_Enums; }
 
 #ifdef WITH_RIVE_TOOLS
@@ -0,0 +1,230 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#include "rive/image_cache.hpp"
+#include "rive/factory.hpp"
+#include <cassert>
+#include <cstring>
+
+using namespace rive;
+
+uint64_t ImageCache::Hash(Span<const uint8_t> encoded)
+{
+    // FNV-1a's constants and xor-multiply step, applied to 8 byte words to
+    // keep hashing large images cheap next to decoding them. Word-wise
+    // multiplication only carries bits upwards, so each step also folds the
+    // high half back down. This isn't FNV-1a anymore and its values only
+    // mean something within this cache.
+    constexpr uint64_t kPrime = 0x100000001b3ull;
+    uint64_t hash = 0xcbf29ce484222325ull ^ encoded.size();
+    const uint8_t* data = encoded.data();
+    size_t size = encoded.size();
+    for (; size >= 8; data += 8, size -= 8)
+    {
+        uint64_t word;
+        memcpy(&word, data, 8);
+        hash = (hash ^ word) * kPrime;
+        hash ^= hash >> 32;
+    }
+    for (; size > 0; ++data, --size)
+    {
+        hash = (hash ^ *data) * kPrime;
+    }
+    return hash;
+}
+
+bool ImageCache::matches(const Entry& entry,
+                         Span<const uint8_t> encoded,
+                         uint32_t targetWidth,
+                         uint32_t targetHeight)
+{
+    return entry.targetWidth == targetWidth &&
+           entry.targetHeight == targetHeight &&
+           entry.encoded.size() == encoded.size() &&
+           (encoded.empty() ||
+            memcmp(entry.encoded.data(), encoded.data(), encoded.size()) == 0);
+}
+
+rcp<RenderImage> ImageCache::decode(Factory* factory,
+                                    Span<const uint8_t> encoded,
+                                    uint32_t targetWidth,
+                                    uint32_t targetHeight)
+{
+    uint64_t hash = Hash(encoded);
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto range = m_index.equal_range(hash);
+        for (auto itr = range.first; itr != range.second; ++itr)
+        {
+            auto entry = itr->second;
+            if (matches(*entry, encoded, targetWidth, targetHeight))
+            {
+                m_entries.splice(m_entries.begin(), m_entries, entry);
+                m_hits++;
+                return acquire(entry);
+            }
+        }
+    }
+
+    // Decode without holding the lock, other images can be looked up in the
+    // meantime.
+    rcp<RenderImage> image =
+        factory->decodeImageAtSize(encoded, targetWidth, targetHeight);
+    if (image == nullptr)
+    {
+        return nullptr;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto range = m_index.equal_range(hash);
+    for (auto itr = range.first; itr != range.second; ++itr)
+    {
+        // Another thread decoded the same bytes first.
+        if (matches(*itr->second, encoded, targetWidth, targetHeight))
+        {
+            m_hits++;
+            return acquire(itr->second);
+        }
+    }
+    m_misses++;
+    size_t decodedBytes = image->decodedByteSize();
+    m_entries.push_front({hash,
+                          std::vector<uint8_t>(encoded.begin(), encoded.end()),
+                          targetWidth,
+                          targetHeight,
+                          decodedBytes,
+                          image,
+                          1});
+    m_index.emplace(hash, m_entries.begin());
+    m_images.emplace(image.get(), m_entries.begin());
+    m_decodedBytes += decodedBytes;
+    m_encodedBytes += encoded.size();
+    evict();
+    return image;
+}
+
+rcp<RenderImage> ImageCache::acquire(EntryList::iterator entry)
+{
+    entry->uses++;
+    return entry->image;
+}
+
+void ImageCache::release(const RenderImage* image)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto itr = m_images.find(image);
+    if (itr == m_images.end())
+    {
+        return;
+    }
+    assert(itr->second->uses > 0);
+    if (--itr->second->uses == 0)
+    {
+        evict();
+    }
+}
+
+void ImageCache::byteBudget(size_t budget)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_byteBudget = budget;
+    evict();
+}
+
+void ImageCache::purgeUnused()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (auto entry = m_entries.begin(); entry != m_entries.end();)
+    {
+        auto next = std::next(entry);
+        if (isUnused(*entry))
+        {
+            erase(entry);
+        }
+        entry = next;
+    }
+}
+
+void ImageCache::clear()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_index.clear();
+    m_images.clear();
+    m_decodedBytes = 0;
+    m_encodedBytes = 0;
+}
+
+size_t ImageCache::count() const
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+size_t ImageCache::decodedBytes() const
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_decodedBytes;
+}
+
+size_t ImageCache::encodedBytes() const
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_encodedBytes;
+}
+
+size_t ImageCache::hits() const
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_hits;
+}
+
+size_t ImageCache::misses() const
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_misses;
+}
+
+void ImageCache::erase(EntryList::iterator entry)
+{
+    auto range = m_index.equal_range(entry->hash);
+    for (auto itr = range.first; itr != range.second; ++itr)
+    {
+        if (itr->second == entry)
+        {
+            m_index.erase(itr);
+            break;
+        }
+    }
+    m_images.erase(entry->image.get());
+    m_decodedBytes -= entry->decodedBytes;
+    m_encodedBytes -= entry->encoded.size();
+    m_entries.erase(entry);
+}
+
+void ImageCache::evict()
+{
+    // Images that are still in use cost the same memory whether they're
+    // cached or not, so only unused ones count against the budget.
+    size_t unusedBytes = 0;
+    for (const Entry& entry : m_entries)
+    {
+        if (isUnused(entry))
+        {
+            unusedBytes += entry.cachedBytes();
+        }
+    }
+    for (auto entry = m_entries.end();
+         unusedBytes > m_byteBudget && entry != m_entries.begin();)
+    {
+        --entry;
+        if (isUnused(*entry))
+        {
+            unusedBytes -= entry->cachedBytes();
+            auto next = std::next(entry);
+            erase(entry);
+            entry = next;
+        }
+    }
+}
@@ -207,9 +207,11 @@ YGUnit LayoutComponentStyle::flexBasisUnits()
 
 void LayoutComponentStyle::markLayoutNodeDirty()
 {
+    // Style values can't change what our layout's content measures, so let
+    // syncStyle decide whether the Yoga node actually needs to be dirtied.
     if (parent()->is<LayoutComponent>())
     {
-        parent()->as<LayoutComponent>()->markLayoutNodeDirty();
+        parent()->as<LayoutComponent>()->markLayoutStyleChanged();
     }
 }
 
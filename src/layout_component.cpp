@@ -398,14 +398,51 @@ static YGSize measureFunc(YGNode* node,
                           YGMeasureMode heightMode)
 {
     Vec2D size = ((LayoutComponent*)node->getContext())
-                     ->measureLayout(width,
-                                     (LayoutMeasureMode)widthMode,
-                                     height,
-                                     (LayoutMeasureMode)heightMode);
+                     ->measureLayoutCached(width,
+                                           (LayoutMeasureMode)widthMode,
+                                           height,
+                                           (LayoutMeasureMode)heightMode);
 
     return YGSize{size.x, size.y};
 }
 
+Vec2D LayoutComponent::measureLayoutCached(float width,
+                                           LayoutMeasureMode widthMode,
+                                           float height,
+                                           LayoutMeasureMode heightMode)
+{
+    // Yoga passes NaN for undefined dimensions, so only compare the values
+    // that matter for the mode.
+    for (uint8_t i = 0; i < m_measuredSizeCount; i++)
+    {
+        const MeasuredSize& measured = m_measuredSizes[i];
+        if (measured.widthMode == widthMode &&
+            measured.heightMode == heightMode &&
+            (widthMode == LayoutMeasureMode::undefined ||
+             measured.width == width) &&
+            (heightMode == LayoutMeasureMode::undefined ||
+             measured.height == height))
+        {
+            return measured.size;
+        }
+    }
+#ifdef TESTING
+    measureCount++;
+#endif
+    Vec2D size = measureLayout(width, widthMode, height, heightMode);
+    m_measuredSizes[m_nextMeasuredSize] = {width,
+                                           widthMode,
+                                           height,
+                                           heightMode,
+                                           size};
+    m_nextMeasuredSize = (m_nextMeasuredSize + 1) % maxMeasuredSizes;
+    if (m_measuredSizeCount < maxMeasuredSizes)
+    {
+        m_measuredSizeCount++;
+    }
+    return size;
+}
+
 Vec2D LayoutComponent::measureLayout(float width,
                                      LayoutMeasureMode widthMode,
                                      float height,
@@ -482,6 +519,7 @@ void LayoutComponent::syncStyle()
     }
     YGNode& ygNode = m_layoutData->node;
     YGStyle& ygStyle = m_layoutData->style;
+    bool hadMeasureFunc = ygNode.hasMeasureFunc();
     if (m_style->intrinsicallySized() && isLeaf())
     {
         ygNode.setContext(this);
@@ -837,7 +875,17 @@ void LayoutComponent::syncStyle()
     ygStyle.flexWrap() = m_style->flexWrap();
     ygStyle.direction() = m_style->direction();
 
-    ygNode.setStyle(ygStyle);
+    // Only dirty the node (and so its ancestors) when something Yoga cares
+    // about changed. Yoga keeps reusing the cached layout of clean subtrees.
+    if (ygNode.getStyle() != ygStyle ||
+        ygNode.hasMeasureFunc() != hadMeasureFunc)
+    {
+        ygNode.setStyle(ygStyle);
+        ygNode.markDirtyAndPropagate();
+#ifdef TESTING
+        styleDirtyCount++;
+#endif
+    }
 }
 
 void LayoutComponent::clearLayoutChildren()
@@ -1342,10 +1390,17 @@ void LayoutComponent::markLayoutNodeDirty(bool shouldForceUpdateLayoutBounds)
     {
         m_forceUpdateLayoutBounds = shouldForceUpdateLayoutBounds;
     }
+    // Our content may measure differently now.
+    m_measuredSizeCount = 0;
     m_layoutData->node.markDirtyAndPropagate();
     artboard()->markLayoutDirty(this);
 }
 
+void LayoutComponent::markLayoutStyleChanged()
+{
+    artboard()->markLayoutDirty(this);
+}
+
 void LayoutComponent::markLayoutStyleDirty()
 {
     clearInheritedInterpolation();
@@ -1461,6 +1516,7 @@ bool LayoutComponent::advanceComponent(float elapsedSeconds, AdvanceFlags flags)
 }
 
 void LayoutComponent::markLayoutNodeDirty(bool shouldForceUpdateLayoutBounds) {}
+void LayoutComponent::markLayoutStyleChanged() {}
 void LayoutComponent::markLayoutStyleDirty() {}
 void LayoutComponent::onDirty(ComponentDirt value) {}
 bool LayoutComponent::mainAxisIsRow() { return true; }
@@ -1485,11 +1541,11 @@ LayoutComponent::~LayoutComponent()
 }
 
 void LayoutComponent::clipChanged() { markLayoutNodeDirty(); }
-void LayoutComponent::widthChanged() { markLayoutNodeDirty(); }
-void LayoutComponent::heightChanged() { markLayoutNodeDirty(); }
+void LayoutComponent::widthChanged() { markLayoutStyleChanged(); }
+void LayoutComponent::heightChanged() { markLayoutStyleChanged(); }
 void LayoutComponent::styleIdChanged() { markLayoutNodeDirty(); }
-void LayoutComponent::fractionalWidthChanged() { markLayoutNodeDirty(); }
-void LayoutComponent::fractionalHeightChanged() { markLayoutNodeDirty(); }
+void LayoutComponent::fractionalWidthChanged() { markLayoutStyleChanged(); }
+void LayoutComponent::fractionalHeightChanged() { markLayoutStyleChanged(); }
 
 ShapePaintPath* LayoutComponent::worldPath() { return &m_worldPath; }
 ShapePaintPath* LayoutComponent::localPath() { return &m_localPath; }
@@ -130,6 +130,7 @@ void ScriptedProperty::valueChanged()
     size_t calls = m_listeners.size();
     for (size_t i = 0; i < calls; i++)
     {
+        ScriptingProfilerScope scope(m_state, "listener");
         lua_pcall(m_state, 1, 0, 0);
     }
 }
@@ -107,6 +107,55 @@ static int path_add(lua_State* L)
     return 0;
 }
 
+// Adds a contour through every Vec2D in the array at 2, optionally closing it.
+// Building a polyline this way costs a single call into the VM instead of one
+// namecall per point. Every entry is type checked before anything is appended
+// so that a bad array raises an error without leaving half a contour behind.
+static int path_addPolyline(lua_State* L)
+{
+    auto scriptedPath = lua_torive<ScriptedPath>(L, 1);
+    luaL_checktype(L, 2, LUA_TTABLE);
+    bool closed = lua_toboolean(L, 3) != 0;
+    int count = lua_objlen(L, 2);
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    for (int i = 1; i <= count; i++)
+    {
+        lua_rawgeti(L, 2, i);
+        if (lua_tovec2d(L, -1) == nullptr)
+        {
+            luaL_error(L, "addPolyline expects an array of Vec2D");
+            return 0;
+        }
+        lua_pop(L, 1);
+    }
+
+    auto& rawPath = scriptedPath->rawPath;
+    for (int i = 1; i <= count; i++)
+    {
+        lua_rawgeti(L, 2, i);
+        auto vec = lua_tovec2d(L, -1);
+        if (i == 1)
+        {
+            rawPath.move(*vec);
+        }
+        else
+        {
+            rawPath.line(*vec);
+        }
+        lua_pop(L, 1);
+    }
+    if (closed)
+    {
+        rawPath.close();
+    }
+    scriptedPath->markDirty();
+    return 0;
+}
+
 static int path_namecall(lua_State* L)
 {
     int atom;
@@ -129,6 +178,8 @@ static int path_namecall(lua_State* L)
                 return path_reset(L);
             case (int)LuaAtoms::add:
                 return path_add(L);
+            case (int)LuaAtoms::addPolyline:
+                return path_addPolyline(L);
         }
     }
 
@@ -1,6 +1,7 @@
 #ifdef WITH_RIVE_SCRIPTING
 #include "rive/lua/rive_lua_libs.hpp"
 #include "lualib.h"
+#include "rive/profiler/profiler_macros.h"
 #include <unordered_map>
 #include <string>
 
@@ -27,6 +28,7 @@ std::unordered_map<std::string, int16_t> atoms = {
     {"close", (int16_t)LuaAtoms::close},
     {"reset", (int16_t)LuaAtoms::reset},
     {"add", (int16_t)LuaAtoms::add},
+    {"addPolyline", (int16_t)LuaAtoms::addPolyline},
     {"invert", (int16_t)LuaAtoms::invert},
     {"isIdentity", (int16_t)LuaAtoms::isIdentity},
     {"width", (int16_t)LuaAtoms::width},
@@ -126,8 +128,12 @@ int luaopen_rive(lua_State* L)
 
 static void* l_alloc(void* ud, void* ptr, size_t osize, size_t nsize)
 {
-    (void)ud;
-    (void)osize;
+    // ud points at the owning ScriptingVM's profiler.
+    auto profiler = static_cast<std::unique_ptr<ScriptingProfiler>*>(ud)->get();
+    if (profiler != nullptr)
+    {
+        profiler->allocated(ptr == nullptr ? 0 : osize, nsize);
+    }
     if (nsize == 0)
     {
         free(ptr);
@@ -230,12 +236,40 @@ void ScriptingVM::init(lua_State* state, ScriptingContext* context)
 
 ScriptingVM::ScriptingVM(ScriptingContext* context) : m_context(context)
 {
-    m_state = lua_newstate(l_alloc, nullptr);
+    m_state = lua_newstate(l_alloc, &m_profiler);
     init(m_state, m_context);
 }
 
 ScriptingVM::~ScriptingVM() { lua_close(m_state); }
 
+ScriptingProfiler* ScriptingVM::enableProfiler()
+{
+    if (m_profiler == nullptr)
+    {
+        m_profiler = rivestd::make_unique<ScriptingProfiler>();
+        lua_Callbacks* callbacks = lua_callbacks(m_state);
+        callbacks->userdata = m_profiler.get();
+        callbacks->interrupt = [](lua_State* L, int gc) {
+            // gc >= 0 means we're inside a collection step, where erroring
+            // out isn't allowed.
+            if (gc >= 0)
+            {
+                return;
+            }
+            ScriptingProfiler::from(L)->step(L);
+        };
+    }
+    return m_profiler.get();
+}
+
+int ScriptingVM::pcall(const char* scope, int nargs, int nresults)
+{
+    RIVE_PROF_SCOPENAME("ScriptingVM::pcall");
+    RIVE_PROF_TAG("scope", scope);
+    ScriptingProfilerScope profilerScope(m_state, scope);
+    return lua_pcall(m_state, nargs, nresults, 0);
+}
+
 static int register_module(lua_State* L)
 {
     // This is only called internally where we ensure we're pushing the right
@@ -280,6 +314,7 @@ static bool push_module(lua_State* L, const char* name, Span<uint8_t> bytecode)
 
     if (status == 0)
     {
+        ScriptingProfilerScope scope(L, name);
         int status = lua_resume(ML, L, 0);
         if (status == 0)
         {
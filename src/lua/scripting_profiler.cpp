@@ -0,0 +1,103 @@
+#ifdef WITH_RIVE_SCRIPTING
+#include "rive/lua/scripting_profiler.hpp"
+#include "lualib.h"
+
+using namespace rive;
+
+ScriptingProfiler* ScriptingProfiler::from(lua_State* L)
+{
+    return static_cast<ScriptingProfiler*>(lua_callbacks(L)->userdata);
+}
+
+void ScriptingProfiler::chargeTime(clock::time_point now)
+{
+    auto scope = current();
+    if (scope != nullptr)
+    {
+        scope->seconds +=
+            std::chrono::duration<double>(now - m_scopeStart).count();
+    }
+    m_scopeStart = now;
+}
+
+void ScriptingProfiler::beginScope(const char* name)
+{
+    chargeTime(clock::now());
+
+    size_t index;
+    auto itr = m_indices.find(name);
+    if (itr == m_indices.end())
+    {
+        index = m_stats.size();
+        m_indices[name] = index;
+        m_stats.emplace_back();
+        m_stats.back().name = name;
+    }
+    else
+    {
+        index = itr->second;
+    }
+    m_stats[index].calls++;
+    m_stack.push_back(index);
+}
+
+void ScriptingProfiler::endScope()
+{
+    if (m_stack.empty())
+    {
+        return;
+    }
+    chargeTime(clock::now());
+    m_stack.pop_back();
+}
+
+const ScriptingScopeStats* ScriptingProfiler::stats(
+    const std::string& name) const
+{
+    auto itr = m_indices.find(name);
+    return itr == m_indices.end() ? nullptr : &m_stats[itr->second];
+}
+
+void ScriptingProfiler::clear()
+{
+    // Keep the open scopes so their endScope calls stay balanced.
+    for (auto& stats : m_stats)
+    {
+        std::string name = std::move(stats.name);
+        stats = ScriptingScopeStats();
+        stats.name = std::move(name);
+    }
+    m_frameSteps = 0;
+}
+
+void ScriptingProfiler::step(lua_State* L)
+{
+    auto scope = current();
+    if (scope == nullptr)
+    {
+        return;
+    }
+    scope->steps++;
+    if (m_stepBudget != 0 && ++m_frameSteps > m_stepBudget)
+    {
+        scope->aborts++;
+        // Keep failing until the next frame so that a script catching the
+        // error with pcall can't keep running.
+        luaL_error(L,
+                   "%s exceeded the step budget of %llu",
+                   scope->name.c_str(),
+                   (unsigned long long)m_stepBudget);
+    }
+}
+
+void ScriptingProfiler::allocated(size_t oldSize, size_t newSize)
+{
+    auto scope = current();
+    if (scope == nullptr || newSize <= oldSize)
+    {
+        return;
+    }
+    scope->allocations++;
+    scope->allocatedBytes += newSize - oldSize;
+}
+#endif
@@ -6,6 +6,7 @@
 #include "rive/math/raw_path_utils.hpp"
 #include "rive/math/contour_measure.hpp"
 #include "rive/math/math_types.hpp"
+#include "rive/math/simd.hpp"
 #include "rive/math/wangs_formula.hpp"
 #include "rive/profiler/profiler_macros.h"
 #include <cmath>
@@ -56,6 +57,37 @@ size_t ContourMeasure::findSegment(float distance) const
     return iter - m_segments.begin();
 }
 
+// Same as findSegment(distance), assuming the segment is at or after
+// startIndex. Walks forward a few segments first since consecutive queries
+// usually land close to each other.
+size_t ContourMeasure::findSegment(float distance, size_t startIndex) const
+{
+    assert(distance >= 0 && distance <= m_length);
+    assert(startIndex < m_segments.size());
+
+    constexpr size_t kMaxLinearSteps = 8;
+    size_t end = std::min(startIndex + kMaxLinearSteps, m_segments.size());
+    for (size_t i = startIndex; i < end; i++)
+    {
+        const Segment& seg = m_segments[i];
+        if (seg.m_distance >= distance && seg.m_distance != 0.0f)
+        {
+            return i;
+        }
+    }
+    const Segment seg = {distance, 0, 0, 0};
+    auto iter = std::lower_bound(m_segments.begin() + end - 1,
+                                 m_segments.end(),
+                                 seg);
+    while (iter != m_segments.end() && iter->m_distance == 0.0f)
+    {
+        iter = std::next(iter);
+    }
+    assert(iter != m_segments.end());
+    assert(iter->m_distance >= distance);
+    return iter - m_segments.begin();
+}
+
 static ContourMeasure::PosTan eval_quad(const Vec2D pts[], float t)
 {
     assert(t >= 0 && t <= 1);
@@ -167,24 +199,48 @@ void ContourMeasure::Segment::extract(RawPath* dst,
     }
 }
 
-ContourMeasure::PosTan ContourMeasure::getPosTan(float distance) const
+// Evaluates tangents of a cubic at 4 t values at once. Matches eval_cubic
+// for t values strictly between 0 and 1.
+static void eval_cubic4(const Vec2D pts[],
+                        const float t[4],
+                        ContourMeasure::PosTan out[4])
 {
-    // specal-case end of the contour
-    if (distance > m_length)
-    {
-        distance = m_length;
-    }
+    const EvalCubic eval(pts);
+    const float4 T = simd::load4f(t);
 
-    if (distance < 0)
+    // Compute derivative as at^2 + bt + c;
+    float4 x = ((eval.a.x * T + eval.b.x) * T + eval.c.x) * T + eval.d.x;
+    float4 y = ((eval.a.y * T + eval.b.y) * T + eval.c.y) * T + eval.d.y;
+    float4 tx = (eval.a.x * 3 * T + eval.b.x * 2) * T + eval.c.x;
+    float4 ty = (eval.a.y * 3 * T + eval.b.y * 2) * T + eval.c.y;
+    float4 len2 = tx * tx + ty * ty;
+    float4 scale = simd::if_then_else(len2 > 0.0f,
+                                      1.0f / simd::sqrt(len2),
+                                      float4(1.0f));
+    tx *= scale;
+    ty *= scale;
+    for (int i = 0; i < 4; i++)
     {
-        distance = 0;
+        out[i] = {{x[i], y[i]}, {tx[i], ty[i]}};
     }
+}
 
-    size_t i = this->findSegment(distance);
-    assert(i < m_segments.size());
-    const auto seg = m_segments[i];
+ContourMeasure::PosTan ContourMeasure::getPosTan(float distance) const
+{
+    // specal-case end of the contour
+    distance = math::clamp(distance, 0.0f, m_length);
+    return evalSegment(this->findSegment(distance), distance);
+}
+
+// Returns where distance lands on segment i as a t value of the segment's
+// line/quad/cubic.
+static float segment_t(const ContourMeasure::Segment segments[],
+                       size_t i,
+                       float distance)
+{
+    const auto& seg = segments[i];
     const float currD = seg.m_distance;
-    const float prevD = i > 0 ? m_segments[i - 1].m_distance : 0;
+    const float prevD = i > 0 ? segments[i - 1].m_distance : 0;
 
     assert(prevD < currD);
     assert(distance <= currD);
@@ -195,19 +251,13 @@ ContourMeasure::PosTan ContourMeasure::getPosTan(float distance) const
 
     if (seg.m_type == SegmentType::kLine)
     {
-        assert(seg.m_ptIndex + 1 < m_points.size());
-        auto p0 = m_points[seg.m_ptIndex + 0];
-        auto p1 = m_points[seg.m_ptIndex + 1];
-        return {
-            Vec2D::lerp(p0, p1, relD),
-            (p1 - p0).normalized(),
-        };
+        return relD;
     }
 
     float prevT = 0;
     if (i > 0)
     {
-        auto prev = m_segments[i - 1];
+        auto prev = segments[i - 1];
         if (prev.m_ptIndex == seg.m_ptIndex)
         {
             prevT = prev.getT();
@@ -216,8 +266,39 @@ ContourMeasure::PosTan ContourMeasure::getPosTan(float distance) const
 
     const float t = lerp(prevT, seg.getT(), relD);
     assert(t >= 0 && t <= 1);
+    return t;
+}
 
-    if (seg.m_type == SegmentType::kQuad)
+size_t ContourMeasure::findSegment(float distance, size_t* segmentHint) const
+{
+    size_t hint = *segmentHint;
+    // The hint only helps if distance is past the segment before it.
+    *segmentHint =
+        hint < m_segments.size() &&
+                (hint == 0 || m_segments[hint - 1].m_distance < distance)
+            ? this->findSegment(distance, hint)
+            : this->findSegment(distance);
+    return *segmentHint;
+}
+
+ContourMeasure::PosTan ContourMeasure::evalSegment(size_t i,
+                                                   float distance) const
+{
+    assert(i < m_segments.size());
+    const auto seg = m_segments[i];
+    const float t = segment_t(m_segments.data(), i, distance);
+
+    if (seg.m_type == SegmentType::kLine)
+    {
+        assert(seg.m_ptIndex + 1 < m_points.size());
+        auto p0 = m_points[seg.m_ptIndex + 0];
+        auto p1 = m_points[seg.m_ptIndex + 1];
+        return {
+            Vec2D::lerp(p0, p1, t),
+            (p1 - p0).normalized(),
+        };
+    }
+    else if (seg.m_type == SegmentType::kQuad)
     {
         assert(seg.m_ptIndex + 2 < m_points.size());
         return eval_quad(&m_points[seg.m_ptIndex], t);
@@ -230,6 +311,73 @@ ContourMeasure::PosTan ContourMeasure::getPosTan(float distance) const
     }
 }
 
+ContourMeasure::PosTan ContourMeasure::getPosTan(float distance,
+                                                 size_t* segmentHint) const
+{
+    // specal-case end of the contour
+    distance = math::clamp(distance, 0.0f, m_length);
+    return evalSegment(this->findSegment(distance, segmentHint), distance);
+}
+
+void ContourMeasure::getPosTans(Span<const float> distances,
+                                PosTan out[]) const
+{
+    // Interior points on the same cubic are queued up and evaluated four at
+    // a time.
+    float pendingT[4];
+    size_t pendingOut[4];
+    size_t pendingCount = 0;
+    uint32_t pendingPtIndex = 0;
+    auto flush = [&]() {
+        if (pendingCount == 0)
+        {
+            return;
+        }
+        for (size_t i = pendingCount; i < 4; i++)
+        {
+            pendingT[i] = pendingT[0];
+        }
+        PosTan results[4];
+        eval_cubic4(&m_points[pendingPtIndex], pendingT, results);
+        for (size_t i = 0; i < pendingCount; i++)
+        {
+            out[pendingOut[i]] = results[i];
+        }
+        pendingCount = 0;
+    };
+
+    size_t segmentHint = 0;
+    for (size_t i = 0; i < distances.size(); i++)
+    {
+        float distance = math::clamp(distances[i], 0.0f, m_length);
+        size_t segmentIndex = this->findSegment(distance, &segmentHint);
+        const auto& seg = m_segments[segmentIndex];
+        if (seg.m_type == SegmentType::kCubic)
+        {
+            float t = segment_t(m_segments.data(), segmentIndex, distance);
+            // eval_cubic computes end point tangents differently.
+            if (t != 0.0f && t != 1.0f)
+            {
+                if (pendingCount != 0 && pendingPtIndex != seg.m_ptIndex)
+                {
+                    flush();
+                }
+                assert(seg.m_ptIndex + 3 < m_points.size());
+                pendingPtIndex = seg.m_ptIndex;
+                pendingT[pendingCount] = t;
+                pendingOut[pendingCount] = i;
+                if (++pendingCount == 4)
+                {
+                    flush();
+                }
+                continue;
+            }
+        }
+        out[i] = evalSegment(segmentIndex, distance);
+    }
+    flush();
+}
+
 static const ContourMeasure::Segment* next_segment_beginning(
     const ContourMeasure::Segment* seg)
 {
@@ -5,6 +5,8 @@
 #include "rive/math/hit_test.hpp"
 
 #include "rive/math/mat2d.hpp"
+#include "rive/math/raw_path.hpp"
+#include "rive/math/raw_path_utils.hpp"
 #include <algorithm>
 #include <assert.h>
 #include <cmath>
@@ -469,3 +471,195 @@ bool HitTester::testMesh(const IAABB& area,
     }
     return false;
 }
+
+/////////////////////////
+
+void HitTestPolygon::rewind()
+{
+    m_edges.clear();
+    m_bounds = AABB::forExpansion();
+    m_hasContour = false;
+}
+
+void HitTestPolygon::addEdge(Vec2D p0, Vec2D p1, bool implicit)
+{
+    if (p0 == p1)
+    {
+        return;
+    }
+    AABB bounds(std::min(p0.x, p1.x),
+                std::min(p0.y, p1.y),
+                std::max(p0.x, p1.x),
+                std::max(p0.y, p1.y));
+    m_edges.push_back({p0, p1, bounds, implicit});
+    AABB::expandTo(m_bounds, p0);
+    AABB::expandTo(m_bounds, p1);
+}
+
+void HitTestPolygon::closeContour()
+{
+    if (m_hasContour)
+    {
+        addEdge(m_last, m_contourStart, true);
+        m_hasContour = false;
+    }
+}
+
+void HitTestPolygon::addPath(const RawPath& path, const Mat2D& xform)
+{
+    if (m_edges.empty())
+    {
+        m_bounds = AABB::forExpansion();
+    }
+    for (auto iter : path)
+    {
+        PathVerb verb = std::get<0>(iter);
+        const Vec2D* pts = std::get<1>(iter);
+        switch (verb)
+        {
+            case PathVerb::move:
+                closeContour();
+                m_contourStart = m_last = xform * pts[0];
+                m_hasContour = true;
+                break;
+            case PathVerb::line:
+            {
+                Vec2D p = xform * pts[1];
+                addEdge(m_last, p, false);
+                m_last = p;
+                break;
+            }
+            case PathVerb::quad:
+            case PathVerb::cubic:
+            {
+                Vec2D cubic[4];
+                if (verb == PathVerb::quad)
+                {
+                    cubic[0] = pts[0];
+                    cubic[1] = Vec2D::lerp(pts[0], pts[1], 2 / 3.f);
+                    cubic[2] = Vec2D::lerp(pts[2], pts[1], 2 / 3.f);
+                    cubic[3] = pts[2];
+                }
+                else
+                {
+                    std::copy(pts, pts + 4, cubic);
+                }
+                for (Vec2D& p : cubic)
+                {
+                    p = xform * p;
+                }
+                // Same flattening tolerance the rasterizing HitTester uses.
+                const int count = compute_cubic_segments(cubic[0],
+                                                         cubic[1],
+                                                         cubic[2],
+                                                         cubic[3]);
+                const EvalCubic eval(cubic);
+                const float dt = 1.0f / (float)count;
+                for (int i = 1; i < count; ++i)
+                {
+                    Vec2D p = eval(dt * i);
+                    addEdge(m_last, p, false);
+                    m_last = p;
+                }
+                addEdge(m_last, cubic[3], false);
+                m_last = cubic[3];
+                break;
+            }
+            case PathVerb::close:
+                if (m_hasContour)
+                {
+                    addEdge(m_last, m_contourStart, false);
+                    m_last = m_contourStart;
+                    m_hasContour = false;
+                }
+                break;
+        }
+    }
+    closeContour();
+}
+
+static bool boxes_overlap(const AABB& a, const AABB& b)
+{
+    return a.minX <= b.maxX && b.minX <= a.maxX && a.minY <= b.maxY &&
+           b.minY <= a.maxY;
+}
+
+// Whether segment p0-p1 touches the box, given that their bounds overlap.
+static bool segment_touches_box(Vec2D p0, Vec2D p1, const AABB& box)
+{
+    // With the bounds overlapping, the only separating axis left is the
+    // segment's normal: it misses the box if all corners are on one side.
+    Vec2D d = p1 - p0;
+    float c0 = Vec2D::cross(d, Vec2D(box.minX, box.minY) - p0);
+    float c1 = Vec2D::cross(d, Vec2D(box.maxX, box.minY) - p0);
+    float c2 = Vec2D::cross(d, Vec2D(box.maxX, box.maxY) - p0);
+    float c3 = Vec2D::cross(d, Vec2D(box.minX, box.maxY) - p0);
+    return !((c0 > 0 && c1 > 0 && c2 > 0 && c3 > 0) ||
+             (c0 < 0 && c1 < 0 && c2 < 0 && c3 < 0));
+}
+
+bool HitTestPolygon::testFill(Vec2D point, float radius, FillRule rule) const
+{
+    AABB box(point.x - radius,
+             point.y - radius,
+             point.x + radius,
+             point.y + radius);
+    if (m_edges.empty() || !boxes_overlap(box, m_bounds))
+    {
+        return false;
+    }
+
+    int winding = 0;
+    for (const Edge& edge : m_edges)
+    {
+        // An edge crossing the box means the filled side of it overlaps the
+        // box.
+        if (boxes_overlap(box, edge.bounds) &&
+            segment_touches_box(edge.p0, edge.p1, box))
+        {
+            return true;
+        }
+        // Count the edges crossing the ray going right from point.
+        if (point.y < edge.bounds.minY || point.y >= edge.bounds.maxY ||
+            point.x > edge.bounds.maxX)
+        {
+            continue;
+        }
+        float t = (point.y - edge.p0.y) / (edge.p1.y - edge.p0.y);
+        float x = edge.p0.x + (edge.p1.x - edge.p0.x) * t;
+        if (x > point.x)
+        {
+            winding += edge.p1.y > edge.p0.y ? 1 : -1;
+        }
+    }
+    return rule == FillRule::evenOdd ? (winding & 1) != 0 : winding != 0;
+}
+
+bool HitTestPolygon::testStroke(Vec2D point, float radius) const
+{
+    AABB box(point.x - radius,
+             point.y - radius,
+             point.x + radius,
+             point.y + radius);
+    if (m_edges.empty() || !boxes_overlap(box, m_bounds))
+    {
+        return false;
+    }
+    const float radiusSquared = radius * radius;
+    for (const Edge& edge : m_edges)
+    {
+        if (edge.implicit || !boxes_overlap(box, edge.bounds))
+        {
+            continue;
+        }
+        Vec2D d = edge.p1 - edge.p0;
+        float t = std::min(
+            std::max(Vec2D::dot(point - edge.p0, d) / d.lengthSquared(), 0.0f),
+            1.0f);
+        if (Vec2D::distanceSquared(edge.p0 + d * t, point) <= radiusSquared)
+        {
+            return true;
+        }
+    }
+    return false;
+}
@@ -1,4 +1,6 @@
 #include "rive/math/path_measure.hpp"
+#include <algorithm>
+#include <cmath>
 
 using namespace rive;
 
@@ -15,25 +17,122 @@ PathMeasure::PathMeasure(const RawPath* path, float tol) : m_length(0.0f)
     }
 }
 
+size_t PathMeasure::findContour(float* distance) const
+{
+    size_t index = 0;
+    for (auto& contour : m_contours)
+    {
+        float contourLength = contour->length();
+        if (*distance - contourLength <= 0)
+        {
+            return index;
+        }
+        *distance -= contourLength;
+        index++;
+    }
+    return index;
+}
+
 ContourMeasure::PosTanDistance PathMeasure::atDistance(float distance) const
 {
     float currentDistance = distance;
-    for (auto contour : m_contours)
+    size_t index = findContour(&currentDistance);
+    if (index == m_contours.size())
     {
-        float contourLength = contour->length();
-        if (currentDistance - contourLength <= 0)
+        return ContourMeasure::PosTanDistance();
+    }
+    return ContourMeasure::PosTanDistance(
+        m_contours[index]->getPosTan(currentDistance),
+        distance);
+}
+
+ContourMeasure::PosTanDistance PathMeasure::atDistance(float distance,
+                                                       Cursor* cursor) const
+{
+    float currentDistance = distance;
+    size_t index = findContour(&currentDistance);
+    if (index == m_contours.size())
+    {
+        return ContourMeasure::PosTanDistance();
+    }
+    if (index != cursor->contourIndex)
+    {
+        cursor->contourIndex = index;
+        cursor->segmentIndex = 0;
+    }
+    return ContourMeasure::PosTanDistance(
+        m_contours[index]->getPosTan(currentDistance, &cursor->segmentIndex),
+        distance);
+}
+
+void PathMeasure::atDistances(Span<const float> distances,
+                              ContourMeasure::PosTanDistance out[]) const
+{
+    // Resolve runs of distances landing on the same contour together so
+    // the contour can sweep its segments once for the whole run.
+    constexpr size_t kRunSize = 64;
+    float localDistances[kRunSize];
+    ContourMeasure::PosTan results[kRunSize];
+    size_t i = 0;
+    while (i < distances.size())
+    {
+        float localDistance = distances[i];
+        size_t index = findContour(&localDistance);
+        if (index == m_contours.size())
+        {
+            out[i++] = ContourMeasure::PosTanDistance();
+            continue;
+        }
+        size_t runSize = 0;
+        localDistances[runSize++] = localDistance;
+        while (i + runSize < distances.size() && runSize < kRunSize)
+        {
+            localDistance = distances[i + runSize];
+            if (findContour(&localDistance) != index)
+            {
+                break;
+            }
+            localDistances[runSize++] = localDistance;
+        }
+        m_contours[index]->getPosTans({localDistances, runSize}, results);
+        for (size_t j = 0; j < runSize; j++, i++)
         {
-            return ContourMeasure::PosTanDistance(
-                contour->getPosTan(currentDistance),
-                distance);
+            out[i] = ContourMeasure::PosTanDistance(results[j], distances[i]);
         }
-        currentDistance -= contourLength;
     }
-    return ContourMeasure::PosTanDistance();
 }
 
 ContourMeasure::PosTanDistance PathMeasure::atPercentage(
     float percentageDistance) const
+{
+    return atDistance(percentageToDistance(percentageDistance));
+}
+
+ContourMeasure::PosTanDistance PathMeasure::atPercentage(
+    float percentageDistance,
+    Cursor* cursor) const
+{
+    return atDistance(percentageToDistance(percentageDistance), cursor);
+}
+
+void PathMeasure::atPercentages(Span<const float> percentageDistances,
+                                ContourMeasure::PosTanDistance out[]) const
+{
+    constexpr size_t kRunSize = 64;
+    float distances[kRunSize];
+    for (size_t i = 0; i < percentageDistances.size(); i += kRunSize)
+    {
+        size_t runSize =
+            std::min(kRunSize, percentageDistances.size() - i);
+        for (size_t j = 0; j < runSize; j++)
+        {
+            distances[j] = percentageToDistance(percentageDistances[i + j]);
+        }
+        atDistances({distances, runSize}, out + i);
+    }
+}
+
+float PathMeasure::percentageToDistance(float percentageDistance) const
 {
     float inRangePercentage = fmodf(percentageDistance, 1.0f);
     if (inRangePercentage < 0.0f)
@@ -48,5 +147,5 @@ ContourMeasure::PosTanDistance PathMeasure::atPercentage(
         inRangePercentage = 1.0f;
     }
 
-    return atDistance(m_length * inRangePercentage);
+    return m_length * inRangePercentage;
 }
@@ -0,0 +1,25 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#include "rive/memory_usage.hpp"
+#include "rive/generated/core_registry.hpp"
+#include "rive/math/raw_path.hpp"
+
+using namespace rive;
+
+size_t MemoryUsage::objectBytes(const Core* object)
+{
+    if (object == nullptr)
+    {
+        return 0;
+    }
+    size_t size = CoreRegistry::objectSize(object->coreType());
+    return size != 0 ? size : sizeof(Core);
+}
+
+size_t MemoryUsage::rawPathBytes(const RawPath& rawPath)
+{
+    return rawPath.points().size() * sizeof(Vec2D) +
+           rawPath.verbs().size() * sizeof(PathVerb);
+}
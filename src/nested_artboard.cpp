@@ -53,6 +53,7 @@ void NestedArtboard::nest(Artboard* artboard)
     // This allows for swapping after initial load (after onAddedClean has
     // already been called).
     m_Artboard->host(this);
+    instanceSizeChanged();
 }
 
 Artboard* NestedArtboard::findArtboard(
@@ -116,6 +117,7 @@ void NestedArtboard::updateArtboard(
             m_Artboard = nullptr;
         }
         m_Instance = nullptr;
+        instanceSizeChanged();
         return;
     }
 
@@ -361,14 +363,43 @@ Vec2D NestedArtboard::measureLayout(float width,
                                     float height,
                                     LayoutMeasureMode heightMode)
 {
+    m_measuredInstanceSize =
+        m_Instance ? Vec2D(m_Instance->width(), m_Instance->height())
+                   : Vec2D();
+    m_isMeasured = true;
     return Vec2D(std::min(widthMode == LayoutMeasureMode::undefined
                               ? std::numeric_limits<float>::max()
                               : width,
-                          m_Instance ? m_Instance->width() : 0.0f),
+                          m_measuredInstanceSize.x),
                  std::min(heightMode == LayoutMeasureMode::undefined
                               ? std::numeric_limits<float>::max()
                               : height,
-                          m_Instance ? m_Instance->height() : 0.0f));
+                          m_measuredInstanceSize.y));
+}
+
+void NestedArtboard::instanceSizeChanged()
+{
+#ifdef WITH_RIVE_LAYOUT
+    if (!m_isMeasured)
+    {
+        return;
+    }
+    Vec2D size = m_Instance ? Vec2D(m_Instance->width(), m_Instance->height())
+                            : Vec2D();
+    if (size != m_measuredInstanceSize)
+    {
+        m_isMeasured = false;
+        markLayoutNodeDirty();
+    }
+#endif
+}
+
+void NestedArtboard::markHostTransformDirty()
+{
+    markTransformDirty();
+    // The instance marks its host dirty whenever its own layout changes,
+    // which includes its size changing.
+    instanceSizeChanged();
 }
 
 void NestedArtboard::controlSize(Vec2D size,
@@ -0,0 +1,473 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#include "rive/profiler/profiler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+using namespace rive;
+
+// Only the owning thread writes a slot, other threads may read or reset it,
+// so every field is a relaxed atomic.
+struct Profiler::ScopeSlot
+{
+    std::atomic<const char*> name{nullptr};
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> totalNanoseconds{0};
+    std::atomic<uint64_t> maxNanoseconds{0};
+    std::atomic<uint64_t> allocationCount{0};
+    std::atomic<uint64_t> allocatedBytes{0};
+};
+
+// Frame starts are recorded as zero length events with this name.
+static const char* const kFrameEventName = "Frame";
+
+struct ProfilerEvent
+{
+    std::atomic<const char*> name{nullptr};
+    std::atomic<uint64_t> startNanoseconds{0};
+    std::atomic<uint64_t> durationNanoseconds{0};
+};
+
+struct ProfilerThreadBuffer
+{
+    // Open addressed by name pointer, scopes past capacity aren't recorded.
+    static constexpr size_t kSlotCount = 512;
+    // The most recent events are kept for traces.
+    static constexpr size_t kEventCount = 8192;
+
+    Profiler::ScopeSlot* slotFor(const char* name)
+    {
+        size_t hash = reinterpret_cast<uintptr_t>(name) >> 3;
+        for (size_t i = 0; i < kSlotCount; ++i)
+        {
+            Profiler::ScopeSlot& slot = slots[(hash + i) % kSlotCount];
+            const char* slotName = slot.name.load(std::memory_order_relaxed);
+            if (slotName == name)
+            {
+                return &slot;
+            }
+            if (slotName == nullptr)
+            {
+                slot.name.store(name, std::memory_order_release);
+                return &slot;
+            }
+        }
+        return nullptr;
+    }
+
+    void addEvent(const char* name, uint64_t start, uint64_t duration)
+    {
+        uint64_t index = eventWriteIndex.load(std::memory_order_relaxed);
+        ProfilerEvent& event = events[index % kEventCount];
+        event.name.store(name, std::memory_order_relaxed);
+        event.startNanoseconds.store(start, std::memory_order_relaxed);
+        event.durationNanoseconds.store(duration, std::memory_order_relaxed);
+        eventWriteIndex.store(index + 1, std::memory_order_release);
+    }
+
+    // Only called by the thread using the buffer, or under the registry lock
+    // while no thread is.
+    void clear()
+    {
+        // Names stay so open scopes keep their slots.
+        for (Profiler::ScopeSlot& slot : slots)
+        {
+            slot.count.store(0, std::memory_order_relaxed);
+            slot.totalNanoseconds.store(0, std::memory_order_relaxed);
+            slot.maxNanoseconds.store(0, std::memory_order_relaxed);
+            slot.allocationCount.store(0, std::memory_order_relaxed);
+            slot.allocatedBytes.store(0, std::memory_order_relaxed);
+        }
+        eventWriteIndex.store(0, std::memory_order_relaxed);
+    }
+
+    uint32_t id = 0;
+    // Last reset applied to the buffer. Queries skip buffers that are behind
+    // until their thread catches up.
+    std::atomic<uint64_t> generation{0};
+    std::atomic<const char*> name{nullptr};
+    Profiler::ScopeSlot* currentSlot = nullptr;
+    Profiler::ScopeSlot slots[kSlotCount];
+    std::unique_ptr<ProfilerEvent[]> events{new ProfilerEvent[kEventCount]};
+    std::atomic<uint64_t> eventWriteIndex{0};
+};
+
+static std::atomic<bool> g_enabled{true};
+static std::atomic<uint64_t> g_frameCount{0};
+// Bumped by reset(), each thread clears its own buffer when it sees it change.
+static std::atomic<uint64_t> g_generation{0};
+
+// Everything below is guarded by the registry mutex.
+static std::mutex& registry_mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+// Buffers outlive their threads so their stats can still be queried, until a
+// new thread takes them over from the free list.
+static std::vector<std::unique_ptr<ProfilerThreadBuffer>>& registry()
+{
+    static std::vector<std::unique_ptr<ProfilerThreadBuffer>> buffers;
+    return buffers;
+}
+
+static std::vector<ProfilerThreadBuffer*>& free_buffers()
+{
+    static std::vector<ProfilerThreadBuffer*> buffers;
+    return buffers;
+}
+
+// Stats of threads whose buffers were taken over by another thread.
+static std::map<std::string, Profiler::ScopeStats>& retired_stats()
+{
+    static std::map<std::string, Profiler::ScopeStats> stats;
+    return stats;
+}
+
+static uint32_t& next_thread_id()
+{
+    static uint32_t id = 0;
+    return id;
+}
+
+static void merge_stats(std::map<std::string, Profiler::ScopeStats>& merged,
+                        const ProfilerThreadBuffer& buffer)
+{
+    for (const Profiler::ScopeSlot& slot : buffer.slots)
+    {
+        const char* name = slot.name.load(std::memory_order_acquire);
+        if (name == nullptr)
+        {
+            continue;
+        }
+        Profiler::ScopeStats& stats = merged[name];
+        stats.count += slot.count.load(std::memory_order_relaxed);
+        stats.totalNanoseconds +=
+            slot.totalNanoseconds.load(std::memory_order_relaxed);
+        stats.maxNanoseconds =
+            std::max(stats.maxNanoseconds,
+                     slot.maxNanoseconds.load(std::memory_order_relaxed));
+        stats.allocationCount +=
+            slot.allocationCount.load(std::memory_order_relaxed);
+        stats.allocatedBytes +=
+            slot.allocatedBytes.load(std::memory_order_relaxed);
+    }
+}
+
+static bool is_current(const ProfilerThreadBuffer& buffer)
+{
+    return buffer.generation.load(std::memory_order_acquire) ==
+           g_generation.load(std::memory_order_acquire);
+}
+
+static ProfilerThreadBuffer* acquire_thread_buffer()
+{
+    std::unique_lock<std::mutex> lock(registry_mutex());
+    ProfilerThreadBuffer* buffer;
+    if (free_buffers().empty())
+    {
+        registry().emplace_back(new ProfilerThreadBuffer());
+        buffer = registry().back().get();
+    }
+    else
+    {
+        buffer = free_buffers().back();
+        free_buffers().pop_back();
+        // Its events go, but its stats still count.
+        if (is_current(*buffer))
+        {
+            merge_stats(retired_stats(), *buffer);
+        }
+        buffer->clear();
+        buffer->name.store(nullptr, std::memory_order_relaxed);
+        buffer->currentSlot = nullptr;
+    }
+    buffer->generation.store(g_generation.load(std::memory_order_relaxed),
+                             std::memory_order_release);
+    buffer->id = ++next_thread_id();
+    return buffer;
+}
+
+// Hands the thread's buffer back when the thread exits, so programs that keep
+// spawning threads reuse a buffer per live thread instead of leaking one per
+// thread.
+struct ProfilerThreadHandle
+{
+    ProfilerThreadBuffer* buffer = nullptr;
+
+    ~ProfilerThreadHandle()
+    {
+        if (buffer != nullptr)
+        {
+            std::unique_lock<std::mutex> lock(registry_mutex());
+            free_buffers().push_back(buffer);
+            buffer = nullptr;
+        }
+    }
+};
+
+static ProfilerThreadBuffer* thread_buffer()
+{
+    // Only the first call on each thread takes the lock.
+    static thread_local ProfilerThreadHandle handle;
+    ProfilerThreadBuffer* buffer = handle.buffer;
+    if (buffer == nullptr)
+    {
+        buffer = handle.buffer = acquire_thread_buffer();
+    }
+    uint64_t generation = g_generation.load(std::memory_order_relaxed);
+    if (buffer->generation.load(std::memory_order_relaxed) != generation)
+    {
+        buffer->clear();
+        buffer->generation.store(generation, std::memory_order_release);
+    }
+    return buffer;
+}
+
+static uint64_t now_nanoseconds()
+{
+    static const auto epoch = std::chrono::steady_clock::now();
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - epoch)
+            .count());
+}
+
+static void write_json_string(std::ostream& out, const char* str)
+{
+    out << '"';
+    for (; *str != '\0'; ++str)
+    {
+        switch (*str)
+        {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            default:
+                if (static_cast<unsigned char>(*str) >= 0x20)
+                {
+                    out << *str;
+                }
+                break;
+        }
+    }
+    out << '"';
+}
+
+Profiler::Scope::Scope(const char* name) :
+    m_slot(nullptr), m_parentSlot(nullptr), m_startNanoseconds(0)
+{
+    if (!g_enabled.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    ProfilerThreadBuffer* buffer = thread_buffer();
+    m_slot = buffer->slotFor(name);
+    if (m_slot == nullptr)
+    {
+        return;
+    }
+    m_parentSlot = buffer->currentSlot;
+    buffer->currentSlot = m_slot;
+    m_startNanoseconds = now_nanoseconds();
+}
+
+Profiler::Scope::~Scope()
+{
+    if (m_slot == nullptr)
+    {
+        return;
+    }
+    uint64_t duration = now_nanoseconds() - m_startNanoseconds;
+    ProfilerThreadBuffer* buffer = thread_buffer();
+    buffer->currentSlot = m_parentSlot;
+
+    m_slot->count.fetch_add(1, std::memory_order_relaxed);
+    m_slot->totalNanoseconds.fetch_add(duration, std::memory_order_relaxed);
+    if (duration > m_slot->maxNanoseconds.load(std::memory_order_relaxed))
+    {
+        m_slot->maxNanoseconds.store(duration, std::memory_order_relaxed);
+    }
+    buffer->addEvent(m_slot->name.load(std::memory_order_relaxed),
+                     m_startNanoseconds,
+                     duration);
+}
+
+void Profiler::enabled(bool value)
+{
+    g_enabled.store(value, std::memory_order_relaxed);
+}
+
+bool Profiler::enabled() { return g_enabled.load(std::memory_order_relaxed); }
+
+void Profiler::frame()
+{
+    if (!g_enabled.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    g_frameCount.fetch_add(1, std::memory_order_relaxed);
+    thread_buffer()->addEvent(kFrameEventName, now_nanoseconds(), 0);
+}
+
+uint64_t Profiler::frameCount()
+{
+    return g_frameCount.load(std::memory_order_relaxed);
+}
+
+void Profiler::threadName(const char* name)
+{
+    thread_buffer()->name.store(name, std::memory_order_relaxed);
+}
+
+void Profiler::recordAllocation(size_t bytes)
+{
+    if (!g_enabled.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    ScopeSlot* slot = thread_buffer()->currentSlot;
+    if (slot != nullptr)
+    {
+        slot->allocationCount.fetch_add(1, std::memory_order_relaxed);
+        slot->allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+}
+
+std::vector<Profiler::ScopeStats> Profiler::stats()
+{
+    // Scopes from different threads are merged by name, the same function
+    // may also have a different name pointer in each translation unit.
+    std::unique_lock<std::mutex> lock(registry_mutex());
+    std::map<std::string, ScopeStats> merged = retired_stats();
+    for (const auto& buffer : registry())
+    {
+        if (is_current(*buffer))
+        {
+            merge_stats(merged, *buffer);
+        }
+    }
+    lock.unlock();
+
+    std::vector<ScopeStats> result;
+    result.reserve(merged.size());
+    for (auto& pair : merged)
+    {
+        if (pair.second.count == 0)
+        {
+            continue;
+        }
+        pair.second.name = pair.first;
+        result.push_back(std::move(pair.second));
+    }
+    std::sort(result.begin(),
+              result.end(),
+              [](const ScopeStats& a, const ScopeStats& b) {
+                  return a.totalNanoseconds > b.totalNanoseconds;
+              });
+    return result;
+}
+
+void Profiler::reset()
+{
+    // Buffers in use are only ever written by their thread, which clears its
+    // own on its next record. Until then queries skip it.
+    std::unique_lock<std::mutex> lock(registry_mutex());
+    uint64_t generation =
+        g_generation.fetch_add(1, std::memory_order_acq_rel) + 1;
+    for (ProfilerThreadBuffer* buffer : free_buffers())
+    {
+        buffer->clear();
+        buffer->generation.store(generation, std::memory_order_release);
+    }
+    retired_stats().clear();
+    g_frameCount.store(0, std::memory_order_relaxed);
+}
+
+#ifdef TESTING
+size_t Profiler::threadBufferCount()
+{
+    std::unique_lock<std::mutex> lock(registry_mutex());
+    return registry().size();
+}
+#endif
+
+std::string Profiler::chromeTraceJSON()
+{
+    std::ostringstream out;
+    // Trace timestamps are in microseconds, keep nanosecond precision.
+    out << std::fixed << std::setprecision(3);
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    auto separator = [&out, &first]() {
+        if (!first)
+        {
+            out << ',';
+        }
+        first = false;
+    };
+
+    std::unique_lock<std::mutex> lock(registry_mutex());
+    for (const auto& buffer : registry())
+    {
+        if (!is_current(*buffer))
+        {
+            continue;
+        }
+        if (const char* name = buffer->name.load(std::memory_order_relaxed))
+        {
+            separator();
+            out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":"
+                << buffer->id << ",\"args\":{\"name\":";
+            write_json_string(out, name);
+            out << "}}";
+        }
+
+        uint64_t end = buffer->eventWriteIndex.load(std::memory_order_acquire);
+        uint64_t begin = end > ProfilerThreadBuffer::kEventCount
+                             ? end - ProfilerThreadBuffer::kEventCount
+                             : 0;
+        for (uint64_t i = begin; i < end; ++i)
+        {
+            const ProfilerEvent& event =
+                buffer->events[i % ProfilerThreadBuffer::kEventCount];
+            const char* name = event.name.load(std::memory_order_relaxed);
+            if (name == nullptr)
+            {
+                continue;
+            }
+            double start =
+                event.startNanoseconds.load(std::memory_order_relaxed) * 1e-3;
+            double duration =
+                event.durationNanoseconds.load(std::memory_order_relaxed) *
+                1e-3;
+            separator();
+            out << "{\"name\":";
+            write_json_string(out, name);
+            if (name == kFrameEventName)
+            {
+                out << ",\"ph\":\"i\",\"s\":\"g\"";
+            }
+            else
+            {
+                out << ",\"ph\":\"X\",\"dur\":" << duration;
+            }
+            out << ",\"pid\":0,\"tid\":" << buffer->id << ",\"ts\":" << start
+                << '}';
+        }
+    }
+    out << "]}";
+    return out.str();
+}
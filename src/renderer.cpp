@@ -1,6 +1,7 @@
 #include "rive/math/mat2d.hpp"
 #include "rive/renderer.hpp"
 #include "rive/text_engine.hpp"
+#include "rive/profiler/profiler_macros.h"
 
 using namespace rive;
 
@@ -146,6 +147,7 @@ SimpleArray<Paragraph> Font::shapeText(Span<const Unichar> text,
                                        Span<const TextRun> runs,
                                        int textDirectionFlag) const
 {
+    RIVE_PROF_SCOPE()
 #ifdef DEBUG
     size_t count = 0;
     for (const TextRun& tr : runs)
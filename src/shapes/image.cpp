@@ -19,6 +19,12 @@ void Image::draw(Renderer* renderer)
         return;
     }
 
+    // Recorded even before the image has loaded, so out of band loaders can
+    // pick a decode size. Includes the renderer's transform, e.g. the view's
+    // fit and device pixel ratio, so the scale is in device pixels.
+    asset->observeDrawScale(
+        (renderer->currentTransform() * worldTransform()).findMaxScale());
+
     rive::RenderImage* renderImage = asset->renderImage();
     if (renderImage == nullptr)
     {
@@ -125,6 +131,10 @@ void Image::assetUpdated()
 {
     updateImageScale();
     markWorldTransformDirty();
+#ifdef WITH_RIVE_LAYOUT
+    // A new image may have a different intrinsic size.
+    markLayoutNodeDirty();
+#endif
 }
 
 Core* Image::clone() const
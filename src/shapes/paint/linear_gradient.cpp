@@ -180,24 +180,41 @@ void LinearGradient::applyTo(RenderPaint* renderPaint, float opacityModifier)
         stops[i] = std::max(0.0f, std::min(m_stops[i]->position(), 1.0f));
     }
 
-    makeGradient(renderPaint, start, end, colors, stops, count);
+    // Keep the shader of our own paint around so the factory can update it
+    // in place instead of making a new one every time the gradient moves.
+    if (renderPaint == ShapePaintMutator::renderPaint())
+    {
+        m_shader = makeGradient(std::move(m_shader),
+                                start,
+                                end,
+                                colors,
+                                stops,
+                                count);
+        renderPaint->shader(m_shader);
+    }
+    else
+    {
+        renderPaint->shader(
+            makeGradient(nullptr, start, end, colors, stops, count));
+    }
 }
 
-void LinearGradient::makeGradient(RenderPaint* renderPaint,
-                                  Vec2D start,
-                                  Vec2D end,
-                                  const ColorInt colors[],
-                                  const float stops[],
-                                  size_t count) const
+rcp<RenderShader> LinearGradient::makeGradient(rcp<RenderShader> shader,
+                                               Vec2D start,
+                                               Vec2D end,
+                                               const ColorInt colors[],
+                                               const float stops[],
+                                               size_t count) const
 {
     auto factory = artboard()->factory();
-    renderPaint->shader(factory->makeLinearGradient(start.x,
-                                                    start.y,
-                                                    end.x,
-                                                    end.y,
-                                                    colors,
-                                                    stops,
-                                                    count));
+    return factory->updateLinearGradient(std::move(shader),
+                                         start.x,
+                                         start.y,
+                                         end.x,
+                                         end.y,
+                                         colors,
+                                         stops,
+                                         count);
 }
 
 void LinearGradient::markGradientDirty() { addDirt(ComponentDirt::Paint); }
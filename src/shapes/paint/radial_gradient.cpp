@@ -4,18 +4,19 @@
 
 using namespace rive;
 
-void RadialGradient::makeGradient(RenderPaint* renderPaint,
-                                  Vec2D start,
-                                  Vec2D end,
-                                  const ColorInt colors[],
-                                  const float stops[],
-                                  size_t count) const
+rcp<RenderShader> RadialGradient::makeGradient(rcp<RenderShader> shader,
+                                               Vec2D start,
+                                               Vec2D end,
+                                               const ColorInt colors[],
+                                               const float stops[],
+                                               size_t count) const
 {
     auto factory = artboard()->factory();
-    renderPaint->shader(factory->makeRadialGradient(start.x,
-                                                    start.y,
-                                                    Vec2D::distance(start, end),
-                                                    colors,
-                                                    stops,
-                                                    count));
+    return factory->updateRadialGradient(std::move(shader),
+                                         start.x,
+                                         start.y,
+                                         Vec2D::distance(start, end),
+                                         colors,
+                                         stops,
+                                         count);
 }
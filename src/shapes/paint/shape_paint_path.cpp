@@ -5,15 +5,24 @@
 
 using namespace rive;
 
-ShapePaintPath::ShapePaintPath(bool isLocal) : m_isLocal(isLocal) {}
+std::atomic<uint64_t> ShapePaintPath::sm_nextRevision{1};
+
+ShapePaintPath::ShapePaintPath(bool isLocal) : m_isLocal(isLocal)
+{
+    changed();
+}
 ShapePaintPath::ShapePaintPath(bool isLocal, FillRule fillRule) :
     m_isLocal(isLocal), m_fillRule(fillRule)
-{}
+{
+    changed();
+}
 
 void ShapePaintPath::rewind()
 {
     m_rawPath.rewind();
     m_isRenderPathDirty = true;
+    m_sharedRenderPath = nullptr;
+    changed();
 }
 
 void ShapePaintPath::addPath(const RawPath& rawPath, const Mat2D* transform)
@@ -21,6 +30,7 @@ void ShapePaintPath::addPath(const RawPath& rawPath, const Mat2D* transform)
     auto iter = m_rawPath.addPath(rawPath, transform);
     m_rawPath.pruneEmptySegments(iter);
     m_isRenderPathDirty = true;
+    changed();
 }
 
 void ShapePaintPath::addPathClockwise(const RawPath& rawPath,
@@ -47,6 +57,7 @@ void ShapePaintPath::addPathBackwards(const RawPath& rawPath,
     auto iter = m_rawPath.addPathBackwards(rawPath, transform);
     m_rawPath.pruneEmptySegments(iter);
     m_isRenderPathDirty = true;
+    changed();
 }
 
 RenderPath* ShapePaintPath::renderPath(const Component* component)
@@ -58,6 +69,10 @@ RenderPath* ShapePaintPath::renderPath(const Component* component)
 RenderPath* ShapePaintPath::renderPath(Factory* factory)
 {
     assert(factory != nullptr);
+    if (m_sharedRenderPath != nullptr)
+    {
+        return m_sharedRenderPath.get();
+    }
     if (!m_renderPath)
     {
         m_renderPath = factory->makeEmptyRenderPath();
@@ -73,4 +88,34 @@ RenderPath* ShapePaintPath::renderPath(Factory* factory)
     }
 
     return m_renderPath.get();
+}
+
+bool ShapePaintPath::shareRenderPath(const ShapePaintPath* source)
+{
+    if (source == this || !source->hasRenderPath() ||
+        source->m_isLocal != m_isLocal || source->m_fillRule != m_fillRule)
+    {
+        m_sharedRenderPath = nullptr;
+        return false;
+    }
+    // Rows that haven't changed since they last matched skip comparing the
+    // points.
+    if (source != m_matchedSource || m_revision != m_matchedRevision ||
+        source->m_revision != m_matchedSourceRevision)
+    {
+#ifdef TESTING
+        geometryComparisons++;
+#endif
+        if (!(source->m_rawPath == m_rawPath))
+        {
+            m_matchedSource = nullptr;
+            m_sharedRenderPath = nullptr;
+            return false;
+        }
+        m_matchedSource = source;
+        m_matchedRevision = m_revision;
+        m_matchedSourceRevision = source->m_revision;
+    }
+    m_sharedRenderPath = source->m_renderPath;
+    return true;
 }
\ No newline at end of file
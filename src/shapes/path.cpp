@@ -120,7 +120,7 @@ bool Path::canDeferPathUpdate()
     // Shape is necessarily forced to update put the paths are, which is why we
     // explicitly also check the shape's path space.
 
-    return m_Shape->canDeferPathUpdate() &&
+    return m_Shape->canDeferRawPathUpdate() &&
            !m_Shape->isFlagged(PathFlags::followPath) &&
            !isFlagged(PathFlags::followPath | PathFlags::clipping);
 }
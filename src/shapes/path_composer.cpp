@@ -41,78 +41,90 @@ void PathComposer::update(ComponentDirt value)
 {
     if (hasDirt(value, ComponentDirt::Path | ComponentDirt::NSlicer))
     {
+        // The raw paths may have changed even if we defer, so the bounds
+        // deciding whether the shape is culled must be recomputed.
+        m_shape->markBoundsDirty();
         if (m_shape->canDeferPathUpdate())
         {
             m_deferredPathDirt = true;
             return;
         }
         m_deferredPathDirt = false;
+        buildPaths();
+    }
+}
 
-        if (m_shape->isFlagged(PathFlags::local))
+void PathComposer::updateDeferred()
+{
+    if (!m_deferredPathDirt)
+    {
+        return;
+    }
+    m_deferredPathDirt = false;
+    buildPaths();
+}
+
+void PathComposer::buildPaths()
+{
+    if (m_shape->isFlagged(PathFlags::local))
+    {
+        m_localPath.rewind();
+        auto world = m_shape->worldTransform();
+        Mat2D inverseWorld = world.invertOrIdentity();
+        // Get all the paths into local shape space.
+        for (auto path : m_shape->paths())
         {
-            m_localPath.rewind();
-            auto world = m_shape->worldTransform();
-            Mat2D inverseWorld = world.invertOrIdentity();
-            // Get all the paths into local shape space.
-            for (auto path : m_shape->paths())
+            if (!path->isHidden() && !path->isCollapsed())
             {
-                if (!path->isHidden() && !path->isCollapsed())
-                {
-                    const auto localTransform =
-                        inverseWorld * path->pathTransform();
-                    m_localPath.addPath(path->rawPath(), &localTransform);
-                }
+                const auto localTransform = inverseWorld * path->pathTransform();
+                m_localPath.addPath(path->rawPath(), &localTransform);
             }
         }
-        if (m_shape->isFlagged(PathFlags::localClockwise))
+    }
+    if (m_shape->isFlagged(PathFlags::localClockwise))
+    {
+        m_localClockwisePath.rewind();
+        auto world = m_shape->worldTransform();
+        Mat2D inverseWorld = world.invertOrIdentity();
+        // Get all the paths into local shape space.
+        for (auto path : m_shape->paths())
         {
-            m_localClockwisePath.rewind();
-            auto world = m_shape->worldTransform();
-            Mat2D inverseWorld = world.invertOrIdentity();
-            // Get all the paths into local shape space.
-            for (auto path : m_shape->paths())
+            if (path->isHidden() || path->isCollapsed())
             {
-                if (path->isHidden() || path->isCollapsed())
-                {
-                    continue;
-                }
-                const auto localTransform =
-                    inverseWorld * path->pathTransform();
+                continue;
+            }
+            const auto localTransform = inverseWorld * path->pathTransform();
 
-                bool isNotClockwise =
-                    path->is<PointsPath>() &&
-                    (localTransform.determinant() *
-                         (path->as<PointsPath>()->isClockwise() ? 1.0f
-                                                                : -1.0f) <
-                     0);
-                bool isHole = path->isHole();
-                // Only draw backwards if values are different
-                if (isNotClockwise != isHole)
-                {
-                    m_localClockwisePath.addPathBackwards(path->rawPath(),
-                                                          &localTransform);
-                }
-                else
-                {
-                    m_localClockwisePath.addPath(path->rawPath(),
-                                                 &localTransform);
-                }
+            bool isNotClockwise =
+                path->is<PointsPath>() &&
+                (localTransform.determinant() *
+                     (path->as<PointsPath>()->isClockwise() ? 1.0f : -1.0f) <
+                 0);
+            bool isHole = path->isHole();
+            // Only draw backwards if values are different
+            if (isNotClockwise != isHole)
+            {
+                m_localClockwisePath.addPathBackwards(path->rawPath(),
+                                                      &localTransform);
+            }
+            else
+            {
+                m_localClockwisePath.addPath(path->rawPath(), &localTransform);
             }
         }
-        if (m_shape->isFlagged(PathFlags::world))
-        {
-            m_worldPath.rewind();
+    }
+    if (m_shape->isFlagged(PathFlags::world))
+    {
+        m_worldPath.rewind();
 
-            for (auto path : m_shape->paths())
+        for (auto path : m_shape->paths())
+        {
+            if (!path->isHidden() && !path->isCollapsed())
             {
-                if (!path->isHidden() && !path->isCollapsed())
-                {
-                    const Mat2D& transform = path->pathTransform();
-                    m_worldPath.addPath(path->rawPath(), &transform);
-                }
+                const Mat2D& transform = path->pathTransform();
+                m_worldPath.addPath(path->rawPath(), &transform);
             }
         }
-        m_shape->markBoundsDirty();
     }
 }
 
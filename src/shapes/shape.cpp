@@ -1,3 +1,4 @@
+#include "rive/artboard.hpp"
 #include "rive/constraints/constraint.hpp"
 #include "rive/hittest_command_path.hpp"
 #include "rive/shapes/deformer.hpp"
@@ -6,7 +7,10 @@
 #include "rive/shapes/shape.hpp"
 #include "rive/shapes/clipping_shape.hpp"
 #include "rive/shapes/paint/blend_mode.hpp"
+#include "rive/shapes/paint/feather.hpp"
+#include "rive/shapes/paint/fill.hpp"
 #include "rive/shapes/paint/shape_paint.hpp"
+#include "rive/shapes/paint/stroke.hpp"
 #include "rive/shapes/path_composer.hpp"
 #include "rive/clip_result.hpp"
 #include "rive/math/contour_measure.hpp"
@@ -32,6 +36,32 @@ bool Shape::isFlagged(PathFlags flags) const
 }
 
 bool Shape::canDeferPathUpdate()
+{
+    if (canDeferRawPathUpdate())
+    {
+        return true;
+    }
+    // Anything reading the composed paths outside of draw (clipping,
+    // feathers, follow path, stroke effects) depends on the composer, so only
+    // shapes without such dependents are allowed to go stale while culled.
+    // Every stroke depends on the composer, but one without an effect only
+    // reads the composed path when drawn.
+    if (isFlagged(PathFlags::clipping | PathFlags::neverDeferUpdate))
+    {
+        return false;
+    }
+    for (auto dependent : m_PathComposer.dependents())
+    {
+        if (!dependent->is<Stroke>() ||
+            dependent->as<Stroke>()->hasStrokeEffect())
+        {
+            return false;
+        }
+    }
+    return isCulled();
+}
+
+bool Shape::canDeferRawPathUpdate()
 {
     auto canDefer =
         renderOpacity() == 0 &&
@@ -50,6 +80,52 @@ bool Shape::canDeferPathUpdate()
     return canDefer;
 }
 
+bool Shape::isCulled()
+{
+    auto artboard = this->artboard();
+    auto cullRect = artboard == nullptr ? nullptr : artboard->worldCullRect();
+    if (cullRect == nullptr)
+    {
+        return false;
+    }
+
+    // Outset the path bounds by what strokes (including miter joins, up to
+    // the renderers' miter limit of 4) and feathers can draw beyond them.
+    constexpr float miterLimit = 4.0f;
+    float outset = 0.0f;
+    for (auto shapePaint : m_ShapePaints)
+    {
+        if (!shapePaint->isVisible())
+        {
+            continue;
+        }
+        float paintOutset = 0.0f;
+        if (shapePaint->is<Stroke>())
+        {
+            auto stroke = shapePaint->as<Stroke>();
+            paintOutset = stroke->thickness() * 0.5f * miterLimit;
+            if (stroke->transformAffectsStroke())
+            {
+                paintOutset *=
+                    std::sqrt(std::abs(worldTransform().determinant()));
+            }
+        }
+        if (auto feather = shapePaint->feather())
+        {
+            paintOutset += feather->strength() * 1.5f +
+                           std::max(std::abs(feather->offsetX()),
+                                    std::abs(feather->offsetY()));
+        }
+        outset = std::max(outset, paintOutset);
+    }
+
+    AABB bounds = worldBounds();
+    return bounds.maxX + outset < cullRect->minX ||
+           bounds.minX - outset > cullRect->maxX ||
+           bounds.maxY + outset < cullRect->minY ||
+           bounds.minY - outset > cullRect->maxY;
+}
+
 void Shape::update(ComponentDirt value)
 {
     Super::update(value);
@@ -91,6 +167,7 @@ float Shape::length()
 
 void Shape::pathChanged()
 {
+    m_hitPolygonDirty = true;
     m_PathComposer.addDirt(ComponentDirt::Path, true);
     for (auto constraint : constraints())
     {
@@ -119,6 +196,9 @@ void Shape::draw(Renderer* renderer)
     {
         return;
     }
+    // The paths may have been deferred while the shape was culled and it
+    // can come back into view (the cull rect moved) without an update.
+    m_PathComposer.updateDeferred();
     ClipResult clipResult = applyClip(renderer);
 
     if (clipResult != ClipResult::emptyClip)
@@ -144,6 +224,28 @@ void Shape::draw(Renderer* renderer)
     }
 }
 
+void Shape::shareRenderPaths(Shape* source,
+                             std::vector<ShapePaintPath*>& shared)
+{
+    if (source->m_ShapePaints.size() != m_ShapePaints.size())
+    {
+        return;
+    }
+    // Compose any deferred paths now, composing them later would drop the
+    // shared RenderPaths.
+    m_PathComposer.updateDeferred();
+    for (size_t i = 0; i < m_ShapePaints.size(); i++)
+    {
+        auto path = m_ShapePaints[i]->pickPath(this);
+        auto sourcePath = source->m_ShapePaints[i]->pickPath(source);
+        if (path != nullptr && sourcePath != nullptr &&
+            path->shareRenderPath(sourcePath))
+        {
+            shared.push_back(path);
+        }
+    }
+}
+
 bool Shape::hitTestAABB(const Vec2D& position)
 {
     return worldBounds().contains(position);
@@ -151,22 +253,54 @@ bool Shape::hitTestAABB(const Vec2D& position)
 
 bool Shape::hitTestHiFi(const Vec2D& position, float hitRadius)
 {
-    auto hitArea = AABB(position.x - hitRadius,
-                        position.y - hitRadius,
-                        position.x + hitRadius,
-                        position.y + hitRadius)
-                       .round();
-    HitTestCommandPath tester(hitArea);
+    if (m_hitPolygonDirty)
+    {
+        m_hitPolygonDirty = false;
+        m_hitPolygon.rewind();
+        for (auto path : m_Paths)
+        {
+            if (!path->isCollapsed())
+            {
+                m_hitPolygon.addPath(path->rawPath(), path->pathTransform());
+            }
+        }
+    }
 
-    for (auto path : m_Paths)
+    FillRule fillRule = FillRule::nonZero;
+    bool foundFill = false;
+    float strokeRadius = 0.0f;
+    for (auto shapePaint : m_ShapePaints)
     {
-        if (!path->isCollapsed())
+        if (!shapePaint->isVisible())
         {
-            tester.setXform(path->pathTransform());
-            path->rawPath().addTo(&tester);
+            continue;
+        }
+        if (shapePaint->is<Fill>() && !foundFill)
+        {
+            foundFill = true;
+            if ((FillRule)shapePaint->as<Fill>()->fillRule() ==
+                FillRule::evenOdd)
+            {
+                fillRule = FillRule::evenOdd;
+            }
+        }
+        else if (shapePaint->is<Stroke>())
+        {
+            auto stroke = shapePaint->as<Stroke>();
+            float radius = stroke->thickness() * 0.5f;
+            if (stroke->transformAffectsStroke())
+            {
+                radius *= std::sqrt(std::abs(worldTransform().determinant()));
+            }
+            strokeRadius = std::max(strokeRadius, radius);
         }
     }
-    return tester.wasHit();
+
+    // The interior always counts (even for stroke only shapes) so that
+    // outlines are easy to hit.
+    return m_hitPolygon.testFill(position, hitRadius, fillRule) ||
+           (strokeRadius > 0.0f &&
+            m_hitPolygon.testStroke(position, strokeRadius + hitRadius));
 }
 
 Core* Shape::hitTest(HitInfo* hinfo, const Mat2D& xform)
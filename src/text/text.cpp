@@ -12,6 +12,7 @@ using namespace rive;
 #include "rive/artboard.hpp"
 #include "rive/factory.hpp"
 #include "rive/clip_result.hpp"
+#include "rive/memory_usage.hpp"
 #include <limits>
 
 Vec2D Text::measureLayout(float width,
@@ -945,6 +946,52 @@ void Text::originYChanged()
     markWorldTransformDirty();
 }
 
+static size_t glyphRunBytes(const GlyphRun& run)
+{
+    return run.glyphs.size() * sizeof(GlyphID) +
+           run.textIndices.size() * sizeof(uint32_t) +
+           run.advances.size() * sizeof(float) +
+           run.xpos.size() * sizeof(float) +
+           run.offsets.size() * sizeof(Vec2D) +
+           run.breaks.size() * sizeof(uint32_t);
+}
+
+static size_t paragraphsBytes(const SimpleArray<Paragraph>& paragraphs)
+{
+    size_t bytes = paragraphs.size() * sizeof(Paragraph);
+    for (const Paragraph& paragraph : paragraphs)
+    {
+        bytes += paragraph.runs.size() * sizeof(GlyphRun);
+        for (const GlyphRun& run : paragraph.runs)
+        {
+            bytes += glyphRunBytes(run);
+        }
+    }
+    return bytes;
+}
+
+static size_t linesBytes(const SimpleArray<SimpleArray<GlyphLine>>& lines)
+{
+    size_t bytes = lines.size() * sizeof(SimpleArray<GlyphLine>);
+    for (const SimpleArray<GlyphLine>& paragraphLines : lines)
+    {
+        bytes += paragraphLines.size() * sizeof(GlyphLine);
+    }
+    return bytes;
+}
+
+size_t Text::shapedTextBytes() const
+{
+    return MemoryUsage::vectorBytes(m_styledText.unichars()) +
+           MemoryUsage::vectorBytes(m_styledText.runs()) +
+           MemoryUsage::vectorBytes(m_modifierStyledText.unichars()) +
+           MemoryUsage::vectorBytes(m_modifierStyledText.runs()) +
+           paragraphsBytes(m_shape) + paragraphsBytes(m_modifierShape) +
+           linesBytes(m_lines) + linesBytes(m_modifierLines) +
+           MemoryUsage::vectorBytes(m_orderedLines) +
+           glyphRunBytes(m_ellipsisRun);
+}
+
 #else
 // Text disabled.
 void Text::draw(Renderer* renderer) {}
@@ -963,6 +1010,7 @@ void Text::heightChanged() {}
 void Text::markPaintDirty() {}
 void Text::modifierShapeDirty() {}
 bool Text::modifierRangesNeedShape() const { return false; }
+size_t Text::shapedTextBytes() const { return 0; }
 const TextStylePaint* Text::styleFromShaperId(uint16_t id) const
 {
     return nullptr;
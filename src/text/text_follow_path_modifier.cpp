@@ -89,6 +89,7 @@ void TextFollowPathModifier::modifierShapeDirty()
 
 void TextFollowPathModifier::reset(const Mat2D* inverseText)
 {
+    m_pathCursor = PathMeasure::Cursor();
     if (m_Target == nullptr)
     {
         m_pathMeasure = PathMeasure();
@@ -132,7 +133,7 @@ TransformComponents TextFollowPathModifier::transformGlyph(
     // Render along the tangent if overflowing on either ends
     if ((!canWrap && positionOnPath.x < 0) || startPct == endPct)
     {
-        auto result = m_pathMeasure.atPercentage(startPct);
+        auto result = m_pathMeasure.atPercentage(startPct, &m_pathCursor);
         tangent = result.tan;
         tangent = tangent.normalized();
         Vec2D zeroPosition = result.pos;
@@ -142,7 +143,7 @@ TransformComponents TextFollowPathModifier::transformGlyph(
     }
     else if (!canWrap && positionOnPath.x > validLength)
     {
-        auto result = m_pathMeasure.atPercentage(endPct);
+        auto result = m_pathMeasure.atPercentage(endPct, &m_pathCursor);
         tangent = result.tan;
         tangent = tangent.normalized();
         Vec2D termPosition = result.pos;
@@ -154,8 +155,9 @@ TransformComponents TextFollowPathModifier::transformGlyph(
     {
         // Closed path, or in the range of the path.
         // Use the percentage API to wrap around
-        auto result = m_pathMeasure.atPercentage(startPct +
-                                                 positionOnPath.x / pathLength);
+        auto result =
+            m_pathMeasure.atPercentage(startPct + positionOnPath.x / pathLength,
+                                       &m_pathCursor);
         position = result.pos;
         tangent = result.tan;
         tangent = tangent.normalized();
@@ -19,9 +19,16 @@ ViewModel::~ViewModel()
 
 void ViewModel::addProperty(ViewModelProperty* property)
 {
+    m_PropertyIndices.emplace(property->name(), m_Properties.size());
     m_Properties.push_back(property);
 }
 
+int ViewModel::propertyIndex(const std::string& name) const
+{
+    auto itr = m_PropertyIndices.find(name);
+    return itr == m_PropertyIndices.end() ? -1 : (int)itr->second;
+}
+
 ViewModelProperty* ViewModel::property(size_t index)
 {
     if (index < m_Properties.size())
@@ -33,14 +40,8 @@ ViewModelProperty* ViewModel::property(size_t index)
 
 ViewModelProperty* ViewModel::property(const std::string& propName)
 {
-    for (auto property : m_Properties)
-    {
-        if (property->name() == propName)
-        {
-            return property;
-        }
-    }
-    return nullptr;
+    auto index = propertyIndex(propName);
+    return index < 0 ? nullptr : m_Properties[index];
 }
 
 ViewModelProperty* ViewModel::property(const SymbolType symbolType)
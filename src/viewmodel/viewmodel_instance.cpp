@@ -29,13 +29,36 @@ ViewModelInstance::~ViewModelInstance()
 void ViewModelInstance::addValue(ViewModelInstanceValue* value)
 {
     m_PropertyValues.push_back(value);
+    if (value == nullptr)
+    {
+        return;
+    }
+    auto id = value->viewModelPropertyId();
+    if (id >= kMaxIndexedPropertyId)
+    {
+        return;
+    }
+    if (id >= m_PropertyValuesById.size())
+    {
+        m_PropertyValuesById.resize(id + 1, nullptr);
+    }
+    // Like the linear lookup this replaces, the first value with an id wins.
+    if (m_PropertyValuesById[id] == nullptr)
+    {
+        m_PropertyValuesById[id] = value;
+    }
 }
 
 ViewModelInstanceValue* ViewModelInstance::propertyValue(const uint32_t id)
 {
+    if (id < kMaxIndexedPropertyId)
+    {
+        return id < m_PropertyValuesById.size() ? m_PropertyValuesById[id]
+                                                : nullptr;
+    }
     for (auto value : m_PropertyValues)
     {
-        if (value->viewModelPropertyId() == id)
+        if (value != nullptr && value->viewModelPropertyId() == id)
         {
             return value;
         }
@@ -88,15 +111,23 @@ ViewModelInstanceValue* ViewModelInstance::propertyValue(
 ViewModelInstanceValue* ViewModelInstance::propertyValue(
     const std::string& name)
 {
-    auto viewModelProperty = viewModel()->property(name);
-    if (viewModelProperty != nullptr)
+    auto index = viewModel()->propertyIndex(name);
+    if (index < 0)
     {
-        for (auto value : m_PropertyValues)
+        return nullptr;
+    }
+    auto viewModelProperty = viewModel()->property((size_t)index);
+    auto value = propertyValue((uint32_t)index);
+    if (value != nullptr && value->viewModelProperty() == viewModelProperty)
+    {
+        return value;
+    }
+    for (auto value : m_PropertyValues)
+    {
+        if (value != nullptr &&
+            value->viewModelProperty() == viewModelProperty)
         {
-            if (value->viewModelProperty() == viewModelProperty)
-            {
-                return value;
-            }
+            return value;
         }
     }
     return nullptr;
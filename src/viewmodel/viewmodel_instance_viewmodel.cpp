@@ -3,11 +3,19 @@
 #include <array>
 
 #include "rive/viewmodel/viewmodel_instance_viewmodel.hpp"
+#include "rive/data_bind/data_context.hpp"
 
 using namespace rive;
 
 ViewModelInstanceViewModel::~ViewModelInstanceViewModel() {}
 
+void ViewModelInstanceViewModel::referenceViewModelInstance(
+    rcp<ViewModelInstance> value)
+{
+    m_referenceViewModelInstance = value;
+    DataContext::referencesChanged();
+}
+
 void ViewModelInstanceViewModel::setRoot(rcp<ViewModelInstance> value)
 {
     Super::setRoot(value);
@@ -43,6 +43,10 @@ public:
     void restore() override;
     void transform(const Mat2D& transform) override;
     const Mat2D& transform() { return m_Stack.back().transform; }
+    Mat2D currentTransform() const override
+    {
+        return m_Stack.back().transform;
+    }
     void clipPath(RenderPath* path) override;
     void drawImage(const RenderImage*,
                    ImageSampler,
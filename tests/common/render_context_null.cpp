@@ -21,6 +21,7 @@ RenderContextNULL::RenderContextNULL()
     m_platformFeatures.supportsRasterOrdering = true;
     m_platformFeatures.supportsFragmentShaderAtomics = true;
     m_platformFeatures.supportsClockwiseAtomicRendering = true;
+    m_platformFeatures.gradTextureIsPersistent = true;
 }
 
 class BufferRingNULL : public BufferRing
@@ -43,6 +43,15 @@ do
     end
 end
 
+rive_tools_project('replay', 'RiveTool')
+do
+    files({
+        'replay/replay.cpp',
+        RIVE_RUNTIME_DIR .. '/utils/no_op_factory.cpp',
+        RIVE_RUNTIME_DIR .. '/utils/serialized_stream_replayer.cpp',
+    })
+end
+
 rive_tools_project('command_buffer_example', 'RiveTool')
 do
     files({
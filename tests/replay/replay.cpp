@@ -0,0 +1,146 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+// Replays a .sriv stream captured by SerializingFactory (e.g. the silvers
+// written by the unit tests) against a renderer and reports throughput. This
+// measures renderer cost on recorded frames, independently of animation.
+//
+//   replay [--backend <noop|null|gl|vk|...>] [--duration <seconds>] <.sriv>
+
+// Don't compile this file as part of the "tests" project.
+#ifndef TESTING
+
+#include "common/testing_window.hpp"
+#include "rive/renderer.hpp"
+#include "utils/no_op_factory.hpp"
+#include "utils/no_op_renderer.hpp"
+#include "utils/serialized_stream_replayer.hpp"
+#include <chrono>
+#include <fstream>
+#include <stdio.h>
+#include <string.h>
+
+using namespace rive;
+
+int main(int argc, const char* argv[])
+{
+    using clock = std::chrono::high_resolution_clock;
+
+    const char* srivName = nullptr;
+    const char* backendName = "noop";
+    double durationSeconds = 5;
+    for (int i = 1; i < argc; ++i)
+    {
+        if ((strcmp(argv[i], "--backend") == 0 || strcmp(argv[i], "-b") == 0) &&
+            i + 1 < argc)
+        {
+            backendName = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--duration") == 0 ||
+                  strcmp(argv[i], "-d") == 0) &&
+                 i + 1 < argc)
+        {
+            durationSeconds = atof(argv[++i]);
+        }
+        else
+        {
+            srivName = argv[i];
+        }
+    }
+    if (srivName == nullptr)
+    {
+        fprintf(stderr,
+                "Usage:\n\nreplay [--backend <noop|null|gl|vk|...>] "
+                "[--duration <seconds>] <file.sriv>\n");
+        return 1;
+    }
+
+    std::ifstream srivStream(srivName, std::ios::binary);
+    std::vector<uint8_t> srivBytes(
+        (std::istreambuf_iterator<char>(srivStream)),
+        std::istreambuf_iterator<char>());
+    SerializedStreamReplayer replayer;
+    if (!replayer.load(srivBytes))
+    {
+        fprintf(stderr, "failed to load %s\n", srivName);
+        return 1;
+    }
+    uint32_t width = std::max(replayer.frameWidth(), 1u);
+    uint32_t height = std::max(replayer.frameHeight(), 1u);
+
+    // "noop" exercises only the replayer and the runtime's abstract
+    // interfaces. Anything else is a TestingWindow backend ("null" is
+    // RiveRenderer on RenderContextNULL).
+    bool noop = strcmp(backendName, "noop") == 0;
+    NoOpFactory noopFactory;
+    Factory* factory = &noopFactory;
+    if (!noop)
+    {
+        TestingWindow::BackendParams backendParams;
+        auto backend = TestingWindow::ParseBackend(backendName, &backendParams);
+        TestingWindow::Init(backend,
+                            backendParams,
+                            TestingWindow::Visibility::headless);
+        TestingWindow::Get()->resize(width, height);
+        factory = TestingWindow::Get()->factory();
+    }
+
+    auto replayAll = [&]() {
+        replayer.reset();
+        for (size_t i = 0; i < replayer.frameCount(); ++i)
+        {
+            if (noop)
+            {
+                NoOpRenderer renderer;
+                replayer.replayFrame(i, factory, &renderer);
+            }
+            else
+            {
+                auto renderer = TestingWindow::Get()->beginFrame(
+                    {.clearColor = 0xffffffff});
+                replayer.replayFrame(i, factory, renderer.get());
+                TestingWindow::Get()->endFrame();
+            }
+        }
+    };
+
+    // Warm up caches and lazily created GPU resources before timing.
+    replayAll();
+
+    size_t passes = 0;
+    clock::time_point start = clock::now();
+    clock::time_point quitTime =
+        start + std::chrono::duration_cast<clock::duration>(
+                    std::chrono::duration<double>(durationSeconds));
+    clock::time_point end;
+    do
+    {
+        replayAll();
+        ++passes;
+        end = clock::now();
+    } while (end < quitTime);
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double frames = (double)(passes * replayer.frameCount());
+    double draws = (double)(passes * replayer.totalDrawCount());
+    printf("%s: %zu frames, %zu draws, %ux%u on %s\n",
+           srivName,
+           replayer.frameCount(),
+           replayer.totalDrawCount(),
+           width,
+           height,
+           backendName);
+    printf("%.1f frames/s  %.0f draws/s  (%.4gms/frame)\n",
+           frames / seconds,
+           draws / seconds,
+           seconds * 1e3 / frames);
+
+    if (!noop)
+    {
+        TestingWindow::Destroy();
+    }
+    return 0;
+}
+
+#endif
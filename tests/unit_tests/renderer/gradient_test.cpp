@@ -0,0 +1,115 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#include "gradient.hpp"
+#include <catch.hpp>
+
+namespace rive::gpu
+{
+TEST_CASE("interned gradients share ramps", "[gradient]")
+{
+    GradientRampInterner interner;
+    ColorInt colors[] = {0xffff0000, 0xff0000ff};
+    float stops[] = {0, 1};
+    auto a = Gradient::MakeLinear(0, 0, 10, 0, colors, stops, 2, &interner);
+    auto b = Gradient::MakeLinear(5, 5, 0, 20, colors, stops, 2, &interner);
+    auto c = Gradient::MakeRadial(5, 5, 10, colors, stops, 2, &interner);
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    REQUIRE(c != nullptr);
+    CHECK(a->ramp() == b->ramp());
+    CHECK(a->ramp() == c->ramp());
+    CHECK(interner.size() == 1);
+
+    // Stops are normalized before interning, so these share a ramp too.
+    float innerStops[] = {.25f, .75f};
+    auto d =
+        Gradient::MakeLinear(0, 0, 10, 0, colors, innerStops, 2, &interner);
+    CHECK(d->ramp() == a->ramp());
+    CHECK(d->coeffs()[0] == Approx(1 / 5.f));
+    CHECK(d->coeffs()[2] == Approx(-2.5f / 5.f));
+
+    ColorInt otherColors[] = {0xffff0000, 0x8000ff00};
+    auto e =
+        Gradient::MakeLinear(0, 0, 10, 0, otherColors, stops, 2, &interner);
+    CHECK(e->ramp() != a->ramp());
+    CHECK(a->isOpaque());
+    CHECK(!e->isOpaque());
+
+    // Without an interner every gradient gets its own ramp.
+    auto f = Gradient::MakeLinear(0, 0, 10, 0, colors, stops, 2);
+    CHECK(f->ramp() != a->ramp());
+    CHECK(f->ramp()->equals(colors, stops, 2));
+    CHECK(f->ramp()->hash() == a->ramp()->hash());
+}
+
+TEST_CASE("interner drops ramps no gradient uses", "[gradient]")
+{
+    GradientRampInterner interner;
+    float stops[] = {0, 1};
+    for (ColorInt i = 0; i < 1000; ++i)
+    {
+        ColorInt colors[] = {0xff000000 | i, 0xffffffff};
+        interner.intern(colors, stops, 2);
+    }
+    CHECK(interner.size() < 1000);
+
+    ColorInt colors[] = {0xff000000, 0xffffffff};
+    auto kept = Gradient::MakeLinear(0, 0, 10, 0, colors, stops, 2, &interner);
+    CHECK(kept->ramp()->gradientCount() == 1);
+    // A ref that isn't a gradient doesn't keep the ramp interned.
+    ColorInt otherColors[] = {0xff0000ff, 0xffffffff};
+    auto unused = interner.intern(otherColors, stops, 2);
+    for (ColorInt i = 1; i < 1000; ++i)
+    {
+        ColorInt colors[] = {0xff000000 | i, 0xffffffff};
+        interner.intern(colors, stops, 2);
+    }
+    CHECK(interner.intern(colors, stops, 2).get() == kept->ramp());
+    CHECK(interner.intern(otherColors, stops, 2) != unused);
+
+    // Updating moves the gradient's use to its new ramp.
+    const GradientRamp* ramp = kept->ramp();
+    CHECK(kept->updateLinear(0, 0, 10, 0, otherColors, stops, 2, &interner));
+    CHECK(ramp->gradientCount() == 0);
+    CHECK(kept->ramp()->gradientCount() == 1);
+}
+
+TEST_CASE("gradients update in place", "[gradient]")
+{
+    GradientRampInterner interner;
+    ColorInt colors[] = {0xffff0000, 0xff0000ff};
+    float stops[] = {0, 1};
+    auto linear =
+        Gradient::MakeLinear(0, 0, 10, 0, colors, stops, 2, &interner);
+    const GradientRamp* ramp = linear->ramp();
+
+    CHECK(linear->updateLinear(0, 0, 0, 20, colors, stops, 2, &interner));
+    CHECK(linear->coeffs()[0] == 0);
+    CHECK(linear->coeffs()[1] == Approx(1 / 20.f));
+    CHECK(linear->ramp() == ramp);
+
+    ColorInt newColors[] = {0xff00ff00, 0xff0000ff, 0xffff0000};
+    float newStops[] = {0, .5f, 1};
+    CHECK(linear->updateLinear(0, 0, 0, 20, newColors, newStops, 3));
+    CHECK(linear->count() == 3);
+    CHECK(linear->colors()[0] == 0xff00ff00);
+
+    // A linear gradient can't become radial, and invalid stops are rejected.
+    CHECK(!linear->updateRadial(0, 0, 10, colors, stops, 2));
+    float badStops[] = {1, 0};
+    CHECK(!linear->updateLinear(0, 0, 0, 20, colors, badStops, 2));
+    CHECK(linear->count() == 3);
+
+    // Pending draws lock the gradient.
+    auto radial = Gradient::MakeRadial(0, 0, 10, colors, stops, 2);
+    radial->lockMutations();
+    CHECK(!radial->updateRadial(5, 5, 20, colors, stops, 2));
+    CHECK(radial->coeffs()[2] == 10);
+    radial->unlockMutations();
+    CHECK(radial->updateRadial(5, 5, 20, colors, stops, 2));
+    CHECK(radial->coeffs()[0] == 5);
+    CHECK(radial->coeffs()[2] == 20);
+}
+} // namespace rive::gpu
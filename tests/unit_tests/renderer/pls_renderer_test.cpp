@@ -1321,4 +1321,153 @@ TEST_CASE("null-render-texture", "RiveRenderer")
     // If we don't crash, the test passed.
     CHECK(nullTextureImage->getTexture() == nullptr);
 }
+
+// Checks that gradients only update in place once the draws referencing them
+// have been flushed.
+TEST_CASE("gradient-updates", "RiveRenderer")
+{
+    std::unique_ptr<RenderContext> renderContext =
+        RenderContextNULL::MakeContext();
+    auto renderTarget =
+        renderContext->static_impl_cast<RenderContextNULL>()->makeRenderTarget(
+            s_frameDescriptor.renderTargetWidth,
+            s_frameDescriptor.renderTargetHeight);
+
+    ColorInt colors[] = {0xffff0000, 0xff00ff00, 0xff0000ff};
+    float stops[] = {0, .5f, 1};
+    float simpleStops[] = {0, 1};
+    auto complexGrad =
+        renderContext->makeLinearGradient(0, 0, 10, 0, colors, stops, 3);
+    auto simpleGrad =
+        renderContext->makeRadialGradient(5, 5, 5, colors, simpleStops, 2);
+
+    auto path = renderContext->makeEmptyRenderPath();
+    path->moveTo(0, 0);
+    path->lineTo(10, 0);
+    path->lineTo(10, 10);
+    auto complexPaint = renderContext->makeRenderPaint();
+    complexPaint->shader(complexGrad);
+    auto simplePaint = renderContext->makeRenderPaint();
+    simplePaint->shader(simpleGrad);
+
+    for (int i = 0; i < 2; ++i)
+    {
+        renderContext->beginFrame(s_frameDescriptor);
+        RiveRenderer renderer(renderContext.get());
+        renderer.drawPath(path.get(), complexPaint.get());
+        renderer.drawPath(path.get(), simplePaint.get());
+
+        // Pending draws still read the gradient, so it can't change yet.
+        auto moved = renderContext->updateLinearGradient(complexGrad,
+                                                         0,
+                                                         0,
+                                                         20,
+                                                         0,
+                                                         colors,
+                                                         stops,
+                                                         3);
+        CHECK(moved != complexGrad);
+
+        renderContext->flush({.renderTarget = renderTarget.get()});
+    }
+
+    // Once flushed, the gradient updates in place.
+    auto moved = renderContext->updateLinearGradient(complexGrad,
+                                                     0,
+                                                     0,
+                                                     20,
+                                                     0,
+                                                     colors,
+                                                     stops,
+                                                     3);
+    CHECK(moved == complexGrad);
+}
+
+// Checks that complex color ramps keep their row in the gradient texture across
+// frames, and are only rendered into it again once they lose it.
+TEST_CASE("gradient-ramp-rows", "RiveRenderer")
+{
+    std::unique_ptr<RenderContext> renderContext =
+        RenderContextNULL::MakeContext();
+    auto renderTarget =
+        renderContext->static_impl_cast<RenderContextNULL>()->makeRenderTarget(
+            s_frameDescriptor.renderTargetWidth,
+            s_frameDescriptor.renderTargetHeight);
+
+    auto path = renderContext->makeEmptyRenderPath();
+    path->moveTo(0, 0);
+    path->lineTo(10, 0);
+    path->lineTo(10, 10);
+
+    ColorInt colors[] = {0xffff0000, 0xff00ff00, 0xff0000ff};
+    float stops[] = {0, .5f, 1};
+    auto linearPaint = renderContext->makeRenderPaint();
+    linearPaint->shader(
+        renderContext->makeLinearGradient(0, 0, 10, 0, colors, stops, 3));
+    // A different gradient with the same color ramp.
+    auto radialPaint = renderContext->makeRenderPaint();
+    radialPaint->shader(
+        renderContext->makeRadialGradient(5, 5, 5, colors, stops, 3));
+
+    auto drawFrame = [&](std::initializer_list<RenderPaint*> paints) {
+        renderContext->beginFrame(s_frameDescriptor);
+        RiveRenderer renderer(renderContext.get());
+        for (RenderPaint* paint : paints)
+        {
+            renderer.drawPath(path.get(), paint);
+        }
+        renderContext->flush({.renderTarget = renderTarget.get()});
+    };
+
+    const auto& stats = renderContext->gradientRampStats();
+    drawFrame({linearPaint.get()});
+    CHECK(stats.misses == 1);
+    CHECK(stats.hits == 0);
+    CHECK(stats.uploadedRamps == 1);
+    CHECK(stats.uploadedSpans == 2);
+
+    // The unchanged ramp is still in the texture, so nothing gets uploaded.
+    drawFrame({linearPaint.get(), radialPaint.get()});
+    CHECK(stats.misses == 1);
+    CHECK(stats.hits == 1);
+    CHECK(stats.uploadedRamps == 1);
+    CHECK(stats.uploadedSpans == 2);
+
+    // Releasing resources drops the texture, and every row with it.
+    renderContext->releaseResources();
+    drawFrame({radialPaint.get()});
+    CHECK(stats.misses == 2);
+    CHECK(stats.hits == 1);
+    CHECK(stats.uploadedRamps == 2);
+    CHECK(stats.uploadedSpans == 4);
+
+    // Run out of rows within a single frame. The draw that can't get one
+    // triggers a logical flush, after which the least recently used ramp gets
+    // evicted.
+    constexpr static uint32_t kRampCount = 1025;
+    std::vector<rcp<RenderPaint>> paints;
+    renderContext->beginFrame(s_frameDescriptor);
+    {
+        RiveRenderer renderer(renderContext.get());
+        for (uint32_t i = 0; i < kRampCount; ++i)
+        {
+            ColorInt uniqueColors[] = {0xff000000 | i, 0xffffffff, 0xff000000};
+            auto paint = renderContext->makeRenderPaint();
+            paint->shader(renderContext->makeLinearGradient(0,
+                                                            0,
+                                                            10,
+                                                            0,
+                                                            uniqueColors,
+                                                            stops,
+                                                            3));
+            renderer.drawPath(path.get(), paint.get());
+            paints.push_back(std::move(paint));
+        }
+    }
+    renderContext->flush({.renderTarget = renderTarget.get()});
+    CHECK(stats.misses == 2 + kRampCount);
+    CHECK(stats.evictions == 2);
+    CHECK(stats.uploadedRamps == 2 + kRampCount);
+    CHECK(stats.uploadedSpans == 4 + kRampCount * 2);
+}
 } // namespace rive::gpu
@@ -2,6 +2,7 @@
 #include "rive/audio/audio_source.hpp"
 #include "rive/audio/audio_sound.hpp"
 #include "rive/audio/audio_reader.hpp"
+#include "rive/audio/offline_mixer.hpp"
 #include "rive/audio_event.hpp"
 #include "rive/assets/audio_asset.hpp"
 #include "rive_file_reader.hpp"
@@ -230,4 +231,212 @@ TEST_CASE("Artboard does not have audio", "[audio]")
     REQUIRE(artboard->hasAudio() == false);
 }
 
+TEST_CASE("offline audio engine mixes sounds on exact frames", "[audio]")
+{
+    rcp<AudioEngine> engine = AudioEngine::MakeOffline(2, 44100, 2);
+    REQUIRE(engine->isOffline());
+    CHECK(engine->channels() == 2);
+    CHECK(engine->sampleRate() == 44100);
+
+    std::vector<float> samples(16 * 2);
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        samples[i] = (float)(i + 1);
+    }
+    rcp<AudioSource> source =
+        rcp<AudioSource>(new AudioSource(Span<float>(samples), 2, 44100));
+
+    REQUIRE(engine->playOffline(source, 0));
+    REQUIRE(engine->playOffline(source, 5, 0.5f));
+    // Both voices are busy.
+    CHECK(!engine->playOffline(source, 0));
+
+    float frames[32 * 2];
+    engine->renderFrames(frames, 32);
+    CHECK(engine->timeInFrames() == 32);
+    for (int frame = 0; frame < 32; frame++)
+    {
+        for (int channel = 0; channel < 2; channel++)
+        {
+            float expected = 0.0f;
+            if (frame < 16)
+            {
+                expected += samples[frame * 2 + channel];
+            }
+            if (frame >= 5 && frame < 21)
+            {
+                expected += samples[(frame - 5) * 2 + channel] * 0.5f;
+            }
+            CHECK(frames[frame * 2 + channel] == expected);
+        }
+    }
+
+    // Finished sounds give their voices back.
+    REQUIRE(engine->playOffline(source, engine->timeInFrames() + 40));
+    engine->renderFrames(frames, 32);
+    for (float sample : frames)
+    {
+        CHECK(sample == 0.0f);
+    }
+    engine->renderFrames(frames, 32);
+    CHECK(frames[8 * 2] == samples[0]);
+    CHECK(frames[8 * 2 - 1] == 0.0f);
+}
+
+TEST_CASE("offline audio engine honors sound start and end times", "[audio]")
+{
+    rcp<AudioEngine> engine = AudioEngine::MakeOffline(2, 44100, 2);
+
+    std::vector<float> samples(16 * 2);
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        samples[i] = (float)(i + 1);
+    }
+    rcp<AudioSource> source =
+        rcp<AudioSource>(new AudioSource(Span<float>(samples), 2, 44100));
+
+    // Starts 4 frames into the sound at frame 2 and stops at frame 8.
+    CHECK(engine->play(source, 2, 8, 4) == nullptr);
+    // Ends before it starts.
+    CHECK(engine->play(source, 8, 8, 0) == nullptr);
+
+    float frames[32 * 2];
+    engine->renderFrames(frames, 32);
+    for (int frame = 0; frame < 32; frame++)
+    {
+        for (int channel = 0; channel < 2; channel++)
+        {
+            float expected = 0.0f;
+            if (frame >= 2 && frame < 8)
+            {
+                expected = samples[(frame - 2 + 4) * 2 + channel];
+            }
+            CHECK(frames[frame * 2 + channel] == expected);
+        }
+    }
+
+    // Starting past the end of the sound plays nothing, so neither this nor
+    // the sound that ended before it started holds on to a voice.
+    engine->play(source, engine->timeInFrames(), 0, 16);
+    CHECK(engine->playOffline(source, 0));
+    CHECK(engine->playOffline(source, 0));
+    CHECK(!engine->playOffline(source, 0));
+}
+
+TEST_CASE("offline audio engine stops sounds per artboard", "[audio]")
+{
+    rcp<AudioEngine> engine = AudioEngine::MakeOffline(2, 44100, 3);
+
+    std::vector<float> samples(1024 * 2, 1.0f);
+    rcp<AudioSource> source =
+        rcp<AudioSource>(new AudioSource(Span<float>(samples), 2, 44100));
+
+    auto file = ReadRiveFile("assets/sound.riv");
+    auto artboard = file->artboardDefault();
+    artboard->audioEngine(engine);
+    auto artboard2 = file->artboardDefault();
+    artboard2->audioEngine(engine);
+
+    REQUIRE(engine->playOffline(source, 0, 1.0f, artboard.get()));
+    REQUIRE(engine->playOffline(source, 0, 1.0f, artboard2.get()));
+
+    float frames[256 * 2];
+    engine->renderFrames(frames, 256);
+    CHECK(frames[0] == 2.0f);
+    CHECK(frames[511] == 2.0f);
+
+    engine->stop(artboard.get());
+    engine->renderFrames(frames, 256);
+    CHECK(frames[0] == 1.0f);
+    CHECK(frames[511] == 1.0f);
+
+    // Audio events on artboards with an offline engine play through it,
+    // taking the last voice.
+    auto audioEvent = artboard2->find<AudioEvent>()[0];
+    REQUIRE(audioEvent->asset()->hasAudioSource());
+    REQUIRE(engine->playOffline(source, 0));
+    audioEvent->play();
+    CHECK(!engine->playOffline(source, 0));
+
+    // Deleting an artboard stops its sounds.
+    artboard2 = nullptr;
+    engine->renderFrames(frames, 256);
+    CHECK(frames[0] == 1.0f);
+    CHECK(frames[511] == 1.0f);
+    CHECK(engine->playOffline(source, 0));
+}
+
+TEST_CASE("offline audio engine keeps stops sent between renders",
+          "[audio]")
+{
+    rcp<AudioEngine> engine = AudioEngine::MakeOffline(2, 44100, 2);
+
+    std::vector<float> samples(1024 * 2, 1.0f);
+    rcp<AudioSource> source =
+        rcp<AudioSource>(new AudioSource(Span<float>(samples), 2, 44100));
+
+    auto file = ReadRiveFile("assets/sound.riv");
+    auto artboard = file->artboardDefault();
+    auto artboard2 = file->artboardDefault();
+
+    REQUIRE(engine->playOffline(source, 0, 1.0f, artboard.get()));
+    REQUIRE(engine->playOffline(source, 0, 1.0f, artboard2.get()));
+    // Far more stops than voices, none of which may be dropped.
+    for (int i = 0; i < 100; i++)
+    {
+        engine->stop(artboard2.get());
+    }
+    engine->stop(artboard.get());
+
+    float frames[256 * 2];
+    engine->renderFrames(frames, 256);
+    for (float sample : frames)
+    {
+        CHECK(sample == 0.0f);
+    }
+
+    // Stops only reach sounds played before them.
+    REQUIRE(engine->playOffline(source, 0, 1.0f, artboard.get()));
+    engine->renderFrames(frames, 256);
+    CHECK(frames[0] == 1.0f);
+}
+
+TEST_CASE("offline mixer evicts idle clips", "[audio]")
+{
+    OfflineMixer mixer(2, 44100, 2);
+
+    std::vector<float> samples(64 * 2, 1.0f);
+    std::vector<rcp<AudioSource>> sources;
+    for (int i = 0; i < 4; i++)
+    {
+        sources.push_back(
+            rcp<AudioSource>(new AudioSource(Span<float>(samples), 2, 44100)));
+    }
+
+    // Both voices busy keeps both clips.
+    REQUIRE(mixer.play(sources[0], 0, 1.0f, nullptr));
+    REQUIRE(mixer.play(sources[1], 0, 1.0f, nullptr));
+    CHECK(mixer.clipCount() == 2);
+    CHECK(sources[0]->debugging_refcnt() == 2);
+
+    // A clip in use is never evicted, even over budget.
+    CHECK(!mixer.play(sources[2], 0, 1.0f, nullptr));
+    CHECK(mixer.clipCount() == 3);
+
+    float frames[64 * 2];
+    mixer.render(frames, 64);
+
+    // Once the voices finish, the least recently played clips go first and
+    // release their sources.
+    REQUIRE(mixer.play(sources[3], 0, 1.0f, nullptr));
+    CHECK(mixer.clipCount() == 2);
+    CHECK(sources[0]->debugging_refcnt() == 1);
+    CHECK(sources[1]->debugging_refcnt() == 1);
+    CHECK(sources[2]->debugging_refcnt() == 2);
+
+    // Replaying a cached clip doesn't evict anything.
+    REQUIRE(mixer.play(sources[2], 0, 1.0f, nullptr));
+    CHECK(mixer.clipCount() == 2);
+}
+
 // TODO check if sound->stop calls completed callback!!!
\ No newline at end of file
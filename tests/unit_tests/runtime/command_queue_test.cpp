@@ -4,10 +4,12 @@
 
 #include "rive/animation/state_machine_input_instance.hpp"
 #include "rive/animation/state_machine_instance.hpp"
+#include "rive/assets/image_asset.hpp"
 #include "rive/command_queue.hpp"
 #include "rive/command_server.hpp"
 #include "rive/file.hpp"
 #include "common/render_context_null.hpp"
+#include "utils/no_op_factory.hpp"
 #include <fstream>
 
 namespace rive
@@ -377,6 +379,222 @@ TEST_CASE("invalid handles", "[CommandQueue]")
     serverThread.join();
 }
 
+class FileEventListener : public CommandQueue::FileListener
+{
+public:
+    void onFileLoaded(const FileHandle, uint64_t) override
+    {
+        events.push_back("loaded");
+    }
+
+    void onFileError(const FileHandle, uint64_t, std::string) override
+    {
+        events.push_back("error");
+    }
+
+    void onFileDeleted(const FileHandle, uint64_t) override
+    {
+        events.push_back("deleted");
+    }
+
+    std::vector<std::string> events;
+};
+
+TEST_CASE("files import on background threads", "[CommandQueue]")
+{
+    auto commandQueue = make_rcp<CommandQueue>();
+    std::thread serverThread([commandQueue]() {
+        NoOpFactory factory;
+        CommandServer server(commandQueue, &factory, 4);
+        server.serveUntilDisconnect();
+    });
+
+    std::ifstream stream("assets/two_artboards.riv", std::ios::binary);
+    std::vector<uint8_t> rivBytes(std::istreambuf_iterator<char>(stream), {});
+    std::array<FileEventListener, 8> listeners;
+    std::vector<FileHandle> files;
+    for (auto& listener : listeners)
+    {
+        files.push_back(commandQueue->loadFile(rivBytes, &listener));
+    }
+    FileEventListener badListener;
+    FileHandle badFile =
+        commandQueue->loadFile(std::vector<uint8_t>(100 * 1024, 0),
+                               &badListener);
+
+    // These depend on imports that may still be running.
+    ArtboardHandle artboard =
+        commandQueue->instantiateArtboardNamed(files[0], "One");
+    commandQueue->deleteFile(files[1]);
+    commandQueue->runOnce([files, badFile, artboard](CommandServer* server) {
+        CHECK(server->getArtboardInstance(artboard) != nullptr);
+        CHECK(server->getFile(files[1]) == nullptr);
+        for (size_t i = 2; i < files.size(); ++i)
+        {
+            CHECK(server->getFile(files[i]) != nullptr);
+        }
+        CHECK(server->getFile(badFile) == nullptr);
+    });
+
+    wait_for_server(commandQueue.get());
+    commandQueue->processMessages();
+    CHECK(listeners[1].events ==
+          std::vector<std::string>{"loaded", "deleted"});
+    for (size_t i = 0; i < listeners.size(); ++i)
+    {
+        if (i != 1)
+        {
+            CHECK(listeners[i].events == std::vector<std::string>{"loaded"});
+        }
+    }
+    CHECK(badListener.events == std::vector<std::string>{"error"});
+
+    commandQueue->disconnect();
+    serverThread.join();
+}
+
+// Forwards to a NoOpFactory, counting calls made on any thread but the one
+// that created it.
+class ServerThreadFactory : public Factory
+{
+public:
+    explicit ServerThreadFactory(std::atomic<int>* offThreadCalls) :
+        m_offThreadCalls(offThreadCalls)
+    {}
+
+    rcp<RenderBuffer> makeRenderBuffer(RenderBufferType type,
+                                       RenderBufferFlags flags,
+                                       size_t sizeInBytes) override
+    {
+        checkThread();
+        return inner().makeRenderBuffer(type, flags, sizeInBytes);
+    }
+
+    rcp<RenderShader> makeLinearGradient(float sx,
+                                         float sy,
+                                         float ex,
+                                         float ey,
+                                         const ColorInt colors[],
+                                         const float stops[],
+                                         size_t count) override
+    {
+        checkThread();
+        return inner()
+            .makeLinearGradient(sx, sy, ex, ey, colors, stops, count);
+    }
+
+    rcp<RenderShader> makeRadialGradient(float cx,
+                                         float cy,
+                                         float radius,
+                                         const ColorInt colors[],
+                                         const float stops[],
+                                         size_t count) override
+    {
+        checkThread();
+        return inner().makeRadialGradient(cx, cy, radius, colors, stops, count);
+    }
+
+    rcp<RenderPath> makeRenderPath(RawPath& rawPath, FillRule fillRule) override
+    {
+        checkThread();
+        return inner().makeRenderPath(rawPath, fillRule);
+    }
+
+    rcp<RenderPath> makeEmptyRenderPath() override
+    {
+        checkThread();
+        return inner().makeEmptyRenderPath();
+    }
+
+    rcp<RenderPaint> makeRenderPaint() override
+    {
+        checkThread();
+        return inner().makeRenderPaint();
+    }
+
+    rcp<RenderImage> decodeImage(Span<const uint8_t> bytes) override
+    {
+        checkThread();
+        decodeCount++;
+        return inner().decodeImage(bytes);
+    }
+
+    int decodeCount = 0;
+
+private:
+    Factory& inner() { return m_factory; }
+
+    void checkThread()
+    {
+        // Catch's assertions aren't thread safe, so the test checks the count
+        // once the server is done.
+        if (std::this_thread::get_id() != m_threadID)
+        {
+            (*m_offThreadCalls)++;
+        }
+    }
+
+    NoOpFactory m_factory;
+    std::atomic<int>* m_offThreadCalls;
+    const std::thread::id m_threadID = std::this_thread::get_id();
+};
+
+TEST_CASE("files import without using the factory off the server thread",
+          "[CommandQueue]")
+{
+    std::atomic<int> offThreadCalls{0};
+    auto commandQueue = make_rcp<CommandQueue>();
+    std::thread serverThread([commandQueue, &offThreadCalls]() {
+        ServerThreadFactory factory(&offThreadCalls);
+        {
+            CommandServer server(commandQueue, &factory, 4);
+            server.serveUntilDisconnect();
+        }
+        CHECK(factory.decodeCount > 0);
+    });
+
+    // walle.riv embeds its images.
+    std::ifstream stream("assets/walle.riv", std::ios::binary);
+    std::vector<uint8_t> rivBytes(std::istreambuf_iterator<char>(stream), {});
+    std::vector<FileHandle> files;
+    for (int i = 0; i < 8; ++i)
+    {
+        files.push_back(commandQueue->loadFile(rivBytes));
+    }
+    // Instantiating waits for each import to be installed.
+    std::vector<ArtboardHandle> artboards;
+    for (FileHandle handle : files)
+    {
+        artboards.push_back(commandQueue->instantiateDefaultArtboard(handle));
+    }
+    commandQueue->runOnce([files, artboards](CommandServer* server) {
+        for (ArtboardHandle artboard : artboards)
+        {
+            CHECK(server->getArtboardInstance(artboard) != nullptr);
+        }
+        for (FileHandle handle : files)
+        {
+            File* file = server->getFile(handle);
+            REQUIRE(file != nullptr);
+            int imageCount = 0;
+            for (auto& asset : file->assets())
+            {
+                if (asset->is<ImageAsset>())
+                {
+                    imageCount++;
+                    CHECK(asset->as<ImageAsset>()->renderImage() != nullptr);
+                }
+            }
+            CHECK(imageCount > 0);
+        }
+    });
+
+    wait_for_server(commandQueue.get());
+    commandQueue->disconnect();
+    serverThread.join();
+    CHECK(offThreadCalls == 0);
+}
+
 TEST_CASE("draw loops", "[CommandQueue]")
 {
     auto commandQueue = make_rcp<CommandQueue>();
@@ -4,6 +4,7 @@
 
 #include <rive/math/contour_measure.hpp>
 #include <rive/math/math_types.hpp>
+#include <rive/math/path_measure.hpp>
 #include <rive/math/raw_path.hpp>
 #include <rive/math/vec2d.hpp>
 
@@ -199,3 +200,55 @@ TEST_CASE("fuzz_issue_7295", "[MetricsPath]")
     contour->getSegment(.0f, 168.389008f, &result, true);
     CHECK(math::nearly_equal(contour->length(), 168.389008f));
 }
+
+TEST_CASE("batched-postans", "[contourmeasure]")
+{
+    const float tol = 0.0001f;
+
+    RawPath path;
+    path.moveTo(0, 0);
+    path.cubicTo(100, -50, 200, 150, 300, 0);
+    path.lineTo(300, 100);
+    path.quadTo(150, 200, 0, 100);
+    path.moveTo(0, 300);
+    path.cubicTo(50, 250, 100, 350, 150, 300);
+
+    PathMeasure measure(&path);
+    REQUIRE(measure.length() > 0);
+
+    // Sorted, duplicated, out of range and backwards distances should all
+    // match the single queries.
+    std::vector<float> distances;
+    for (int i = 0; i <= 200; i++)
+    {
+        distances.push_back(measure.length() * (float)i / 200.0f);
+    }
+    distances.push_back(distances.back());
+    distances.push_back(measure.length() * 0.25f);
+    distances.push_back(-5.0f);
+    distances.push_back(measure.length() * 0.75f);
+
+    std::vector<ContourMeasure::PosTanDistance> batched(distances.size());
+    measure.atDistances(distances, batched.data());
+    PathMeasure::Cursor cursor;
+    for (size_t i = 0; i < distances.size(); i++)
+    {
+        auto single = measure.atDistance(distances[i]);
+        auto sequential = measure.atDistance(distances[i], &cursor);
+        REQUIRE(batched[i].distance == distances[i]);
+        REQUIRE(Vec2D::distance(batched[i].pos, single.pos) < tol);
+        REQUIRE(Vec2D::distance(batched[i].tan, single.tan) < tol);
+        REQUIRE(sequential.pos == single.pos);
+        REQUIRE(sequential.tan == single.tan);
+    }
+
+    std::vector<float> percentages = {0.5f, 0.75f, 1.0f, 1.25f, 1.5f, -0.25f};
+    std::vector<ContourMeasure::PosTanDistance> wrapped(percentages.size());
+    measure.atPercentages(percentages, wrapped.data());
+    for (size_t i = 0; i < percentages.size(); i++)
+    {
+        auto single = measure.atPercentage(percentages[i]);
+        REQUIRE(Vec2D::distance(wrapped[i].pos, single.pos) < tol);
+        REQUIRE(Vec2D::distance(wrapped[i].tan, single.tan) < tol);
+    }
+}
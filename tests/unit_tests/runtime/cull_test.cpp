@@ -0,0 +1,155 @@
+#include "rive/file.hpp"
+#include "rive/shapes/parametric_path.hpp"
+#include "rive/shapes/path.hpp"
+#include "rive/shapes/path_vertex.hpp"
+#include "rive/shapes/shape.hpp"
+#include "rive/shapes/paint/stroke.hpp"
+#include "utils/no_op_renderer.hpp"
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+
+using namespace rive;
+
+class DrawCountingRenderer : public NoOpRenderer
+{
+public:
+    void drawPath(RenderPath*, RenderPaint*) override { drawCount++; }
+
+    size_t drawCount = 0;
+};
+
+static ShapePaintPath* composedPath(Shape* shape)
+{
+    return shape->isFlagged(PathFlags::world)
+               ? shape->pathComposer()->worldPath()
+               : shape->pathComposer()->localPath();
+}
+
+TEST_CASE("artboard draw skips shapes outside the cull rect", "[culling]")
+{
+    auto file = ReadRiveFile("assets/shapetest.riv");
+    auto artboard = file->artboardDefault();
+    artboard->advance(0.0f);
+
+    // The Ellipse spans roughly x 139..271 of the 400x200 artboard. Hide the
+    // background so only the Ellipse's paints are counted.
+    const auto hideBG = Artboard::DrawOption::kHideBG;
+    DrawCountingRenderer unculled;
+    artboard->draw(&unculled, hideBG);
+    REQUIRE(unculled.drawCount > 0);
+    CHECK(artboard->worldCullRect() == nullptr);
+
+    DrawCountingRenderer visible;
+    artboard->draw(&visible, AABB(100.0f, 0.0f, 200.0f, 200.0f), hideBG);
+    CHECK(visible.drawCount == unculled.drawCount);
+
+    DrawCountingRenderer culled;
+    artboard->draw(&culled, AABB(360.0f, 0.0f, 400.0f, 200.0f), hideBG);
+    CHECK(culled.drawCount == 0);
+    REQUIRE(artboard->worldCullRect() != nullptr);
+
+    // Drawing without a cull rect draws everything again.
+    DrawCountingRenderer redrawn;
+    artboard->draw(&redrawn, hideBG);
+    CHECK(redrawn.drawCount == unculled.drawCount);
+}
+
+TEST_CASE("culled shapes defer composing their paths", "[culling]")
+{
+    auto file = ReadRiveFile("assets/shapetest.riv");
+    auto artboard = file->artboardDefault();
+    artboard->advance(0.0f);
+
+    auto ellipse = artboard->find<Shape>("Ellipse");
+    REQUIRE(ellipse != nullptr);
+    CHECK(!ellipse->canDeferPathUpdate());
+
+    NoOpRenderer renderer;
+    artboard->draw(&renderer, AABB(360.0f, 0.0f, 400.0f, 200.0f));
+    CHECK(ellipse->isCulled());
+    CHECK(ellipse->canDeferPathUpdate());
+    // Raw paths keep updating so the culling bounds stay accurate.
+    CHECK(!ellipse->canDeferRawPathUpdate());
+
+    // Move the geometry (still off-screen) by moving all the vertices.
+    float boundsX = ellipse->worldBounds().minX;
+    float composedX = composedPath(ellipse)->rawPath()->bounds().minX;
+    for (auto path : ellipse->paths())
+    {
+        for (auto vertex : path->vertices())
+        {
+            vertex->x(vertex->x() + 40.0f);
+        }
+    }
+    artboard->advance(0.0f);
+
+    // The bounds follow the new geometry, the composed path is stale.
+    CHECK(ellipse->worldBounds().minX > boundsX + 1.0f);
+    CHECK(composedPath(ellipse)->rawPath()->bounds().minX ==
+          Approx(composedX));
+
+    // Coming back into view composes the deferred paths before drawing.
+    artboard->draw(&renderer);
+    CHECK(!ellipse->canDeferPathUpdate());
+    CHECK(composedPath(ellipse)->rawPath()->bounds().minX > composedX + 1.0f);
+}
+
+TEST_CASE("culled stroked shapes defer composing their paths", "[culling]")
+{
+    auto file = ReadRiveFile("assets/stroke_name_test.riv");
+    auto artboard = file->artboardDefault();
+    artboard->advance(0.0f);
+
+    // The shape spans roughly x 101..361 of the 500x500 artboard and is
+    // stroked without a stroke effect.
+    auto stroke = artboard->find<Stroke>("white_stroke");
+    REQUIRE(stroke != nullptr);
+    REQUIRE(!stroke->hasStrokeEffect());
+    auto shape = stroke->parent()->as<Shape>();
+    CHECK(!shape->canDeferPathUpdate());
+
+    const auto hideBG = Artboard::DrawOption::kHideBG;
+    DrawCountingRenderer culled;
+    artboard->draw(&culled, AABB(480.0f, 0.0f, 500.0f, 500.0f), hideBG);
+    CHECK(culled.drawCount == 0);
+    CHECK(shape->isCulled());
+    CHECK(shape->canDeferPathUpdate());
+
+    // Widen the rectangle, keeping it off-screen.
+    REQUIRE(shape->paths().size() == 1);
+    REQUIRE(shape->paths()[0]->is<ParametricPath>());
+    auto rectangle = shape->paths()[0]->as<ParametricPath>();
+    float composedWidth = composedPath(shape)->rawPath()->bounds().width();
+    rectangle->width(rectangle->width() + 40.0f);
+    artboard->advance(0.0f);
+    CHECK(composedPath(shape)->rawPath()->bounds().width() ==
+          Approx(composedWidth));
+
+    // Coming back into view composes the new geometry for the fill and the
+    // stroke.
+    DrawCountingRenderer visible;
+    artboard->draw(&visible, AABB(0.0f, 0.0f, 500.0f, 500.0f), hideBG);
+    CHECK(visible.drawCount == 2);
+    CHECK(!shape->canDeferPathUpdate());
+    CHECK(composedPath(shape)->rawPath()->bounds().width() ==
+          Approx(composedWidth + 40.0f));
+}
+
+TEST_CASE("culled shapes with stroke effects keep composing their paths",
+          "[culling]")
+{
+    auto file = ReadRiveFile("assets/trim.riv");
+    auto artboard = file->artboardDefault();
+    artboard->advance(0.0f);
+
+    // The trim path reads the composed path whenever it updates, not only
+    // when the stroke is drawn.
+    auto shapes = artboard->find<Shape>();
+    REQUIRE(shapes.size() == 1);
+    auto shape = shapes[0];
+
+    NoOpRenderer renderer;
+    artboard->draw(&renderer, AABB(0.0f, 0.0f, 100.0f, 100.0f));
+    CHECK(shape->isCulled());
+    CHECK(!shape->canDeferPathUpdate());
+}
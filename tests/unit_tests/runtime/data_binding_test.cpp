@@ -25,6 +25,9 @@
 #include <rive/viewmodel/viewmodel_instance_trigger.hpp>
 #include <rive/viewmodel/viewmodel_instance_list.hpp>
 #include <rive/viewmodel/viewmodel_instance_list_item.hpp>
+#include <rive/viewmodel/viewmodel_instance_viewmodel.hpp>
+#include <rive/data_bind/data_bind_context.hpp>
+#include <rive/data_bind/data_context.hpp>
 #include "rive/animation/state_machine_instance.hpp"
 #include "rive/nested_artboard.hpp"
 #include "utils/serializing_factory.hpp"
@@ -86,6 +89,12 @@ TEST_CASE("artboard with bound properties", "[data binding]")
     auto orientProperty = viewModelInstance->propertyValue("orient");
     REQUIRE(orientProperty != nullptr);
     REQUIRE(orientProperty->is<rive::ViewModelInstanceBoolean>());
+    // Lookups by name and by id resolve to the same value
+    REQUIRE(viewModelInstance->propertyValue(
+                widthProperty->viewModelPropertyId()) == widthProperty);
+    REQUIRE(viewModelInstance->propertyValue(
+                textProperty->viewModelPropertyId()) == textProperty);
+    REQUIRE(viewModelInstance->propertyValue("missing") == nullptr);
     // Update view model values
     widthProperty->as<rive::ViewModelInstanceNumber>()->propertyValue(200.0f);
     rotationProperty->as<rive::ViewModelInstanceNumber>()->propertyValue(
@@ -1938,4 +1947,148 @@ TEST_CASE("Bidirectional data binding with target to source precedence",
     artboard->draw(renderer.get());
 
     CHECK(silver.matches("bidirectional_precedence-target_first"));
-}
\ No newline at end of file
+}
+static rive::ViewModelInstanceNumber* addNumberValue(
+    rive::ViewModelInstance* instance,
+    uint32_t propertyId)
+{
+    auto value = new rive::ViewModelInstanceNumber();
+    value->viewModelPropertyId(propertyId);
+    instance->addValue(value);
+    return value;
+}
+
+TEST_CASE("View model instances look up property values by id",
+          "[data binding]")
+{
+    auto instance = rive::make_rcp<rive::ViewModelInstance>();
+    auto first = addNumberValue(instance.get(), 0);
+    auto third = addNumberValue(instance.get(), 3);
+    // The first value with an id wins.
+    addNumberValue(instance.get(), 3);
+    // Ids past the indexed range are still found.
+    auto large = addNumberValue(instance.get(), 5000000);
+
+    CHECK(instance->propertyValue(0u) == first);
+    CHECK(instance->propertyValue(1u) == nullptr);
+    CHECK(instance->propertyValue(3u) == third);
+    CHECK(instance->propertyValue(5000000u) == large);
+    CHECK(instance->propertyValue(4999999u) == nullptr);
+}
+
+TEST_CASE("Resolved binding sources are reused until the graph changes",
+          "[data binding]")
+{
+    auto child = rive::make_rcp<rive::ViewModelInstance>();
+    child->viewModelId(2);
+    auto childValue = addNumberValue(child.get(), 0);
+    auto otherChild = rive::make_rcp<rive::ViewModelInstance>();
+    otherChild->viewModelId(2);
+    auto otherChildValue = addNumberValue(otherChild.get(), 0);
+
+    auto parent = rive::make_rcp<rive::ViewModelInstance>();
+    parent->viewModelId(1);
+    auto reference = new rive::ViewModelInstanceViewModel();
+    reference->viewModelPropertyId(0);
+    parent->addValue(reference);
+    reference->referenceViewModelInstance(child);
+
+    rive::DataContext context(parent);
+    rive::DataBindContext dataBind;
+    // View model 1, its property 0, then property 0 of the referenced child.
+    uint8_t path[] = {1, 0, 0};
+    dataBind.decodeSourcePathIds(rive::Span<const uint8_t>(path, 3));
+
+    dataBind.bindFromContext(&context);
+    CHECK(dataBind.source() == childValue);
+    CHECK(dataBind.sourcePathResolutions == 1);
+
+    // Rebinding the same graph reuses the source. Contexts elsewhere being
+    // created, changed or deleted don't affect this one.
+    auto version = context.version();
+    {
+        rive::DataContext unrelated(otherChild);
+        unrelated.parent(&context);
+        unrelated.viewModelInstance(child);
+    }
+    // Setting the parent or instance it already has changes nothing.
+    context.parent(nullptr);
+    context.viewModelInstance(parent);
+    CHECK(context.version() == version);
+    dataBind.bindFromContext(&context);
+    dataBind.bindFromContext(&context);
+    CHECK(dataBind.source() == childValue);
+    CHECK(dataBind.sourcePathResolutions == 1);
+
+    // Re-pointing the nested view model invalidates the resolved source.
+    reference->referenceViewModelInstance(otherChild);
+    CHECK(context.version() != version);
+    dataBind.bindFromContext(&context);
+    CHECK(dataBind.source() == otherChildValue);
+    CHECK(dataBind.sourcePathResolutions == 2);
+
+    // So does changing an ancestor of the context.
+    auto grandParent = rive::make_rcp<rive::ViewModelInstance>();
+    grandParent->viewModelId(3);
+    rive::DataContext ancestor(grandParent);
+    context.parent(&ancestor);
+    dataBind.bindFromContext(&context);
+    CHECK(dataBind.sourcePathResolutions == 3);
+    ancestor.viewModelInstance(child);
+    dataBind.bindFromContext(&context);
+    CHECK(dataBind.sourcePathResolutions == 4);
+    dataBind.bindFromContext(&context);
+    CHECK(dataBind.sourcePathResolutions == 4);
+
+    // And changing the context's own instance.
+    auto otherParent = rive::make_rcp<rive::ViewModelInstance>();
+    otherParent->viewModelId(1);
+    context.viewModelInstance(otherParent);
+    dataBind.bindFromContext(&context);
+    CHECK(dataBind.source() == nullptr);
+    CHECK(dataBind.sourcePathResolutions == 5);
+
+    // A different context always resolves again.
+    rive::DataContext rebound(parent);
+    dataBind.bindFromContext(&rebound);
+    CHECK(dataBind.source() == otherChildValue);
+    CHECK(dataBind.sourcePathResolutions == 6);
+}
+TEST_CASE("Rebinding an artboard to the same context skips path resolution",
+          "[data binding]")
+{
+    auto file = ReadRiveFile("assets/data_binding_test.riv");
+
+    auto artboard = file->artboard("artboard-1")->instance();
+    auto viewModelInstance =
+        file->createDefaultViewModelInstance(artboard.get());
+    artboard->bindViewModelInstance(viewModelInstance);
+    artboard->advance(0.0f);
+
+    std::vector<rive::DataBindContext*> dataBinds;
+    for (auto dataBind : artboard->dataBinds())
+    {
+        if (dataBind->is<rive::DataBindContext>())
+        {
+            dataBinds.push_back(dataBind->as<rive::DataBindContext>());
+        }
+    }
+    REQUIRE(!dataBinds.empty());
+    for (auto dataBind : dataBinds)
+    {
+        CHECK(dataBind->sourcePathResolutions == 1);
+    }
+
+    // Binding another artboard creates contexts of its own, which must not
+    // invalidate the sources resolved through this artboard's context.
+    auto other = file->artboard("artboard-1")->instance();
+    other->bindViewModelInstance(
+        file->createDefaultViewModelInstance(other.get()));
+
+    artboard->internalDataContext(artboard->dataContext());
+    for (auto dataBind : dataBinds)
+    {
+        CHECK(dataBind->sourcePathResolutions == 1);
+    }
+    REQUIRE(artboard->find<rive::Rectangle>("bound_rect")->width() == 100.0f);
+}
@@ -4,6 +4,8 @@
 
 #include <rive/math/aabb.hpp>
 #include <rive/math/hit_test.hpp>
+#include <rive/math/mat2d.hpp>
+#include <rive/math/raw_path.hpp>
 #include <rive/nested_artboard.hpp>
 #include <rive/animation/state_machine_instance.hpp>
 #include <rive/animation/state_machine_input_instance.hpp>
@@ -67,6 +69,47 @@ TEST_CASE("hittest-mesh", "[hittest]")
         HitTester::testMesh(area, make_span(verts, 3), make_span(indices, 3)));
 }
 
+TEST_CASE("hittest-polygon", "[hittest]")
+{
+    // A 20x20 square with a 10x10 hole in the middle wound the same way.
+    RawPath path;
+    path.addRect({0, 0, 20, 20});
+    path.addRect({5, 5, 15, 15});
+
+    HitTestPolygon polygon;
+    polygon.addPath(path, Mat2D());
+    REQUIRE(!polygon.empty());
+
+    REQUIRE(polygon.testFill({2, 2}, 0, FillRule::nonZero));
+    REQUIRE(polygon.testFill({10, 10}, 0, FillRule::nonZero));
+    REQUIRE(polygon.testFill({2, 2}, 0, FillRule::evenOdd));
+    REQUIRE(!polygon.testFill({10, 10}, 0, FillRule::evenOdd));
+    // The hole's edges are within the hit radius.
+    REQUIRE(polygon.testFill({10, 6}, 2, FillRule::evenOdd));
+    REQUIRE(!polygon.testFill({30, 10}, 2, FillRule::nonZero));
+    REQUIRE(polygon.testFill({21, 10}, 2, FillRule::nonZero));
+
+    // Transforms are applied when flattening.
+    polygon.rewind();
+    polygon.addPath(path, Mat2D::fromTranslate(100, 0));
+    REQUIRE(!polygon.testFill({2, 2}, 0, FillRule::nonZero));
+    REQUIRE(polygon.testFill({102, 2}, 0, FillRule::nonZero));
+
+    // Strokes only hit near the outline, and open contours aren't stroked
+    // where they would be closed for filling.
+    RawPath open;
+    open.moveTo(0, 0);
+    open.cubicTo(10, -10, 20, 10, 30, 0);
+    open.lineTo(30, 30);
+    polygon.rewind();
+    polygon.addPath(open, Mat2D());
+    REQUIRE(polygon.testStroke({30, 15}, 1));
+    REQUIRE(polygon.testStroke({15, 1}, 1));
+    REQUIRE(!polygon.testStroke({25, 10}, 1));
+    REQUIRE(!polygon.testStroke({15, 15}, 1));
+    REQUIRE(polygon.testFill({25, 10}, 0, FillRule::nonZero));
+}
+
 TEST_CASE("hit test on opaque target", "[hittest]")
 {
     // This artboard has two rects of size 200 x 200, "red-activate" at [0, 0,
@@ -9,6 +9,7 @@
 #include <utils/no_op_renderer.hpp>
 #include "rive_file_reader.hpp"
 #include <catch.hpp>
+#include <cmath>
 #include <cstdio>
 
 TEST_CASE("image assets loads correctly", "[assets]")
@@ -79,3 +80,89 @@ TEST_CASE("out of band image assets loads correctly", "[assets]")
     rive::NoOpRenderer renderer;
     file->artboard()->draw(&renderer);
 }
+
+
+namespace
+{
+class TargetSizeFactory : public rive::NoOpFactory
+{
+public:
+    rive::rcp<rive::RenderImage> decodeImageAtSize(
+        rive::Span<const uint8_t> bytes,
+        uint32_t width,
+        uint32_t height) override
+    {
+        targetWidth = width;
+        targetHeight = height;
+        return nullptr;
+    }
+
+    uint32_t targetWidth = 0;
+    uint32_t targetHeight = 0;
+};
+} // namespace
+
+namespace
+{
+// Tracks its transform like a real renderer would.
+class TransformRenderer : public rive::NoOpRenderer
+{
+public:
+    void save() override { m_stack.push_back(m_stack.back()); }
+    void restore() override { m_stack.pop_back(); }
+    void transform(const rive::Mat2D& matrix) override
+    {
+        m_stack.back() = m_stack.back() * matrix;
+    }
+    rive::Mat2D currentTransform() const override { return m_stack.back(); }
+
+private:
+    std::vector<rive::Mat2D> m_stack = {rive::Mat2D()};
+};
+} // namespace
+
+TEST_CASE("image draw scales include the renderer's transform", "[assets]")
+{
+    auto file = ReadRiveFile("assets/walle.riv");
+    auto artboard = file->artboard();
+    auto asset = artboard->find<rive::Image>("walle")->imageAsset();
+    artboard->updateComponents();
+
+    rive::NoOpRenderer renderer;
+    artboard->draw(&renderer);
+    float worldScale = asset->maxDrawScale();
+    REQUIRE(worldScale > 0.0f);
+
+    TransformRenderer scaledRenderer;
+    scaledRenderer.scale(3.0f, 3.0f);
+    artboard->draw(&scaledRenderer);
+    CHECK(asset->maxDrawScale() == Approx(worldScale * 3.0f));
+}
+
+TEST_CASE("image assets decode at their decode scale", "[assets]")
+{
+    TargetSizeFactory factory;
+    auto file = ReadRiveFile("assets/walle.riv", &factory);
+    // Embedded images decode at full size.
+    CHECK(factory.targetWidth == 0);
+    CHECK(factory.targetHeight == 0);
+
+    auto walle = file->artboard()->find<rive::Image>("walle");
+    REQUIRE(walle != nullptr);
+    auto asset = walle->imageAsset();
+    REQUIRE(asset->width() > 0);
+    REQUIRE(asset->height() > 0);
+    CHECK(asset->maxDrawScale() == 0.0f);
+
+    file->artboard()->updateComponents();
+    rive::NoOpRenderer renderer;
+    file->artboard()->draw(&renderer);
+    CHECK(asset->maxDrawScale() > 0.0f);
+
+    asset->decodeScale(0.25f);
+    rive::SimpleArray<uint8_t> bytes(16);
+    asset->decode(bytes, &factory);
+    CHECK(factory.targetWidth == (uint32_t)std::ceil(asset->width() * 0.25f));
+    CHECK(factory.targetHeight ==
+          (uint32_t)std::ceil(asset->height() * 0.25f));
+}
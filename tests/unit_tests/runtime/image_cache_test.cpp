@@ -0,0 +1,207 @@
+#include "rive/file.hpp"
+#include "rive/image_cache.hpp"
+#include "rive/assets/image_asset.hpp"
+#include "utils/no_op_factory.hpp"
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+
+using namespace rive;
+
+namespace
+{
+class SizedImage : public RenderImage
+{
+public:
+    SizedImage(int width, int height)
+    {
+        m_Width = width;
+        m_Height = height;
+    }
+};
+
+// Keeps its full size but stores the pixels at half the width.
+class HalfWidthImage : public SizedImage
+{
+public:
+    using SizedImage::SizedImage;
+    size_t decodedByteSize() const override
+    {
+        return (size_t)(m_Width / 2) * m_Height * 4;
+    }
+};
+
+// Decodes the first byte as the image width, fails on empty data.
+class CountingFactory : public NoOpFactory
+{
+public:
+    rcp<RenderImage> decodeImage(Span<const uint8_t> bytes) override
+    {
+        decodeCount++;
+        if (bytes.empty())
+        {
+            return nullptr;
+        }
+        return make_rcp<SizedImage>(bytes[0], 1);
+    }
+
+    rcp<RenderImage> decodeImageAtSize(Span<const uint8_t> bytes,
+                                       uint32_t targetWidth,
+                                       uint32_t targetHeight) override
+    {
+        if (targetWidth == 0 || bytes.empty())
+        {
+            return decodeImage(bytes);
+        }
+        decodeCount++;
+        return make_rcp<HalfWidthImage>(bytes[0], 1);
+    }
+
+    int decodeCount = 0;
+};
+} // namespace
+
+TEST_CASE("image cache shares images decoded from the same bytes", "[image]")
+{
+    CountingFactory factory;
+    factory.imageCache(make_rcp<ImageCache>());
+
+    std::vector<uint8_t> bytes = {10, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<uint8_t> copy = bytes;
+    auto image = factory.decodeCachedImage(bytes);
+    REQUIRE(image != nullptr);
+    CHECK(factory.decodeCachedImage(copy) == image);
+    CHECK(factory.decodeCount == 1);
+    CHECK(factory.imageCache()->hits() == 1);
+    CHECK(factory.imageCache()->misses() == 1);
+    CHECK(factory.imageCache()->decodedBytes() == 10 * 4);
+    CHECK(factory.imageCache()->encodedBytes() == bytes.size());
+
+    copy.back() = 0;
+    CHECK(factory.decodeCachedImage(copy) != image);
+    CHECK(factory.decodeCount == 2);
+
+    CHECK(factory.decodeCachedImage(Span<const uint8_t>()) == nullptr);
+    CHECK(factory.imageCache()->count() == 2);
+}
+
+TEST_CASE("image cache evicts unused images past its budget", "[image]")
+{
+    CountingFactory factory;
+    // Room for two unused 10x1 images and their 2 encoded bytes each.
+    factory.imageCache(make_rcp<ImageCache>(2 * (10 * 4 + 2)));
+
+    std::vector<uint8_t> a = {10, 1}, b = {10, 2}, c = {10, 3};
+    auto held = factory.decodeCachedImage(a);
+    factory.releaseCachedImage(factory.decodeCachedImage(b).get());
+    factory.releaseCachedImage(factory.decodeCachedImage(c).get());
+    // a is still in use, b and c fit in the budget.
+    CHECK(factory.imageCache()->count() == 3);
+
+    factory.releaseCachedImage(held.get());
+    std::vector<uint8_t> d = {10, 4};
+    auto other = factory.decodeCachedImage(d);
+    // a was the least recently used unused image.
+    CHECK(factory.imageCache()->count() == 3);
+    factory.releaseCachedImage(factory.decodeCachedImage(b).get());
+    CHECK(factory.decodeCount == 4);
+    factory.releaseCachedImage(factory.decodeCachedImage(a).get());
+    CHECK(factory.decodeCount == 5);
+
+    held = factory.decodeCachedImage(c);
+    factory.imageCache()->byteBudget(0);
+    CHECK(factory.imageCache()->count() == 2);
+    factory.releaseCachedImage(other.get());
+    CHECK(factory.imageCache()->count() == 1);
+    CHECK(factory.decodeCachedImage(c) == held);
+}
+
+TEST_CASE("image cache budget includes the encoded copy", "[image]")
+{
+    CountingFactory factory;
+    factory.imageCache(make_rcp<ImageCache>(10 * 4));
+
+    std::vector<uint8_t> bytes = {10, 1};
+    factory.releaseCachedImage(factory.decodeCachedImage(bytes).get());
+    CHECK(factory.imageCache()->count() == 0);
+
+    factory.imageCache()->byteBudget(10 * 4 + bytes.size());
+    factory.releaseCachedImage(factory.decodeCachedImage(bytes).get());
+    CHECK(factory.imageCache()->count() == 1);
+}
+
+TEST_CASE("image cache counts uses instead of references", "[image]")
+{
+    CountingFactory factory;
+    factory.imageCache(make_rcp<ImageCache>());
+
+    std::vector<uint8_t> a = {10, 1};
+    auto first = factory.decodeCachedImage(a);
+    auto second = factory.decodeCachedImage(a);
+    REQUIRE(first == second);
+
+    // Extra references outside the cache don't keep an entry in use, and an
+    // entry stays in use until every use is released.
+    rcp<RenderImage> extra = first;
+    factory.releaseCachedImage(first.get());
+    factory.imageCache()->purgeUnused();
+    CHECK(factory.imageCache()->count() == 1);
+    factory.releaseCachedImage(second.get());
+    factory.imageCache()->purgeUnused();
+    CHECK(factory.imageCache()->count() == 0);
+    CHECK(extra->width() == 10);
+
+    // Releasing images the cache doesn't hold is ignored.
+    auto third = factory.decodeCachedImage(a);
+    factory.imageCache()->clear();
+    CHECK(factory.imageCache()->count() == 0);
+    CHECK(factory.imageCache()->decodedBytes() == 0);
+    CHECK(factory.imageCache()->encodedBytes() == 0);
+    factory.releaseCachedImage(third.get());
+    factory.releaseCachedImage(extra.get());
+}
+
+TEST_CASE("image cache charges the size images were decoded at", "[image]")
+{
+    CountingFactory factory;
+    factory.imageCache(make_rcp<ImageCache>());
+
+    std::vector<uint8_t> bytes = {10, 1};
+    auto full = factory.decodeCachedImage(bytes);
+    auto half = factory.decodeCachedImage(bytes, 5, 1);
+    CHECK(full != half);
+    CHECK(half->width() == 10);
+    CHECK(factory.imageCache()->decodedBytes() == 10 * 4 + 5 * 4);
+}
+
+TEST_CASE("files loaded with the same factory share decoded images",
+          "[image]")
+{
+    CountingFactory factory;
+    factory.imageCache(make_rcp<ImageCache>());
+    auto first = ReadRiveFile("assets/walle.riv", &factory);
+    int decodeCount = factory.decodeCount;
+    REQUIRE(decodeCount > 0);
+    auto second = ReadRiveFile("assets/walle.riv", &factory);
+    CHECK(factory.decodeCount == decodeCount);
+
+    auto firstAssets = first->assets();
+    auto secondAssets = second->assets();
+    REQUIRE(firstAssets.size() == secondAssets.size());
+    for (size_t i = 0; i < firstAssets.size(); i++)
+    {
+        if (firstAssets[i]->is<ImageAsset>())
+        {
+            CHECK(firstAssets[i]->as<ImageAsset>()->renderImage() ==
+                  secondAssets[i]->as<ImageAsset>()->renderImage());
+        }
+    }
+
+    // Each asset releases its use when its file goes away.
+    size_t count = factory.imageCache()->count();
+    first = nullptr;
+    factory.imageCache()->purgeUnused();
+    CHECK(factory.imageCache()->count() == count);
+    second = nullptr;
+    factory.imageCache()->purgeUnused();
+    CHECK(factory.imageCache()->count() == 0);
+}
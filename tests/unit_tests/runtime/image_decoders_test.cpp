@@ -78,4 +78,113 @@ TEST_CASE("webp file decodes correctly", "[image-decoder]")
 
     REQUIRE(bitmap->width() == 550);
     REQUIRE(bitmap->height() == 368);
-}
\ No newline at end of file
+}
+
+TEST_CASE("png file decodes to a target size", "[image-decoder]")
+{
+    auto file = ReadFile("assets/placeholder.png");
+    auto bitmap = Bitmap::decode(file.data(), file.size(), 50, 30);
+
+    REQUIRE(bitmap != nullptr);
+    // Halved twice, once more would be shorter than the target.
+    REQUIRE(bitmap->width() == 56);
+    REQUIRE(bitmap->height() == 32);
+    REQUIRE(bitmap->sourceWidth() == 226);
+    REQUIRE(bitmap->sourceHeight() == 128);
+
+    // Targets larger than the image never upscale.
+    bitmap = Bitmap::decode(file.data(), file.size(), 1000, 1000);
+    REQUIRE(bitmap != nullptr);
+    REQUIRE(bitmap->width() == 226);
+    REQUIRE(bitmap->height() == 128);
+}
+
+TEST_CASE("jpeg file decodes to a target size", "[image-decoder]")
+{
+    auto file = ReadFile("assets/open_source.jpg");
+    auto bitmap = Bitmap::decode(file.data(), file.size(), 40, 40);
+
+    REQUIRE(bitmap != nullptr);
+    REQUIRE(bitmap->width() >= 40);
+    REQUIRE(bitmap->height() == 50);
+    REQUIRE(bitmap->sourceWidth() == 350);
+    REQUIRE(bitmap->sourceHeight() == 200);
+}
+
+TEST_CASE("webp file decodes to a target size", "[image-decoder]")
+{
+    auto file = ReadFile("assets/1.webp");
+    auto bitmap = Bitmap::decode(file.data(), file.size(), 275, 0);
+
+    REQUIRE(bitmap != nullptr);
+    REQUIRE(bitmap->width() == 275);
+    REQUIRE(bitmap->height() == 184);
+    REQUIRE(bitmap->sourceWidth() == 550);
+    REQUIRE(bitmap->sourceHeight() == 368);
+}
+
+TEST_CASE("bitmaps downsample with a box filter", "[image-decoder]")
+{
+    const uint8_t pixels[] = {
+        0,   0,   0,   0,   100, 200, 40, 255, // row 0
+        200, 100, 20,  255, 100, 100, 0,  255, // row 1
+    };
+    auto bytes = std::make_unique<uint8_t[]>(sizeof(pixels));
+    memcpy(bytes.get(), pixels, sizeof(pixels));
+    Bitmap bitmap(2, 2, Bitmap::PixelFormat::RGBA, std::move(bytes));
+
+    bitmap.downsample(1, 1);
+    REQUIRE(bitmap.width() == 1);
+    REQUIRE(bitmap.height() == 1);
+    CHECK(bitmap.pixelFormat() == Bitmap::PixelFormat::RGBAPremul);
+    const uint8_t* avg = bitmap.bytes();
+    CHECK(avg[0] == 100);
+    CHECK(avg[1] == 100);
+    CHECK(avg[2] == 15);
+    CHECK(avg[3] == 191);
+}
+
+TEST_CASE("downsampled pngs don't bleed transparent colors",
+          "[image-decoder]")
+{
+    // 6x6 opaque red, surrounded by a 1 pixel border of transparent white.
+    auto file = ReadFile("assets/transparent_border.png");
+    auto bitmap = Bitmap::decode(file.data(), file.size(), 4, 4);
+    REQUIRE(bitmap != nullptr);
+    REQUIRE(bitmap->width() == 4);
+    REQUIRE(bitmap->height() == 4);
+    REQUIRE(bitmap->pixelFormat() == Bitmap::PixelFormat::RGBAPremul);
+
+    const uint8_t* pixels = bitmap->bytes();
+    // Corners average one red pixel with three transparent ones, edges two.
+    // Premultiplied, the transparent white contributes nothing.
+    const uint8_t* corner = pixels;
+    CHECK(corner[0] == 64);
+    CHECK(corner[1] == 0);
+    CHECK(corner[2] == 0);
+    CHECK(corner[3] == 64);
+    const uint8_t* edge = pixels + 4;
+    CHECK(edge[0] == 128);
+    CHECK(edge[1] == 0);
+    CHECK(edge[2] == 0);
+    CHECK(edge[3] == 128);
+    const uint8_t* center = pixels + (4 + 1) * 4;
+    CHECK(center[0] == 255);
+    CHECK(center[1] == 0);
+    CHECK(center[2] == 0);
+    CHECK(center[3] == 255);
+}
+
+TEST_CASE("bitmaps downsample down to their target size", "[image-decoder]")
+{
+    auto file = ReadFile("assets/placeholder.png");
+    auto bitmap = Bitmap::decode(file.data(), file.size());
+    REQUIRE(bitmap != nullptr);
+
+    bitmap->downsample(50, 20);
+    CHECK(bitmap->width() == 56);
+    CHECK(bitmap->height() == 32);
+    bitmap->downsample(1, 1);
+    CHECK(bitmap->width() == 1);
+    CHECK(bitmap->height() == 1);
+}
@@ -1,9 +1,13 @@
 #include "rive/animation/state_machine_instance.hpp"
+#include "rive/assets/image_asset.hpp"
 #include "rive/layout/layout_component_style.hpp"
 #include "rive/layout/layout_enums.hpp"
 #include "rive/math/transform_components.hpp"
+#include "rive/nested_artboard.hpp"
+#include "rive/shapes/image.hpp"
 #include "rive/shapes/rectangle.hpp"
 #include "rive/text/text.hpp"
+#include "rive/text/text_value_run.hpp"
 #include "utils/no_op_factory.hpp"
 #include "rive_file_reader.hpp"
 #include "rive_testing.hpp"
@@ -163,6 +167,166 @@ TEST_CASE("LayoutComponent with intrinsic size gets measured correctly",
     REQUIRE(bounds.height() == 72.62695f);
 }
 
+namespace
+{
+class SizedImage : public rive::RenderImage
+{
+public:
+    SizedImage(int width, int height)
+    {
+        m_Width = width;
+        m_Height = height;
+    }
+};
+} // namespace
+
+TEST_CASE("LayoutComponent memoizes measures until an image changes",
+          "[layout]")
+{
+    auto file = ReadRiveFile("assets/data_binding_images_test.riv");
+
+    auto artboard = file->artboard("static");
+    REQUIRE(artboard != nullptr);
+    auto image = artboard->find<rive::Image>("static_img");
+    REQUIRE(image != nullptr);
+    REQUIRE(image->parent() == artboard);
+    REQUIRE(image->imageAsset() != nullptr);
+
+    artboard->advance(0.0f);
+    auto undefined = rive::LayoutMeasureMode::undefined;
+    auto atMost = rive::LayoutMeasureMode::atMost;
+    int measureCount = artboard->measureCount;
+
+    // Constraints Yoga hasn't asked for yet miss, then hit.
+    CHECK(artboard->measureLayoutCached(333.0f, atMost, 222.0f, atMost) ==
+          rive::Vec2D(333.0f, 222.0f));
+    CHECK(artboard->measureCount == measureCount + 1);
+    CHECK(artboard->measureLayoutCached(333.0f, atMost, 222.0f, atMost) ==
+          rive::Vec2D(333.0f, 222.0f));
+    CHECK(artboard->measureCount == measureCount + 1);
+
+    // Undefined dimensions match whatever value they're passed with.
+    auto size = artboard->measureLayoutCached(NAN, undefined, NAN, undefined);
+    measureCount = artboard->measureCount;
+    CHECK(artboard->measureLayoutCached(0.0f, undefined, 1.0f, undefined) ==
+          size);
+    CHECK(artboard->measureCount == measureCount);
+
+    // Swapping the image changes its intrinsic size.
+    image->imageAsset()->renderImage(rive::make_rcp<SizedImage>(120, 80));
+    CHECK(artboard->measureLayoutCached(NAN, undefined, NAN, undefined) ==
+          rive::Vec2D(120.0f, 80.0f));
+    CHECK(artboard->measureCount == measureCount + 1);
+    CHECK(artboard->measureLayoutCached(NAN, undefined, NAN, undefined) ==
+          rive::Vec2D(120.0f, 80.0f));
+    CHECK(artboard->measureCount == measureCount + 1);
+}
+
+TEST_CASE("LayoutComponent measures again when a nested artboard resizes",
+          "[layout]")
+{
+    auto file = ReadRiveFile("assets/data_binding_images_test.riv");
+
+    auto artboard = file->artboardNamed("main");
+    REQUIRE(artboard != nullptr);
+    auto nested = artboard->find<rive::NestedArtboard>("static");
+    REQUIRE(nested != nullptr);
+    REQUIRE(nested->parent() == artboard.get());
+    REQUIRE(nested->artboardInstance() != nullptr);
+
+    artboard->advance(0.0f);
+    auto undefined = rive::LayoutMeasureMode::undefined;
+    artboard->measureLayoutCached(NAN, undefined, NAN, undefined);
+    int measureCount = artboard->measureCount;
+
+    // Larger than anything else in the artboard, so it decides the measure.
+    nested->artboardInstance()->width(2000.0f);
+    nested->artboardInstance()->height(1500.0f);
+    CHECK(artboard->measureLayoutCached(NAN, undefined, NAN, undefined) ==
+          rive::Vec2D(2000.0f, 1500.0f));
+    CHECK(artboard->measureCount == measureCount + 1);
+    CHECK(artboard->measureLayoutCached(NAN, undefined, NAN, undefined) ==
+          rive::Vec2D(2000.0f, 1500.0f));
+    CHECK(artboard->measureCount == measureCount + 1);
+
+    // Swapping in another instance.
+    auto swapped = file->artboardNamed("sub_1");
+    REQUIRE(swapped != nullptr);
+    swapped->width(2500.0f);
+    swapped->height(1600.0f);
+    nested->nest(swapped.release());
+    CHECK(artboard->measureLayoutCached(NAN, undefined, NAN, undefined) ==
+          rive::Vec2D(2500.0f, 1600.0f));
+    CHECK(artboard->measureCount == measureCount + 2);
+}
+
+TEST_CASE("LayoutComponent measures again after its text is reshaped",
+          "[layout]")
+{
+    auto file = ReadRiveFile("assets/layout/measure_tests.riv");
+
+    auto artboard = file->artboard("hi");
+    auto layout = artboard->find<rive::LayoutComponent>("TextLayout");
+    auto text = artboard->find<rive::Text>("HiText");
+    REQUIRE(layout != nullptr);
+    REQUIRE(text != nullptr);
+    REQUIRE(text->runs().size() > 0);
+
+    artboard->advance(0.0f);
+    CHECK(layout->measureCount > 0);
+    auto undefined = rive::LayoutMeasureMode::undefined;
+    auto size = layout->measureLayoutCached(NAN, undefined, NAN, undefined);
+    int measureCount = layout->measureCount;
+    CHECK(layout->measureLayoutCached(NAN, undefined, NAN, undefined) ==
+          size);
+    CHECK(layout->measureCount == measureCount);
+
+    text->runs()[0]->text("a much longer line of text");
+    artboard->advance(0.0f);
+    CHECK(layout->measureCount > measureCount);
+    auto longer = layout->measureLayoutCached(NAN, undefined, NAN, undefined);
+    CHECK(longer.x > size.x);
+}
+
+TEST_CASE("LayoutComponent style changes only dirty the changed node",
+          "[layout]")
+{
+    auto file = ReadRiveFile("assets/layout/layout_horizontal.riv");
+
+    auto artboard = file->artboard();
+    auto target1 = artboard->find<rive::LayoutComponent>("LayoutComponent1");
+    auto target2 = artboard->find<rive::LayoutComponent>("LayoutComponent2");
+    auto target3 = artboard->find<rive::LayoutComponent>("LayoutComponent3");
+    REQUIRE(target1 != nullptr);
+    REQUIRE(target2 != nullptr);
+    REQUIRE(target3 != nullptr);
+
+    artboard->advance(0.0f);
+    int dirty1 = target1->styleDirtyCount;
+    int dirty2 = target2->styleDirtyCount;
+    int dirty3 = target3->styleDirtyCount;
+    int measure1 = target1->measureCount;
+    int measure3 = target3->measureCount;
+    float width = target2->width();
+    float x3 = target3->worldTransform().decompose().x();
+
+    // Changing a value and setting it back before the next advance leaves
+    // the Yoga style as it was.
+    target2->width(width + 50.0f);
+    target2->width(width);
+    artboard->advance(0.0f);
+    CHECK(target2->styleDirtyCount == dirty2);
+
+    target2->width(width + 50.0f);
+    artboard->advance(0.0f);
+    CHECK(target2->styleDirtyCount == dirty2 + 1);
+    CHECK(target1->styleDirtyCount == dirty1);
+    CHECK(target3->styleDirtyCount == dirty3);
+    CHECK(target1->measureCount == measure1);
+    CHECK(target3->measureCount == measure3);
+    CHECK(target3->worldTransform().decompose().x() == x3 + 50.0f);
+}
+
 TEST_CASE("LayoutComponent Padding Px", "[layout]")
 {
     auto file = ReadRiveFile("assets/layout/layout_complex1.riv");
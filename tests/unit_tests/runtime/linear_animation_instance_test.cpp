@@ -413,3 +413,39 @@ TEST_CASE("LinearAnimationInstance override loop", "[animation]")
     delete linearAnimationInstance;
     delete linearAnimation;
 }
+
+TEST_CASE("LinearAnimationInstance restart", "[animation]")
+{
+    rive::NoOpFactory emptyFactory;
+    rive::Artboard ab(&emptyFactory);
+    auto abi = ab.instance();
+
+    rive::LinearAnimation* linearAnimation = new rive::LinearAnimation();
+    // duration in seconds is 5
+    linearAnimation->duration(10);
+    linearAnimation->fps(2);
+    linearAnimation->loopValue(static_cast<int>(rive::Loop::oneShot));
+
+    rive::LinearAnimationInstance* linearAnimationInstance =
+        new rive::LinearAnimationInstance(linearAnimation, abi.get());
+
+    linearAnimationInstance->advance(10.0);
+    REQUIRE(linearAnimationInstance->didLoop() == true);
+
+    // A restarted instance plays exactly like a freshly created one.
+    linearAnimationInstance->restart(1.0f);
+    REQUIRE(linearAnimationInstance->time() == 0.0f);
+    REQUIRE(linearAnimationInstance->totalTime() == 0.0f);
+    REQUIRE(linearAnimationInstance->didLoop() == false);
+    bool continuePlaying = linearAnimationInstance->advance(2.0);
+    REQUIRE(continuePlaying == true);
+    REQUIRE(linearAnimationInstance->time() == 2.0);
+    REQUIRE(linearAnimationInstance->totalTime() == 2.0);
+
+    // Playing backwards starts from the end.
+    linearAnimationInstance->restart(-1.0f);
+    REQUIRE(linearAnimationInstance->time() == 5.0f);
+
+    delete linearAnimationInstance;
+    delete linearAnimation;
+}
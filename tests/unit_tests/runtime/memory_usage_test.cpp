@@ -0,0 +1,68 @@
+#include "rive/file.hpp"
+#include "rive/memory_usage.hpp"
+#include "rive/animation/state_machine_instance.hpp"
+#include "utils/no_op_renderer.hpp"
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+
+using namespace rive;
+
+static size_t sumOfCategories(const MemoryUsage& usage)
+{
+    return usage.objects + usage.paths + usage.animation + usage.text +
+           usage.assets + usage.factoryResources;
+}
+
+TEST_CASE("objects are measured by their concrete type", "[memory]")
+{
+    auto file = ReadRiveFile("assets/shapetest.riv");
+    auto artboard = file->artboardDefault();
+    CHECK(MemoryUsage::objectBytes(artboard.get()) == sizeof(Artboard));
+    CHECK(MemoryUsage::objectBytes(nullptr) == 0);
+}
+
+TEST_CASE("file memory usage includes animations and assets", "[memory]")
+{
+    auto file = ReadRiveFile("assets/rocket.riv");
+    auto usage = file->memoryUsage();
+    CHECK(usage.objects > 0);
+    CHECK(usage.animation > 0);
+    CHECK(usage.total() == sumOfCategories(usage));
+
+    auto imageFile = ReadRiveFile("assets/walle.riv");
+    CHECK(imageFile->memoryUsage().assets > 0);
+}
+
+TEST_CASE("artboard instances report their own paths", "[memory]")
+{
+    auto file = ReadRiveFile("assets/shapetest.riv");
+    auto artboard = file->artboardDefault();
+
+    // Animations belong to the source artboard.
+    auto before = artboard->memoryUsage();
+    CHECK(before.objects > 0);
+    CHECK(before.animation == 0);
+    CHECK(before.factoryResources == 0);
+
+    artboard->advance(0.0f);
+    NoOpRenderer renderer;
+    artboard->draw(&renderer);
+    auto after = artboard->memoryUsage();
+    CHECK(after.objects == before.objects);
+    CHECK(after.paths > before.paths);
+    CHECK(after.factoryResources > 0);
+    CHECK(after.total() == sumOfCategories(after));
+}
+
+TEST_CASE("state machine instances report their runtime state", "[memory]")
+{
+    auto file = ReadRiveFile("assets/rocket.riv");
+    auto artboard = file->artboardDefault();
+    auto machine = artboard->stateMachineAt(0);
+    REQUIRE(machine != nullptr);
+    machine->advanceAndApply(0.0f);
+
+    auto usage = machine->memoryUsage();
+    CHECK(usage.animation > sizeof(StateMachineInstance));
+    CHECK(usage.total() == sumOfCategories(usage));
+}
@@ -0,0 +1,159 @@
+#include "rive/profiler/profiler.hpp"
+#include <catch.hpp>
+#include <atomic>
+#include <thread>
+
+using namespace rive;
+
+static const Profiler::ScopeStats* find_stats(
+    const std::vector<Profiler::ScopeStats>& stats,
+    const char* name)
+{
+    for (const Profiler::ScopeStats& entry : stats)
+    {
+        if (entry.name == name)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+TEST_CASE("profiler counts nested scopes and their allocations", "[profiler]")
+{
+    Profiler::reset();
+    for (int i = 0; i < 3; i++)
+    {
+        Profiler::Scope outer("outer");
+        Profiler::recordAllocation(100);
+        {
+            Profiler::Scope inner("inner");
+            Profiler::recordAllocation(8);
+            Profiler::recordAllocation(8);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    // Allocations outside of any scope aren't attributed.
+    Profiler::recordAllocation(1000);
+
+    auto stats = Profiler::stats();
+    auto outer = find_stats(stats, "outer");
+    auto inner = find_stats(stats, "inner");
+    REQUIRE(outer != nullptr);
+    REQUIRE(inner != nullptr);
+    CHECK(outer->count == 3);
+    CHECK(inner->count == 3);
+    CHECK(outer->allocationCount == 3);
+    CHECK(outer->allocatedBytes == 300);
+    CHECK(inner->allocationCount == 6);
+    CHECK(inner->allocatedBytes == 48);
+    CHECK(inner->totalNanoseconds >= 3000000);
+    CHECK(inner->maxNanoseconds <= inner->totalNanoseconds);
+    CHECK(outer->totalNanoseconds >= inner->totalNanoseconds);
+    // Longest first.
+    CHECK(stats.front().name == "outer");
+
+    Profiler::reset();
+    CHECK(find_stats(Profiler::stats(), "outer") == nullptr);
+}
+
+TEST_CASE("profiler records nothing while disabled", "[profiler]")
+{
+    Profiler::reset();
+    Profiler::enabled(false);
+    {
+        Profiler::Scope scope("disabled");
+        Profiler::frame();
+    }
+    Profiler::enabled(true);
+    CHECK(find_stats(Profiler::stats(), "disabled") == nullptr);
+    CHECK(Profiler::frameCount() == 0);
+
+    Profiler::frame();
+    CHECK(Profiler::frameCount() == 1);
+}
+
+TEST_CASE("profiler merges scopes across threads", "[profiler]")
+{
+    Profiler::reset();
+    {
+        Profiler::Scope scope("shared");
+    }
+    std::thread worker([]() {
+        Profiler::threadName("worker");
+        for (int i = 0; i < 4; i++)
+        {
+            Profiler::Scope scope("shared");
+        }
+    });
+    worker.join();
+
+    auto shared = find_stats(Profiler::stats(), "shared");
+    REQUIRE(shared != nullptr);
+    CHECK(shared->count == 5);
+
+    Profiler::frame();
+    std::string trace = Profiler::chromeTraceJSON();
+    CHECK(trace.find("\"traceEvents\"") != std::string::npos);
+    CHECK(trace.find("\"name\":\"shared\",\"ph\":\"X\"") != std::string::npos);
+    CHECK(trace.find("\"name\":\"Frame\",\"ph\":\"i\"") != std::string::npos);
+    CHECK(trace.find("\"thread_name\"") != std::string::npos);
+    CHECK(trace.find("\"name\":\"worker\"") != std::string::npos);
+}
+
+TEST_CASE("profiler reuses the buffers of exited threads", "[profiler]")
+{
+    Profiler::reset();
+    // Make sure there's a buffer to reuse.
+    std::thread([]() { Profiler::Scope scope("reused"); }).join();
+    size_t bufferCount = Profiler::threadBufferCount();
+    for (int i = 0; i < 8; i++)
+    {
+        std::thread([]() {
+            Profiler::threadName("short lived");
+            Profiler::Scope scope("reused");
+        }).join();
+    }
+    CHECK(Profiler::threadBufferCount() == bufferCount);
+
+    // Exited threads still count once their buffer is taken over.
+    auto reused = find_stats(Profiler::stats(), "reused");
+    REQUIRE(reused != nullptr);
+    CHECK(reused->count == 9);
+}
+
+TEST_CASE("profiler resets threads that are still recording", "[profiler]")
+{
+    Profiler::reset();
+    std::atomic<int> step{0};
+    std::thread worker([&step]() {
+        {
+            Profiler::Scope scope("before reset");
+        }
+        step = 1;
+        while (step != 2)
+        {
+            std::this_thread::yield();
+        }
+        Profiler::Scope scope("after reset");
+    });
+    while (step != 1)
+    {
+        std::this_thread::yield();
+    }
+    CHECK(find_stats(Profiler::stats(), "before reset") != nullptr);
+
+    // The worker hasn't seen the reset yet, its buffer is ignored meanwhile.
+    Profiler::reset();
+    CHECK(find_stats(Profiler::stats(), "before reset") == nullptr);
+    CHECK(Profiler::chromeTraceJSON().find("before reset") ==
+          std::string::npos);
+
+    step = 2;
+    worker.join();
+    auto stats = Profiler::stats();
+    CHECK(find_stats(stats, "before reset") == nullptr);
+    auto after = find_stats(stats, "after reset");
+    REQUIRE(after != nullptr);
+    CHECK(after->count == 1);
+}
@@ -0,0 +1,67 @@
+#include "catch.hpp"
+#include "scripting_test_utilities.hpp"
+#include "rive/lua/rive_lua_libs.hpp"
+
+using namespace rive;
+
+TEST_CASE("path addPolyline matches moveTo and lineTo", "[scripting]")
+{
+    ScriptingTest vm(R"(local points = {
+	Vec2D.xy(0, 0),
+	Vec2D.xy(10, 0),
+	Vec2D.xy(10, 10),
+	Vec2D.xy(0, 10),
+}
+local batched: Path = Path.new()
+batched:addPolyline(points, true)
+batched:addPolyline(points)
+
+local manual: Path = Path.new()
+manual:moveTo(points[1])
+for i = 2, #points do
+	manual:lineTo(points[i])
+end
+manual:close()
+manual:moveTo(points[1])
+for i = 2, #points do
+	manual:lineTo(points[i])
+end
+return batched, manual
+)",
+                     2);
+    lua_State* L = vm.state();
+    auto batched = lua_torive<ScriptedPath>(L, -2);
+    auto manual = lua_torive<ScriptedPath>(L, -1);
+    CHECK(batched->rawPath.verbs().size() == 10);
+    CHECK(batched->rawPath == manual->rawPath);
+}
+
+TEST_CASE("path addPolyline rejects non vector points", "[scripting]")
+{
+    ScriptingTest vm(R"(local path: Path = Path.new()
+path:addPolyline({Vec2D.xy(0, 0), 12})
+)",
+                     0,
+                     true);
+    lua_State* L = vm.state();
+    CHECK(lua_tostring(L, -1) ==
+          std::string("test_source:2: addPolyline expects an array of Vec2D"));
+}
+
+TEST_CASE("path addPolyline leaves the path unchanged on error", "[scripting]")
+{
+    ScriptingTest vm(R"(local path: Path = Path.new()
+path:moveTo(Vec2D.xy(1, 1))
+local ok = pcall(function()
+	path:addPolyline({Vec2D.xy(0, 0), Vec2D.xy(5, 5), 12})
+end)
+return path, ok
+)",
+                     2);
+    lua_State* L = vm.state();
+    auto path = lua_torive<ScriptedPath>(L, -2);
+    CHECK(lua_toboolean(L, -1) == 0);
+    REQUIRE(path->rawPath.verbs().size() == 1);
+    CHECK(path->rawPath.verbs()[0] == PathVerb::move);
+    CHECK(path->rawPath.points().size() == 1);
+}
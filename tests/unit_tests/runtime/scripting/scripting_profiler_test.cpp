@@ -0,0 +1,92 @@
+#include "catch.hpp"
+#include "scripting_test_utilities.hpp"
+#include "rive/lua/rive_lua_libs.hpp"
+
+using namespace rive;
+
+static const char* profiledSource = R"(function busy(n: number): number
+	local t = {}
+	for i = 1, n do
+		t[i] = { i }
+	end
+	return #t
+end
+
+function idle(): number
+	return 1
+end
+
+function spin(): ()
+	while true do
+	end
+end
+)";
+
+TEST_CASE("profiler attributes cost to scopes", "[scripting]")
+{
+    ScriptingTest vm(profiledSource, 0);
+    lua_State* L = vm.state();
+    CHECK(vm.vm()->profiler() == nullptr);
+    auto profiler = vm.vm()->enableProfiler();
+    REQUIRE(profiler != nullptr);
+    CHECK(vm.vm()->enableProfiler() == profiler);
+
+    for (int i = 0; i < 2; i++)
+    {
+        lua_getglobal(L, "busy");
+        lua_pushnumber(L, 1000);
+        CHECK(vm.vm()->pcall("busy", 1, 1) == LUA_OK);
+        CHECK(lua_tonumber(L, -1) == 1000);
+        lua_pop(L, 1);
+    }
+    lua_getglobal(L, "idle");
+    CHECK(vm.vm()->pcall("idle", 0, 1) == LUA_OK);
+    lua_pop(L, 1);
+
+    auto busy = profiler->stats("busy");
+    auto idle = profiler->stats("idle");
+    REQUIRE(busy != nullptr);
+    REQUIRE(idle != nullptr);
+    CHECK(profiler->stats("missing") == nullptr);
+    CHECK(busy->calls == 2);
+    CHECK(idle->calls == 1);
+    CHECK(busy->steps >= 2000);
+    CHECK(busy->steps > idle->steps);
+    CHECK(busy->allocations >= 2000);
+    CHECK(busy->allocatedBytes > idle->allocatedBytes);
+    CHECK(busy->seconds >= 0.0);
+    CHECK(busy->aborts == 0);
+
+    profiler->clear();
+    CHECK(profiler->stats("busy")->calls == 0);
+    CHECK(profiler->stats("busy")->steps == 0);
+}
+
+TEST_CASE("profiler step budget aborts runaway scripts", "[scripting]")
+{
+    ScriptingTest vm(profiledSource, 0);
+    lua_State* L = vm.state();
+    auto profiler = vm.vm()->enableProfiler();
+    profiler->stepBudget(500);
+
+    profiler->beginFrame();
+    lua_getglobal(L, "spin");
+    CHECK(vm.vm()->pcall("spin", 0, 0) == LUA_ERRRUN);
+    CHECK(std::string(lua_tostring(L, -1)).find("exceeded the step budget") !=
+          std::string::npos);
+    lua_pop(L, 1);
+    CHECK(profiler->stats("spin")->aborts == 1);
+
+    // The budget stays spent until the next frame.
+    lua_getglobal(L, "busy");
+    lua_pushnumber(L, 10);
+    CHECK(vm.vm()->pcall("busy", 1, 1) == LUA_ERRRUN);
+    lua_pop(L, 1);
+
+    profiler->beginFrame();
+    lua_getglobal(L, "busy");
+    lua_pushnumber(L, 10);
+    CHECK(vm.vm()->pcall("busy", 1, 1) == LUA_OK);
+    CHECK(lua_tonumber(L, -1) == 10);
+    lua_pop(L, 1);
+}
@@ -78,6 +78,7 @@ public:
     void unregisterModule(const char* name) { m_vm->unregisterModule(name); }
 
     lua_State* state() { return m_vm->state(); }
+    ScriptingVM* vm() { return m_vm.get(); }
 
 public:
     SerializingFactory* serializer() { return &m_factory; }
@@ -0,0 +1,194 @@
+#include "rive/artboard_component_list.hpp"
+#include "rive/file.hpp"
+#include "rive/shapes/path.hpp"
+#include "rive/shapes/path_vertex.hpp"
+#include "rive/shapes/paint/shape_paint.hpp"
+#include "rive/shapes/shape.hpp"
+#include "utils/no_op_renderer.hpp"
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+#include <unordered_set>
+
+using namespace rive;
+
+static ShapePaintPath* composedPath(Shape* shape)
+{
+    return shape->isFlagged(PathFlags::world)
+               ? shape->pathComposer()->worldPath()
+               : shape->pathComposer()->localPath();
+}
+
+namespace
+{
+class PathRecordingRenderer : public NoOpRenderer
+{
+public:
+    void drawPath(RenderPath* path, RenderPaint*) override
+    {
+        drawCount++;
+        paths.insert(path);
+    }
+
+    int drawCount = 0;
+    std::unordered_set<RenderPath*> paths;
+};
+} // namespace
+
+TEST_CASE("identical instances share render paths", "[instancing]")
+{
+    auto file = ReadRiveFile("assets/shapetest.riv");
+    auto first = file->artboardDefault();
+    auto second = file->artboardDefault();
+    first->advance(0.0f);
+    second->advance(0.0f);
+
+    auto source = first->find<Shape>("Ellipse");
+    auto shape = second->find<Shape>("Ellipse");
+    REQUIRE(source != nullptr);
+    REQUIRE(shape != nullptr);
+
+    // Nothing to share until the source has built its render paths.
+    std::vector<ShapePaintPath*> shared;
+    shape->shareRenderPaths(source, shared);
+    CHECK(shared.empty());
+
+    NoOpRenderer renderer;
+    first->draw(&renderer);
+    shape->shareRenderPaths(source, shared);
+    REQUIRE(!shared.empty());
+    CHECK(composedPath(shape)->sharesRenderPath());
+    CHECK(composedPath(shape)->renderPath(shape) ==
+          composedPath(source)->renderPath(source));
+
+    for (auto path : shared)
+    {
+        path->stopSharingRenderPath();
+    }
+    CHECK(composedPath(shape)->renderPath(shape) !=
+          composedPath(source)->renderPath(source));
+}
+
+TEST_CASE("instances animated away from the source don't share",
+          "[instancing]")
+{
+    auto file = ReadRiveFile("assets/shapetest.riv");
+    auto first = file->artboardDefault();
+    auto second = file->artboardDefault();
+    first->advance(0.0f);
+    second->advance(0.0f);
+
+    auto source = first->find<Shape>("Ellipse");
+    auto shape = second->find<Shape>("Ellipse");
+    NoOpRenderer renderer;
+    first->draw(&renderer);
+
+    std::vector<ShapePaintPath*> shared;
+    shape->shareRenderPaths(source, shared);
+    REQUIRE(!shared.empty());
+
+    // Rebuilding the geometry drops the shared render path.
+    for (auto path : shape->paths())
+    {
+        for (auto vertex : path->vertices())
+        {
+            vertex->x(vertex->x() + 10.0f);
+        }
+    }
+    second->advance(0.0f);
+    CHECK(!composedPath(shape)->sharesRenderPath());
+
+    shared.clear();
+    shape->shareRenderPaths(source, shared);
+    CHECK(shared.empty());
+    CHECK(composedPath(shape)->renderPath(shape) !=
+          composedPath(source)->renderPath(source));
+}
+
+TEST_CASE("identical instances only compare their geometry after it changes",
+          "[instancing]")
+{
+    auto file = ReadRiveFile("assets/shapetest.riv");
+    auto first = file->artboardDefault();
+    auto second = file->artboardDefault();
+    first->advance(0.0f);
+    second->advance(0.0f);
+
+    auto source = first->find<Shape>("Ellipse");
+    auto shape = second->find<Shape>("Ellipse");
+    NoOpRenderer renderer;
+    first->draw(&renderer);
+
+    std::vector<ShapePaintPath*> shared;
+    shape->shareRenderPaths(source, shared);
+    REQUIRE(!shared.empty());
+    CHECK(composedPath(shape)->geometryComparisons == 1);
+
+    // Neither path changed, so the last match still holds.
+    composedPath(shape)->stopSharingRenderPath();
+    shape->shareRenderPaths(source, shared);
+    CHECK(composedPath(shape)->sharesRenderPath());
+    CHECK(composedPath(shape)->geometryComparisons == 1);
+
+    // Rebuilding the source's geometry, even to the same points, compares
+    // again.
+    composedPath(source)->rewind();
+    composedPath(source)->addPath(*composedPath(shape)->rawPath());
+    composedPath(source)->renderPath(source);
+    shape->shareRenderPaths(source, shared);
+    CHECK(composedPath(shape)->sharesRenderPath());
+    CHECK(composedPath(shape)->geometryComparisons == 2);
+}
+
+TEST_CASE("artboard list rows share render paths", "[instancing]")
+{
+    auto file = ReadRiveFile("assets/component_list_grouped.riv");
+    auto artboard = file->artboardNamed("MainArtboard");
+    auto stateMachine = artboard->stateMachineAt(0);
+    stateMachine->bindViewModelInstance(
+        file->createViewModelInstance(artboard->viewModelId(), 0));
+    stateMachine->advanceAndApply(0.1f);
+    auto list = artboard->find<ArtboardComponentList>("List");
+    REQUIRE(list != nullptr);
+    REQUIRE(list->artboardCount() > 1);
+
+    PathRecordingRenderer renderer;
+    list->draw(&renderer);
+    REQUIRE(renderer.drawCount > 0);
+    // Every row comes from the same artboard, so rows after the first draw
+    // with its paths.
+    int rowDrawCount = renderer.drawCount / list->artboardCount();
+    CHECK(renderer.drawCount == rowDrawCount * list->artboardCount());
+    CHECK(renderer.paths.size() == (size_t)rowDrawCount);
+
+    // Sharing only lasts for the draw.
+    auto row = list->artboardInstance(1);
+    int comparisons = 0;
+    for (auto shape : row->find<Shape>())
+    {
+        for (auto paint : shape->shapePaints())
+        {
+            if (auto path = paint->pickPath(shape))
+            {
+                CHECK(!path->sharesRenderPath());
+                comparisons += path->geometryComparisons;
+            }
+        }
+    }
+    CHECK(comparisons > 0);
+
+    // Drawing again with nothing changed doesn't compare any geometry.
+    PathRecordingRenderer nextRenderer;
+    list->draw(&nextRenderer);
+    CHECK(nextRenderer.paths == renderer.paths);
+    for (auto shape : row->find<Shape>())
+    {
+        for (auto paint : shape->shapePaints())
+        {
+            if (auto path = paint->pickPath(shape))
+            {
+                comparisons -= path->geometryComparisons;
+            }
+        }
+    }
+    CHECK(comparisons == 0);
+}
@@ -9,6 +9,7 @@
 #include <rive/animation/state_machine_input_instance.hpp>
 #include <rive/animation/blend_state_1d.hpp>
 #include <rive/animation/blend_animation_1d.hpp>
+#include <rive/animation/blend_state_1d_instance.hpp>
 #include <rive/animation/blend_state_direct.hpp>
 #include <rive/animation/blend_state_transition.hpp>
 #include <rive/animation/animation_reset_factory.hpp>
@@ -18,6 +19,7 @@
 #include "catch.hpp"
 #include "rive_file_reader.hpp"
 #include <cstdio>
+#include <limits>
 
 TEST_CASE("file with state machine be read", "[file]")
 {
@@ -502,3 +504,254 @@ TEST_CASE("Triggers will only be used on allowed state changes.", "[file]")
 
     delete stateMachineInstance;
 }
+
+TEST_CASE("Settled state machines sleep until woken", "[file]")
+{
+    auto file = ReadRiveFile("assets/state_machine_triggers.riv");
+
+    auto artboard = file->artboard("main");
+    REQUIRE(artboard != nullptr);
+    auto stateMachine = artboard->stateMachine("State Machine 1");
+    REQUIRE(stateMachine != nullptr);
+
+    auto abi = artboard->instance();
+    rive::StateMachineInstance* stateMachineInstance =
+        new rive::StateMachineInstance(stateMachine, abi.get());
+    stateMachineInstance->sleepWhenSettled(true);
+
+    bool settled = false;
+    for (int i = 0; i < 100 && !settled; i++)
+    {
+        settled = !stateMachineInstance->advanceAndApply(0.1f);
+    }
+    REQUIRE(settled);
+    REQUIRE(stateMachineInstance->isSleeping());
+    REQUIRE(stateMachineInstance->secondsUntilWake() ==
+            std::numeric_limits<float>::infinity());
+    auto settledState = stateMachineInstance->layerState(0);
+
+    // Sleeping instances skip advancing entirely.
+    REQUIRE(!stateMachineInstance->advanceAndApply(0.1f));
+    REQUIRE(stateMachineInstance->isSleeping());
+
+    // Changing an input wakes the instance up again.
+    stateMachineInstance->getTrigger("Trigger 1")->fire();
+    REQUIRE(!stateMachineInstance->isSleeping());
+    REQUIRE(stateMachineInstance->secondsUntilWake() == 0.0f);
+    stateMachineInstance->advanceAndApply(0.1f);
+    REQUIRE(stateMachineInstance->layerState(0) != settledState);
+
+    // Explicitly woken instances settle again.
+    settled = false;
+    for (int i = 0; i < 100 && !settled; i++)
+    {
+        settled = !stateMachineInstance->advanceAndApply(0.1f);
+    }
+    REQUIRE(stateMachineInstance->isSleeping());
+    stateMachineInstance->wake();
+    REQUIRE(!stateMachineInstance->isSleeping());
+
+    // Turning sleeping off keeps the instance awake.
+    stateMachineInstance->sleepWhenSettled(false);
+    stateMachineInstance->advanceAndApply(0.1f);
+    REQUIRE(!stateMachineInstance->isSleeping());
+
+    delete stateMachineInstance;
+}
+
+TEST_CASE("Transitions are re-evaluated when their inputs change", "[file]")
+{
+    auto file = ReadRiveFile("assets/state_machine_triggers.riv");
+
+    auto artboard = file->artboard("main");
+    REQUIRE(artboard != nullptr);
+    auto stateMachine = artboard->stateMachine("State Machine 1");
+    REQUIRE(stateMachine != nullptr);
+
+    // Every state only reads the trigger (input 0).
+    auto layer = stateMachine->layer(0);
+    for (size_t i = 0; i < layer->stateCount(); i++)
+    {
+        auto state = layer->state(i);
+        if (state->transitionsDependOnValues())
+        {
+            for (auto inputId : state->transitionInputIds())
+            {
+                REQUIRE(inputId == 0);
+            }
+            REQUIRE(!state->transitionsReadViewModel());
+        }
+    }
+
+    auto abi = artboard->instance();
+    rive::StateMachineInstance* stateMachineInstance =
+        new rive::StateMachineInstance(stateMachine, abi.get());
+    auto triggerInstance = stateMachineInstance->getTrigger("Trigger 1");
+    REQUIRE(triggerInstance != nullptr);
+
+    // Let the layer settle so its transitions stop being evaluated, then
+    // make sure a change to the input they read still gets through.
+    for (int i = 0; i < 20; i++)
+    {
+        stateMachineInstance->advanceAndApply(0.1f);
+    }
+    for (int flip = 0; flip < 4; flip++)
+    {
+        auto settledState = stateMachineInstance->layerState(0);
+        int evaluations = stateMachineInstance->transitionEvaluationCount;
+        for (int i = 0; i < 5; i++)
+        {
+            stateMachineInstance->advanceAndApply(0.1f);
+        }
+        REQUIRE(stateMachineInstance->layerState(0) == settledState);
+        // Nothing the transitions read changed, so they weren't evaluated.
+        CHECK(stateMachineInstance->transitionEvaluationCount == evaluations);
+
+        triggerInstance->fire();
+        stateMachineInstance->advanceAndApply(0.1f);
+        CHECK(stateMachineInstance->transitionEvaluationCount > evaluations);
+        REQUIRE(stateMachineInstance->layerState(0) != settledState);
+        for (int i = 0; i < 20; i++)
+        {
+            stateMachineInstance->advanceAndApply(0.1f);
+        }
+    }
+
+    delete stateMachineInstance;
+}
+
+TEST_CASE("Recycled state instances restart like fresh ones", "[file]")
+{
+    auto file = ReadRiveFile("assets/animation_reset_cases.riv");
+
+    auto artboard = file->artboard();
+    auto stateMachine = artboard->stateMachine("blend-states-state-machine");
+    REQUIRE(stateMachine != nullptr);
+    rive::AnimationResetFactory::releaseResources();
+
+    // Use a blend state that resets, so it borrows from the reset pool.
+    const rive::BlendState1D* blendState = nullptr;
+    auto layer = stateMachine->layer(0);
+    for (size_t i = 0; i < layer->stateCount(); i++)
+    {
+        auto state = layer->state(i);
+        auto flags = static_cast<rive::LayerStateFlags>(state->flags());
+        if (state->is<rive::BlendState1D>() &&
+            (flags & rive::LayerStateFlags::Reset) ==
+                rive::LayerStateFlags::Reset)
+        {
+            blendState = layer->state(i)->as<rive::BlendState1D>();
+            break;
+        }
+    }
+    REQUIRE(blendState != nullptr);
+
+    auto recycledArtboard = artboard->instance();
+    auto freshArtboard = artboard->instance();
+    rive::StateMachineInstance recycledMachine(stateMachine,
+                                               recycledArtboard.get());
+    rive::StateMachineInstance freshMachine(stateMachine, freshArtboard.get());
+    recycledMachine.getNumber("blend-value")->value(50);
+    freshMachine.getNumber("blend-value")->value(50);
+
+    // Play the state for a while on both artboards, the way a layer would
+    // before transitioning away (A -> B). Only one of the two instances is
+    // kept around.
+    auto recycled = blendState->makeInstance(recycledArtboard.get());
+    auto discarded = blendState->makeInstance(freshArtboard.get());
+    for (int i = 0; i < 5; i++)
+    {
+        recycled->advance(0.1f, &recycledMachine);
+        recycled->apply(recycledArtboard.get(), 1.0f);
+        discarded->advance(0.1f, &freshMachine);
+        discarded->apply(freshArtboard.get(), 1.0f);
+    }
+    recycled->recycle();
+    discarded.reset();
+    REQUIRE(rive::AnimationResetFactory::resourcesCount() == 2);
+
+    // Back into the state (B -> A): the recycled instance is reset while the
+    // other artboard gets a brand new one.
+    recycled->reset();
+    auto fresh = blendState->makeInstance(freshArtboard.get());
+    REQUIRE(rive::AnimationResetFactory::resourcesCount() == 0);
+
+    auto recycledBlend =
+        static_cast<rive::BlendState1DInstance*>(recycled.get());
+    auto freshBlend = static_cast<rive::BlendState1DInstance*>(fresh.get());
+    for (auto blendAnimation : blendState->animations())
+    {
+        auto recycledAnimation =
+            recycledBlend->animationInstance(blendAnimation);
+        auto freshAnimation = freshBlend->animationInstance(blendAnimation);
+        REQUIRE(recycledAnimation != nullptr);
+        REQUIRE(freshAnimation != nullptr);
+        CHECK(recycledAnimation->time() == freshAnimation->time());
+        CHECK(recycledAnimation->totalTime() == freshAnimation->totalTime());
+    }
+    CHECK(recycled->keepGoing() == fresh->keepGoing());
+
+    // With the blend weights cleared, applying before the first advance
+    // leaves both artboards untouched.
+    auto recycledRect = recycledArtboard->find<rive::Shape>("rect1");
+    auto freshRect = freshArtboard->find<rive::Shape>("rect1");
+    REQUIRE(recycledRect != nullptr);
+    REQUIRE(freshRect != nullptr);
+    float rotation = recycledRect->rotation();
+    recycled->apply(recycledArtboard.get(), 1.0f);
+    CHECK(recycledRect->rotation() == rotation);
+
+    for (int i = 0; i < 3; i++)
+    {
+        recycled->advance(0.1f, &recycledMachine);
+        recycled->apply(recycledArtboard.get(), 1.0f);
+        fresh->advance(0.1f, &freshMachine);
+        fresh->apply(freshArtboard.get(), 1.0f);
+        recycledArtboard->advance(0.0f);
+        freshArtboard->advance(0.0f);
+        CHECK(recycledRect->rotation() == freshRect->rotation());
+        CHECK(recycledRect->x() == freshRect->x());
+        CHECK(recycledRect->y() == freshRect->y());
+    }
+}
+
+TEST_CASE("Layers reuse the instance of a state they come back to", "[file]")
+{
+    auto file = ReadRiveFile("assets/state_machine_triggers.riv");
+
+    auto artboard = file->artboard("main");
+    REQUIRE(artboard != nullptr);
+    auto stateMachine = artboard->stateMachine("State Machine 1");
+    REQUIRE(stateMachine != nullptr);
+
+    auto abi = artboard->instance();
+    rive::StateMachineInstance stateMachineInstance(stateMachine, abi.get());
+    auto trigger = stateMachineInstance.getTrigger("Trigger 1");
+    REQUIRE(trigger != nullptr);
+
+    // The trigger moves the layer into the first animation state (A).
+    trigger->fire();
+    for (int i = 0; i < 5; i++)
+    {
+        stateMachineInstance.advanceAndApply(0.1f);
+    }
+    auto stateA = stateMachineInstance.layerState(0);
+    REQUIRE(stateA->is<rive::AnimationState>());
+    REQUIRE(stateMachineInstance.currentAnimationCount() == 1);
+    float timeInA = stateMachineInstance.currentAnimationByIndex(0)->time();
+
+    // A -> B -> A
+    trigger->fire();
+    stateMachineInstance.advanceAndApply(0.1f);
+    REQUIRE(stateMachineInstance.layerState(0) != stateA);
+    trigger->fire();
+    stateMachineInstance.advanceAndApply(0.1f);
+    REQUIRE(stateMachineInstance.layerState(0) == stateA);
+
+    // The animation of A starts over rather than picking up where it left
+    // off.
+    REQUIRE(stateMachineInstance.currentAnimationCount() == 1);
+    auto animation = stateMachineInstance.currentAnimationByIndex(0);
+    CHECK(animation->time() < timeInA);
+    CHECK(animation->totalTime() < timeInA);
+}
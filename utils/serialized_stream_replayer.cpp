@@ -0,0 +1,525 @@
+#include "utils/serialized_stream_replayer.hpp"
+#include "rive/core/binary_reader.hpp"
+#include "rive/shapes/paint/image_sampler.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <stdio.h>
+
+using namespace rive;
+
+static bool decodeRawPath(BinaryReader& reader, RawPath* path)
+{
+    std::vector<PathVerb> verbs(reader.readVarUintAs<uint32_t>());
+    for (auto& verb : verbs)
+    {
+        verb = (PathVerb)reader.readVarUintAs<uint8_t>();
+    }
+    std::vector<Vec2D> points(reader.readVarUintAs<uint32_t>());
+    for (auto& point : points)
+    {
+        point.x = reader.readFloat32();
+        point.y = reader.readFloat32();
+    }
+    if (reader.hasError())
+    {
+        return false;
+    }
+
+    size_t p = 0;
+    for (auto verb : verbs)
+    {
+        size_t needed = verb == PathVerb::close
+                            ? 0
+                            : (size_t)path_verb_to_point_count(verb);
+        if (p + needed > points.size())
+        {
+            return false;
+        }
+        switch (verb)
+        {
+            case PathVerb::move:
+                path->move(points[p]);
+                break;
+            case PathVerb::line:
+                path->line(points[p]);
+                break;
+            case PathVerb::quad:
+                path->quad(points[p], points[p + 1]);
+                break;
+            case PathVerb::cubic:
+                path->cubic(points[p], points[p + 1], points[p + 2]);
+                break;
+            case PathVerb::close:
+                path->close();
+                break;
+            default:
+                return false;
+        }
+        p += needed;
+    }
+    return p == points.size();
+}
+
+bool SerializedStreamReplayer::load(Span<const uint8_t> stream)
+{
+    reset();
+    m_commands.clear();
+    m_frames.clear();
+    m_totalDrawCount = 0;
+    m_frameWidth = m_frameHeight = 0;
+    m_floats.clear();
+    m_colors.clear();
+    m_stops.clear();
+    m_indices.clear();
+    m_bytes.clear();
+    m_rawPaths.clear();
+
+    BinaryReader reader(stream);
+    if (reader.readByte() != 'S' || reader.readByte() != 'R' ||
+        reader.readByte() != 'I' || reader.readByte() != 'V')
+    {
+        fprintf(stderr, "SerializedStreamReplayer: invalid header\n");
+        return false;
+    }
+    if (reader.readVarUint64() != 1)
+    {
+        fprintf(stderr, "SerializedStreamReplayer: invalid version\n");
+        return false;
+    }
+
+    // Buffer contents are written without a length, the size comes from the
+    // op that created the buffer.
+    std::vector<uint64_t> bufferSizes;
+    Frame frame = {0, 0, 0};
+    while (!reader.reachedEnd())
+    {
+        auto op = (SerializeOp)reader.readVarUintAs<uint8_t>();
+        Command command = {op, 0, {0, 0, 0}, 0.0f, 0, 0};
+        switch (op)
+        {
+            case SerializeOp::makeRenderBuffer:
+            {
+                command.id = reader.readVarUintAs<uint32_t>();
+                uint64_t size = reader.readVarUint64();
+                command.count = (uint32_t)size;
+                command.args[0] = reader.readVarUintAs<uint32_t>();
+                command.args[1] = reader.readVarUintAs<uint32_t>();
+                if (command.id >= bufferSizes.size())
+                {
+                    bufferSizes.resize(command.id + 1);
+                }
+                bufferSizes[command.id] = size;
+                break;
+            }
+            case SerializeOp::makeLinearGradient:
+            case SerializeOp::makeRadialGradient:
+            {
+                command.id = reader.readVarUintAs<uint32_t>();
+                command.offset = (uint32_t)m_colors.size();
+                command.count = reader.readVarUintAs<uint32_t>();
+                for (uint32_t i = 0; i < command.count && !reader.hasError();
+                     i++)
+                {
+                    m_colors.push_back(reader.readVarUintAs<ColorInt>());
+                    m_stops.push_back(reader.readFloat32());
+                }
+                command.args[0] = (uint32_t)m_floats.size();
+                int coordCount = op == SerializeOp::makeLinearGradient ? 4 : 3;
+                for (int i = 0; i < coordCount; i++)
+                {
+                    m_floats.push_back(reader.readFloat32());
+                }
+                break;
+            }
+            case SerializeOp::makeRenderPath:
+            case SerializeOp::makeRenderPaint:
+            case SerializeOp::clipPath:
+            case SerializeOp::rewind:
+                command.id = reader.readVarUintAs<uint32_t>();
+                break;
+            case SerializeOp::decodeImage:
+            {
+                command.id = reader.readVarUintAs<uint32_t>();
+                auto bytes = reader.readBytes(reader.readVarUint64());
+                command.offset = (uint32_t)m_bytes.size();
+                command.count = (uint32_t)bytes.size();
+                m_bytes.insert(m_bytes.end(), bytes.begin(), bytes.end());
+                break;
+            }
+            case SerializeOp::save:
+            case SerializeOp::restore:
+                break;
+            case SerializeOp::transform:
+                command.offset = (uint32_t)m_floats.size();
+                for (int i = 0; i < 6; i++)
+                {
+                    m_floats.push_back(reader.readFloat32());
+                }
+                break;
+            case SerializeOp::drawPath:
+                command.id = reader.readVarUintAs<uint32_t>();
+                command.args[0] = reader.readVarUintAs<uint32_t>();
+                frame.drawCount++;
+                break;
+            case SerializeOp::drawImage:
+                command.id = reader.readVarUintAs<uint32_t>();
+                command.args[0] = reader.readVarUintAs<uint32_t>();
+                command.value = reader.readFloat32();
+                frame.drawCount++;
+                break;
+            case SerializeOp::drawImageMesh:
+                command.id = reader.readVarUintAs<uint32_t>();
+                // Blend mode goes in count so args can hold the three
+                // buffers.
+                command.count = reader.readVarUintAs<uint32_t>();
+                command.value = reader.readFloat32();
+                for (int i = 0; i < 3; i++)
+                {
+                    command.args[i] = reader.readVarUintAs<uint32_t>();
+                }
+                frame.drawCount++;
+                break;
+            case SerializeOp::setVertexBufferData:
+            case SerializeOp::setIndexBufferData:
+            {
+                command.id = reader.readVarUintAs<uint32_t>();
+                if (command.id >= bufferSizes.size())
+                {
+                    fprintf(stderr,
+                            "SerializedStreamReplayer: unknown render buffer "
+                            "%u\n",
+                            command.id);
+                    m_frames.clear();
+                    return false;
+                }
+                if (op == SerializeOp::setVertexBufferData)
+                {
+                    command.offset = (uint32_t)m_floats.size();
+                    command.count =
+                        (uint32_t)(bufferSizes[command.id] / sizeof(float));
+                    for (uint32_t i = 0;
+                         i < command.count && !reader.hasError();
+                         i++)
+                    {
+                        m_floats.push_back(reader.readFloat32());
+                    }
+                }
+                else
+                {
+                    command.offset = (uint32_t)m_indices.size();
+                    command.count =
+                        (uint32_t)(bufferSizes[command.id] / sizeof(uint16_t));
+                    for (uint32_t i = 0;
+                         i < command.count && !reader.hasError();
+                         i++)
+                    {
+                        m_indices.push_back(reader.readVarUintAs<uint16_t>());
+                    }
+                }
+                break;
+            }
+            case SerializeOp::addRawPath:
+                command.id = reader.readVarUintAs<uint32_t>();
+                command.offset = (uint32_t)m_rawPaths.size();
+                m_rawPaths.emplace_back();
+                if (!decodeRawPath(reader, &m_rawPaths.back()))
+                {
+                    fprintf(stderr,
+                            "SerializedStreamReplayer: malformed path %u\n",
+                            command.id);
+                    m_frames.clear();
+                    return false;
+                }
+                break;
+            case SerializeOp::fillRule:
+            case SerializeOp::style:
+            case SerializeOp::color:
+            case SerializeOp::join:
+            case SerializeOp::cap:
+            case SerializeOp::blendMode:
+            case SerializeOp::shader:
+                command.id = reader.readVarUintAs<uint32_t>();
+                command.args[0] = reader.readVarUintAs<uint32_t>();
+                break;
+            case SerializeOp::thickness:
+            case SerializeOp::feather:
+                command.id = reader.readVarUintAs<uint32_t>();
+                command.value = reader.readFloat32();
+                break;
+            case SerializeOp::frame:
+                frame.commandCount = m_commands.size() - frame.firstCommand;
+                m_totalDrawCount += frame.drawCount;
+                m_frames.push_back(frame);
+                frame = {m_commands.size(), 0, 0};
+                continue;
+            case SerializeOp::frameSize:
+                m_frameWidth = reader.readVarUintAs<uint32_t>();
+                m_frameHeight = reader.readVarUintAs<uint32_t>();
+                continue;
+            default:
+                fprintf(stderr,
+                        "SerializedStreamReplayer: unknown op %u\n",
+                        (unsigned)op);
+                m_frames.clear();
+                return false;
+        }
+        if (reader.hasError())
+        {
+            break;
+        }
+        m_commands.push_back(command);
+    }
+    if (reader.hasError())
+    {
+        fprintf(stderr, "SerializedStreamReplayer: truncated stream\n");
+        m_frames.clear();
+        return false;
+    }
+    frame.commandCount = m_commands.size() - frame.firstCommand;
+    m_totalDrawCount += frame.drawCount;
+    m_frames.push_back(frame);
+    return true;
+}
+
+void SerializedStreamReplayer::reset()
+{
+    m_nextFrame = 0;
+    m_buffers.clear();
+    m_shaders.clear();
+    m_paths.clear();
+    m_paints.clear();
+    m_images.clear();
+}
+
+void SerializedStreamReplayer::replayFrame(size_t frameIndex,
+                                           Factory* factory,
+                                           Renderer* renderer)
+{
+    assert(frameIndex == m_nextFrame);
+    const Frame& frame = m_frames[frameIndex];
+    const Command* command = m_commands.data() + frame.firstCommand;
+    const Command* end = command + frame.commandCount;
+    for (; command != end; ++command)
+    {
+        execute(*command, factory, renderer);
+    }
+    m_nextFrame = frameIndex + 1;
+}
+
+void SerializedStreamReplayer::execute(const Command& command,
+                                       Factory* factory,
+                                       Renderer* renderer)
+{
+    switch (command.op)
+    {
+        case SerializeOp::makeRenderBuffer:
+            setResource(m_buffers,
+                        command.id,
+                        factory->makeRenderBuffer(
+                            (RenderBufferType)command.args[0],
+                            (RenderBufferFlags)command.args[1],
+                            command.count));
+            break;
+        case SerializeOp::makeLinearGradient:
+        {
+            const float* coords = m_floats.data() + command.args[0];
+            setResource(m_shaders,
+                        command.id,
+                        factory->makeLinearGradient(coords[0],
+                                                    coords[1],
+                                                    coords[2],
+                                                    coords[3],
+                                                    &m_colors[command.offset],
+                                                    &m_stops[command.offset],
+                                                    command.count));
+            break;
+        }
+        case SerializeOp::makeRadialGradient:
+        {
+            const float* coords = m_floats.data() + command.args[0];
+            setResource(m_shaders,
+                        command.id,
+                        factory->makeRadialGradient(coords[0],
+                                                    coords[1],
+                                                    coords[2],
+                                                    &m_colors[command.offset],
+                                                    &m_stops[command.offset],
+                                                    command.count));
+            break;
+        }
+        case SerializeOp::makeRenderPath:
+            // Paths created with geometry were serialized as an empty path
+            // followed by addRawPath.
+            setResource(m_paths, command.id, factory->makeEmptyRenderPath());
+            break;
+        case SerializeOp::makeRenderPaint:
+            setResource(m_paints, command.id, factory->makeRenderPaint());
+            break;
+        case SerializeOp::decodeImage:
+            setResource(m_images,
+                        command.id,
+                        factory->decodeImage(
+                            Span<const uint8_t>(m_bytes.data() + command.offset,
+                                                command.count)));
+            break;
+        case SerializeOp::save:
+            renderer->save();
+            break;
+        case SerializeOp::restore:
+            renderer->restore();
+            break;
+        case SerializeOp::transform:
+        {
+            const float* m = m_floats.data() + command.offset;
+            renderer->transform(Mat2D(m[0], m[1], m[2], m[3], m[4], m[5]));
+            break;
+        }
+        case SerializeOp::drawPath:
+        {
+            auto path = resource(m_paths, command.id);
+            auto paint = resource(m_paints, command.args[0]);
+            if (path != nullptr && paint != nullptr)
+            {
+                renderer->drawPath(path, paint);
+            }
+            break;
+        }
+        case SerializeOp::clipPath:
+            if (auto path = resource(m_paths, command.id))
+            {
+                renderer->clipPath(path);
+            }
+            break;
+        case SerializeOp::drawImage:
+            // The sampler is not part of the stream.
+            if (auto image = resource(m_images, command.id))
+            {
+                renderer->drawImage(image,
+                                    ImageSampler::LinearClamp(),
+                                    (BlendMode)command.args[0],
+                                    command.value);
+            }
+            break;
+        case SerializeOp::drawImageMesh:
+        {
+            auto image = resource(m_images, command.id);
+            auto positions = ref_rcp(resource(m_buffers, command.args[0]));
+            auto uvs = ref_rcp(resource(m_buffers, command.args[1]));
+            auto indices = ref_rcp(resource(m_buffers, command.args[2]));
+            if (image == nullptr || positions == nullptr || uvs == nullptr ||
+                indices == nullptr)
+            {
+                break;
+            }
+            // Counts are not part of the stream, derive them from the
+            // buffers.
+            auto vertexCount =
+                (uint32_t)(positions->sizeInBytes() / sizeof(Vec2D));
+            auto indexCount =
+                (uint32_t)(indices->sizeInBytes() / sizeof(uint16_t));
+            renderer->drawImageMesh(image,
+                                    ImageSampler::LinearClamp(),
+                                    std::move(positions),
+                                    std::move(uvs),
+                                    std::move(indices),
+                                    vertexCount,
+                                    indexCount,
+                                    (BlendMode)command.count,
+                                    command.value);
+            break;
+        }
+        case SerializeOp::setVertexBufferData:
+        case SerializeOp::setIndexBufferData:
+        {
+            auto buffer = resource(m_buffers, command.id);
+            if (buffer == nullptr)
+            {
+                break;
+            }
+            const void* src = command.op == SerializeOp::setVertexBufferData
+                                  ? (const void*)(m_floats.data() +
+                                                  command.offset)
+                                  : (const void*)(m_indices.data() +
+                                                  command.offset);
+            size_t size = command.op == SerializeOp::setVertexBufferData
+                              ? command.count * sizeof(float)
+                              : command.count * sizeof(uint16_t);
+            memcpy(buffer->map(), src, std::min(size, buffer->sizeInBytes()));
+            buffer->unmap();
+            break;
+        }
+        case SerializeOp::addRawPath:
+            if (auto path = resource(m_paths, command.id))
+            {
+                path->addRawPath(m_rawPaths[command.offset]);
+            }
+            break;
+        case SerializeOp::rewind:
+            if (auto path = resource(m_paths, command.id))
+            {
+                path->rewind();
+            }
+            break;
+        case SerializeOp::fillRule:
+            if (auto path = resource(m_paths, command.id))
+            {
+                path->fillRule((FillRule)command.args[0]);
+            }
+            break;
+        case SerializeOp::style:
+            if (auto paint = resource(m_paints, command.id))
+            {
+                paint->style((RenderPaintStyle)command.args[0]);
+            }
+            break;
+        case SerializeOp::color:
+            if (auto paint = resource(m_paints, command.id))
+            {
+                paint->color(command.args[0]);
+            }
+            break;
+        case SerializeOp::thickness:
+            if (auto paint = resource(m_paints, command.id))
+            {
+                paint->thickness(command.value);
+            }
+            break;
+        case SerializeOp::join:
+            if (auto paint = resource(m_paints, command.id))
+            {
+                paint->join((StrokeJoin)command.args[0]);
+            }
+            break;
+        case SerializeOp::cap:
+            if (auto paint = resource(m_paints, command.id))
+            {
+                paint->cap((StrokeCap)command.args[0]);
+            }
+            break;
+        case SerializeOp::feather:
+            if (auto paint = resource(m_paints, command.id))
+            {
+                paint->feather(command.value);
+            }
+            break;
+        case SerializeOp::blendMode:
+            if (auto paint = resource(m_paints, command.id))
+            {
+                paint->blendMode((BlendMode)command.args[0]);
+            }
+            break;
+        case SerializeOp::shader:
+            // The stream writes 0 for both "no shader" and shader id 0, so
+            // prefer the shader when one with that id exists.
+            if (auto paint = resource(m_paints, command.id))
+            {
+                paint->shader(ref_rcp(resource(m_shaders, command.args[0])));
+            }
+            break;
+        case SerializeOp::frame:
+        case SerializeOp::frameSize:
+            // Consumed by load().
+            break;
+    }
+}
@@ -1,4 +1,5 @@
 #include "utils/serializing_factory.hpp"
+#include "utils/serialize_op.hpp"
 #include "rive/decoders/bitmap_decoder.hpp"
 #include "rive/core/binary_reader.hpp"
 #include <cstring>
@@ -12,46 +13,6 @@ using namespace rive;
 // Threshold for floating point tests.
 static const float epsilon = 0.001f;
 
-enum class SerializeOp : unsigned char
-{
-    makeRenderBuffer = 0,
-    makeLinearGradient = 1,
-    makeRadialGradient = 2,
-    makeRenderPath = 3,
-    makeRenderPaint = 5,
-    decodeImage = 6,
-    save = 7,
-    restore = 8,
-    transform = 9,
-    drawPath = 10,
-    clipPath = 11,
-    drawImage = 12,
-    drawImageMesh = 13,
-
-    // RenderBuffer
-    setVertexBufferData = 14,
-    setIndexBufferData = 15,
-
-    // RenderPath
-    addRawPath = 16,
-    rewind = 17,
-    fillRule = 18,
-
-    // RenderPaint
-    style = 20,
-    color = 21,
-    thickness = 22,
-    join = 23,
-    cap = 24,
-    feather = 25,
-    blendMode = 26,
-    shader = 27,
-
-    frame = 28,
-    frameSize = 29,
-
-};
-
 static const char* opToName(SerializeOp op)
 {
     switch (op)